@@ -0,0 +1,286 @@
+#include "garbochess.h"
+#include "position.h"
+#include "evaluation.h"
+#include "search.h"
+#include "packed.h"
+#include "batch.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+const int BatchChunkSize = 1024;
+
+// Files are evaluated this many positions at a time, so the memory used doesn't depend on the file size
+const int BatchFileBlockSize = 1 << 20;
+
+// Feature records are a few hundred bytes each, so features are extracted in smaller blocks
+const int FeatureFileBlockSize = 1 << 16;
+
+struct BatchWork
+{
+	Position *Positions;						// one of these two is set
+	const PackedPosition *PackedPositions;
+	int Count;
+	int *Evals;
+	int *QSearchScores;
+	std::vector<u8> *FeatureChunks;			// a buffer for each chunk, when extracting features
+	int ChunkCount;
+	volatile int NextChunk;
+	volatile int NextThread;
+};
+
+static void BatchThread(void *argument)
+{
+	BatchWork &work = *(BatchWork*)argument;
+
+	// SearchInfo 0 belongs to the thread reading commands
+	SearchInfo &searchInfo = GetSearchInfo(AtomicIncrement(work.NextThread));
+	ClearEvaluationCaches();
+
+	Position unpacked;
+	for (;;)
+	{
+		const int chunk = AtomicIncrement(work.NextChunk) - 1;
+		if (chunk >= work.ChunkCount)
+		{
+			break;
+		}
+
+		const int start = chunk * BatchChunkSize;
+		const int end = min(start + BatchChunkSize, work.Count);
+		for (int i = start; i < end; i++)
+		{
+			if (work.PackedPositions != 0)
+			{
+				UnpackPosition(work.PackedPositions[i], unpacked);
+			}
+			Position &position = work.PackedPositions != 0 ? unpacked : work.Positions[i];
+
+			EvalInfo evalInfo;
+			work.Evals[i] = Evaluate(position, evalInfo);
+
+			if (work.QSearchScores != 0)
+			{
+				work.QSearchScores[i] = position.IsInCheck() ?
+					QSearchCheck(position, searchInfo, MinEval, MaxEval, -OnePly) :
+					QSearch(position, searchInfo, MinEval, MaxEval, -OnePly);
+			}
+		}
+	}
+}
+
+static void RunBatchWork(BatchWork &work, void (*thread)(void *), const int threadCount)
+{
+	work.ChunkCount = (work.Count + BatchChunkSize - 1) / BatchChunkSize;
+	work.NextChunk = 0;
+	work.NextThread = 0;
+
+	const int helperCount = max(0, min(min(threadCount, MaxThreads), work.ChunkCount) - 1);
+	ThreadHandle threads[MaxThreads];
+	for (int i = 0; i < helperCount; i++)
+	{
+		threads[i] = StartThread(thread, &work);
+	}
+
+	// The calling thread does its share of the work as well
+	thread(&work);
+
+	for (int i = 0; i < helperCount; i++)
+	{
+		WaitForThread(threads[i]);
+	}
+}
+
+void EvaluateBatch(Position *positions, const int count, int *evals, int *qsearchScores, const int threadCount)
+{
+	BatchWork work;
+	work.Positions = positions;
+	work.PackedPositions = 0;
+	work.Count = count;
+	work.Evals = evals;
+	work.QSearchScores = qsearchScores;
+	work.FeatureChunks = 0;
+	RunBatchWork(work, BatchThread, threadCount);
+}
+
+void EvaluateBatch(const PackedPosition *positions, const int count, int *evals, int *qsearchScores, const int threadCount)
+{
+	BatchWork work;
+	work.Positions = 0;
+	work.PackedPositions = positions;
+	work.Count = count;
+	work.Evals = evals;
+	work.QSearchScores = qsearchScores;
+	work.FeatureChunks = 0;
+	RunBatchWork(work, BatchThread, threadCount);
+}
+
+bool EvaluatePackedFile(const std::string &inputFilename, const std::string &outputFilename, const bool qsearch, const int threadCount)
+{
+	u64 count;
+	const PackedPosition *positions = MapPackedPositions(inputFilename, count);
+	if (positions == 0)
+	{
+		return false;
+	}
+
+	std::FILE *output = OpenPackedPositions(outputFilename, false);
+	if (output == NULL)
+	{
+		UnmapPackedPositions(positions, count);
+		return false;
+	}
+
+	const u64 startTime = GetCurrentMilliseconds();
+
+	const int blockCapacity = int(min(u64(BatchFileBlockSize), count));
+	std::vector<int> evals(blockCapacity), qsearchScores(qsearch ? blockCapacity : 0);
+	std::vector<PackedPosition> block(blockCapacity);
+	for (u64 first = 0; first < count; first += blockCapacity)
+	{
+		const int blockSize = int(min(u64(blockCapacity), count - first));
+		EvaluateBatch(positions + first, blockSize, &evals[0], qsearch ? &qsearchScores[0] : 0, threadCount);
+
+		for (int i = 0; i < blockSize; i++)
+		{
+			block[i] = positions[first + i];
+			block[i].Score = s16(qsearch ? qsearchScores[i] : evals[i]);
+		}
+		WritePackedPositions(output, &block[0], blockSize);
+	}
+
+	std::fclose(output);
+	UnmapPackedPositions(positions, count);
+
+	const u64 elapsed = max(u64(1), GetCurrentMilliseconds() - startTime);
+	printf("%lld positions, %lld ms, %.0f positions per second\n", count, elapsed, (double(count) * 1000.0) / double(elapsed));
+	return true;
+}
+
+#ifdef EVAL_TUNING
+
+template<class T>
+static void AppendBytes(std::vector<u8> &buffer, const T *data, const int count)
+{
+	const u8 *bytes = (const u8*)data;
+	buffer.insert(buffer.end(), bytes, bytes + sizeof(T) * count);
+}
+
+static void FeatureThread(void *argument)
+{
+	BatchWork &work = *(BatchWork*)argument;
+
+	// The features are traced, so the evaluation caches aren't used
+	std::vector<u16> features(GetEvalFeatureCount());
+	std::vector<float> counts(GetEvalFeatureCount());
+
+	Position position;
+	for (;;)
+	{
+		const int chunk = AtomicIncrement(work.NextChunk) - 1;
+		if (chunk >= work.ChunkCount)
+		{
+			break;
+		}
+
+		std::vector<u8> &output = work.FeatureChunks[chunk];
+		output.clear();
+
+		const int start = chunk * BatchChunkSize;
+		const int end = min(start + BatchChunkSize, work.Count);
+		for (int i = start; i < end; i++)
+		{
+			const PackedPosition &packed = work.PackedPositions[i];
+			UnpackPosition(packed, position);
+
+			int eval;
+			const int count = GetEvalFeatures(position, &features[0], &counts[0], eval);
+
+			FeatureRecord record;
+			record.Eval = s16(eval);
+			record.Score = packed.Score;
+			record.Result = packed.Result;
+			record.Flags = count < 0 ? FeatureRecordFlagsNoFeatures : 0;
+			record.Count = u16(max(count, 0));
+
+			AppendBytes(output, &record, 1);
+			AppendBytes(output, &features[0], record.Count);
+			AppendBytes(output, &counts[0], record.Count);
+		}
+	}
+}
+
+bool ExtractPackedFeatures(const std::string &inputFilename, const std::string &outputFilename, const int threadCount)
+{
+	u64 count;
+	const PackedPosition *positions = MapPackedPositions(inputFilename, count);
+	if (positions == 0)
+	{
+		return false;
+	}
+
+	std::FILE *output = std::fopen(outputFilename.c_str(), "wb");
+	if (output == NULL)
+	{
+		UnmapPackedPositions(positions, count);
+		return false;
+	}
+	std::setvbuf(output, NULL, _IOFBF, 1 << 20);
+
+	const u64 startTime = GetCurrentMilliseconds();
+
+	FeatureFileHeader header;
+	header.Magic = FeatureFileMagic;
+	header.FeatureCount = GetEvalFeatureCount();
+	std::fwrite(&header, sizeof(header), 1, output);
+
+	for (int i = 0; i < GetEvalFeatureCount(); i++)
+	{
+		FeatureFileColumn column;
+		memset(&column, 0, sizeof(column));
+		strncpy(column.Name, GetEvalFeatureName(i), sizeof(column.Name) - 1);
+		column.Value = GetEvalFeatureValue(i);
+		std::fwrite(&column, sizeof(column), 1, output);
+	}
+
+	std::vector<std::vector<u8> > chunks((FeatureFileBlockSize + BatchChunkSize - 1) / BatchChunkSize);
+	for (u64 first = 0; first < count; first += FeatureFileBlockSize)
+	{
+		BatchWork work;
+		work.Positions = 0;
+		work.PackedPositions = positions + first;
+		work.Count = int(min(u64(FeatureFileBlockSize), count - first));
+		work.Evals = 0;
+		work.QSearchScores = 0;
+		work.FeatureChunks = &chunks[0];
+		RunBatchWork(work, FeatureThread, threadCount);
+
+		// The records go out in the order of the input
+		for (int i = 0; i < work.ChunkCount; i++)
+		{
+			if (!chunks[i].empty())
+			{
+				std::fwrite(&chunks[i][0], 1, chunks[i].size(), output);
+			}
+		}
+	}
+
+	const bool written = std::ferror(output) == 0;
+	std::fclose(output);
+	UnmapPackedPositions(positions, count);
+
+	const u64 elapsed = max(u64(1), GetCurrentMilliseconds() - startTime);
+	printf("%lld positions, %lld ms, %.0f positions per second\n", count, elapsed, (double(count) * 1000.0) / double(elapsed));
+	return written;
+}
+
+#else
+
+bool ExtractPackedFeatures(const std::string &, const std::string &, const int)
+{
+	printf("Feature extraction needs a build with EVAL_TUNING defined\n");
+	return false;
+}
+
+#endif
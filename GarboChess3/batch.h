@@ -0,0 +1,44 @@
+// Evaluating many positions at once, for labelling data sets.
+//
+// Positions are handed out to the threads in chunks.  The results go in separate arrays (evals, and qsearchScores
+// unless it is 0), all for the side to move.  The capture search is the search's own QSearch, without the checks
+// (as for ordering the root moves).  Threads are limited to MaxThreads, each searches with its own SearchInfo.
+void EvaluateBatch(Position *positions, const int count, int *evals, int *qsearchScores, const int threadCount);
+void EvaluateBatch(const PackedPosition *positions, const int count, int *evals, int *qsearchScores, const int threadCount);
+
+// Copies a packed position file with each Score replaced by the static evaluation, or the capture search score when
+// qsearch is set.  Prints the positions per second, returns false if a file can't be opened.
+bool EvaluatePackedFile(const std::string &inputFilename, const std::string &outputFilename, const bool qsearch, const int threadCount);
+
+// Feature files, the training data for the classical evaluation (see GetEvalFeatures).  A FeatureFileHeader and a
+// FeatureFileColumn for each feature come first, then a record for each input position in order: a FeatureRecord,
+// followed by its Count feature indices (u16) and Count counts (float).  Native byte order, like the packed files.
+const u32 FeatureFileMagic = 0x31564647;		// "GFV1"
+
+struct FeatureFileHeader
+{
+	u32 Magic;
+	u32 FeatureCount;
+};
+
+struct FeatureFileColumn
+{
+	char Name[60];
+	s32 Value;			// the value the counts were taken with
+};
+
+struct FeatureRecord
+{
+	s16 Eval;			// classical evaluation, from white's point of view
+	s16 Score;			// copied from the packed position
+	u8 Result;
+	u8 Flags;
+	u16 Count;
+};
+
+// Drawn material and the recognized endgames aren't scored by the features, their records have no counts
+const int FeatureRecordFlagsNoFeatures = 1;
+
+// Writes the features of every position in a packed position file, prints the positions per second.  Needs a build
+// with EVAL_TUNING, returns false without one or if a file can't be opened.
+bool ExtractPackedFeatures(const std::string &inputFilename, const std::string &outputFilename, const int threadCount);
@@ -0,0 +1,999 @@
+#include "garbochess.h"
+#include "position.h"
+#include "bitbase.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+inline int GetKpkIndex(const Square whiteKing, const Square whitePawn, const Square blackKing, const Color toMove)
+{
+	ASSERT(GetColumn(whitePawn) <= FILE_D && GetRow(whitePawn) >= RANK_7 && GetRow(whitePawn) <= RANK_2);
+
+	// Pawns are only on rows 1-6 (ranks 7-2)
+	const int pawnIndex = (GetRow(whitePawn) - RANK_7) * 4 + GetColumn(whitePawn);
+	return whiteKing | (blackKing << 6) | (toMove << 12) | (pawnIndex << 13);
+}
+
+bool ProbeKpk(Square whiteKing, Square whitePawn, Square blackKing, const Color toMove)
+{
+	if (GetColumn(whitePawn) > FILE_D)
+	{
+		whiteKing = MakeSquare(GetRow(whiteKing), FILE_H - GetColumn(whiteKing));
+		whitePawn = MakeSquare(GetRow(whitePawn), FILE_H - GetColumn(whitePawn));
+		blackKing = MakeSquare(GetRow(blackKing), FILE_H - GetColumn(blackKing));
+	}
+
+	const int index = GetKpkIndex(whiteKing, whitePawn, blackKing, toMove);
+	return (KpkBitbase[index >> 5] & (1U << (index & 31))) != 0;
+}
+
+bool ProbeKpk(const Position &position)
+{
+	const Color strongSide = (position.Pieces[PAWN] & position.Colors[WHITE]) ? WHITE : BLACK;
+	const Square pawn = GetFirstBitIndex(position.Pieces[PAWN]);
+
+	if (strongSide == WHITE)
+	{
+		return ProbeKpk(position.KingPos[WHITE], pawn, position.KingPos[BLACK], position.ToMove);
+	}
+
+	return ProbeKpk(FlipSquare(position.KingPos[BLACK]), FlipSquare(pawn), FlipSquare(position.KingPos[WHITE]), FlipColor(position.ToMove));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Generation
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum KpkResult
+{
+	KpkInvalid,
+	KpkUnknown,
+	KpkDraw,
+	KpkWin,
+};
+
+static KpkResult ClassifyKpkStart(const Square whiteKing, const Square whitePawn, const Square blackKing, const Color toMove)
+{
+	const Bitboard whiteKingAttacks = GetKingAttacks(whiteKing);
+	const Bitboard pawnAttacks = GetPawnAttacks(whitePawn, WHITE);
+
+	if (whiteKing == blackKing || whiteKing == whitePawn || blackKing == whitePawn ||
+		IsBitSet(whiteKingAttacks, blackKing) ||
+		(toMove == WHITE && IsBitSet(pawnAttacks, blackKing)))
+	{
+		return KpkInvalid;
+	}
+
+	if (toMove == WHITE)
+	{
+		// Promotes safely
+		const Square promotionSquare = whitePawn - 8;
+		if (GetRow(whitePawn) == RANK_7 &&
+			promotionSquare != whiteKing && promotionSquare != blackKing &&
+			(!IsBitSet(GetKingAttacks(blackKing), promotionSquare) || IsBitSet(whiteKingAttacks, promotionSquare)))
+		{
+			return KpkWin;
+		}
+	}
+	else
+	{
+		// Stalemated, or takes the pawn
+		const Bitboard safeSquares = GetKingAttacks(blackKing) & ~(whiteKingAttacks | pawnAttacks);
+		if (safeSquares == 0)
+		{
+			return KpkDraw;
+		}
+		if (IsBitSet(GetKingAttacks(blackKing), whitePawn) && !IsBitSet(whiteKingAttacks, whitePawn))
+		{
+			return KpkDraw;
+		}
+	}
+
+	return KpkUnknown;
+}
+
+// Won for white if white has a move to a win, drawn for black if black has a move to a draw.  Promotions are only
+// counted when they are safe (ClassifyKpkStart).
+static KpkResult ClassifyKpk(const std::vector<u8> &results, const Square whiteKing, const Square whitePawn, const Square blackKing, const Color toMove)
+{
+	const KpkResult good = toMove == WHITE ? KpkWin : KpkDraw;
+	const KpkResult bad = toMove == WHITE ? KpkDraw : KpkWin;
+
+	bool unknown = false;
+
+	Bitboard kingMoves = GetKingAttacks(toMove == WHITE ? whiteKing : blackKing);
+	while (kingMoves)
+	{
+		const Square to = PopFirstBit(kingMoves);
+		const int index = toMove == WHITE ?
+			GetKpkIndex(to, whitePawn, blackKing, BLACK) :
+			GetKpkIndex(whiteKing, whitePawn, to, WHITE);
+
+		const KpkResult result = KpkResult(results[index]);
+		if (result == good)
+		{
+			return good;
+		}
+		unknown |= result == KpkUnknown;
+	}
+
+	if (toMove == WHITE && GetRow(whitePawn) != RANK_7)
+	{
+		const Square push = whitePawn - 8;
+		if (push != whiteKing && push != blackKing)
+		{
+			const KpkResult result = KpkResult(results[GetKpkIndex(whiteKing, push, blackKing, BLACK)]);
+			if (result == good)
+			{
+				return good;
+			}
+			unknown |= result == KpkUnknown;
+
+			const Square doublePush = push - 8;
+			if (GetRow(whitePawn) == RANK_2 && doublePush != whiteKing && doublePush != blackKing)
+			{
+				const KpkResult result = KpkResult(results[GetKpkIndex(whiteKing, doublePush, blackKing, BLACK)]);
+				if (result == good)
+				{
+					return good;
+				}
+				unknown |= result == KpkUnknown;
+			}
+		}
+	}
+
+	// Moves into invalid positions (king next to king, into check) are illegal, and don't count
+	return unknown ? KpkUnknown : bad;
+}
+
+void GenerateKpkBitbase(u32 bitbase[KpkBitbaseSize])
+{
+	const int positionCount = KpkBitbaseSize * 32;
+	std::vector<u8> results(positionCount);
+
+	for (int index = 0; index < positionCount; index++)
+	{
+		const Square whiteKing = index & 63;
+		const Square blackKing = (index >> 6) & 63;
+		const Color toMove = Color((index >> 12) & 1);
+		const int pawnIndex = index >> 13;
+		const Square whitePawn = MakeSquare(RANK_7 + pawnIndex / 4, pawnIndex % 4);
+
+		results[index] = u8(ClassifyKpkStart(whiteKing, whitePawn, blackKing, toMove));
+	}
+
+	// Iterate until nothing changes, everything still unknown is a draw
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
+		for (int index = 0; index < positionCount; index++)
+		{
+			if (results[index] != KpkUnknown)
+			{
+				continue;
+			}
+
+			const int pawnIndex = index >> 13;
+			const KpkResult result = ClassifyKpk(results, index & 63, MakeSquare(RANK_7 + pawnIndex / 4, pawnIndex % 4),
+				(index >> 6) & 63, Color((index >> 12) & 1));
+			if (result != KpkUnknown)
+			{
+				results[index] = u8(result);
+				changed = true;
+			}
+		}
+	}
+
+	memset(bitbase, 0, KpkBitbaseSize * sizeof(u32));
+	for (int index = 0; index < positionCount; index++)
+	{
+		if (results[index] == KpkWin)
+		{
+			bitbase[index >> 5] |= 1U << (index & 31);
+		}
+	}
+}
+
+bool WriteKpkBitbase(const std::string &filename)
+{
+	std::FILE *file = std::fopen(filename.c_str(), "wt");
+	if (file == NULL)
+	{
+		return false;
+	}
+
+	std::vector<u32> bitbase(KpkBitbaseSize);
+	GenerateKpkBitbase(&bitbase[0]);
+
+	fprintf(file, "const u32 KpkBitbase[KpkBitbaseSize] =\n{\n");
+	for (int i = 0; i < KpkBitbaseSize; i += 8)
+	{
+		fprintf(file, "\t");
+		for (int j = i; j < i + 8; j++)
+		{
+			fprintf(file, "0x%08x,%s", bitbase[j], j + 1 < i + 8 ? " " : "\n");
+		}
+	}
+	fprintf(file, "};\n");
+
+	std::fclose(file);
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Table, generated by kpkgen
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const u32 KpkBitbase[KpkBitbaseSize] =
+{
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfffff0f0, 0xffffffff, 0xffffe2e3, 0xffffffff,
+	0xffffc6c7, 0xffffffff, 0xffff8e8f, 0xffffffff, 0xffff1e1f, 0xffffffff, 0xffff3e3f, 0xffffffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfff1f0f0, 0xffffffff, 0xffe3e2e3, 0xffffffff,
+	0xffc7c6c7, 0xffffffff, 0xff8f8e8f, 0xffffffff, 0xff1f1e1f, 0xffffffff, 0xff3f3e3f, 0xffffffff,
+	0xfcfcfcff, 0xffffffff, 0xf8f8f8ff, 0xffffffff, 0xf1f1f0ff, 0xffffffff, 0xe3e3e2ff, 0xffffffff,
+	0xc7c7c6ff, 0xffffffff, 0x8f8f8eff, 0xffffffff, 0x1f1f1eff, 0xffffffff, 0x3f3f3eff, 0xffffffff,
+	0xfcfcfeff, 0xfffffffc, 0xf8f8feff, 0xfffffff8, 0xf1f1feff, 0xfffffff1, 0xe3e3feff, 0xffffffe3,
+	0xc7c7feff, 0xffffffc7, 0x8f8ffeff, 0xffffff8f, 0x1f1ffeff, 0xffffff1f, 0x3f3ffeff, 0xffffff3f,
+	0xfcfffeff, 0xfffffcfc, 0xf8fffeff, 0xfffff8f8, 0xf1fffeff, 0xfffff1f1, 0xe3fffeff, 0xffffe3e3,
+	0xc7fffeff, 0xffffc7c7, 0x8ffffeff, 0xffff8f8f, 0x1ffffeff, 0xffff1f1f, 0x3ffffeff, 0xffff3f3f,
+	0xfffffeff, 0xfffcfcfc, 0xfffffeff, 0xfff8f8f8, 0xfffffeff, 0xfff1f1f1, 0xfffffeff, 0xffe3e3e3,
+	0xfffffeff, 0xffc7c7c7, 0xfffffeff, 0xff8f8f8f, 0xfffffeff, 0xff1f1f1f, 0xfffffeff, 0xff3f3f3f,
+	0xfffffeff, 0xfcfcfcff, 0xfffffeff, 0xf8f8f8ff, 0xfffffeff, 0xf1f1f1ff, 0xfffffeff, 0xe3e3e3ff,
+	0xfffffeff, 0xc7c7c7ff, 0xfffffeff, 0x8f8f8fff, 0xfffffeff, 0x1f1f1fff, 0xfffffeff, 0x3f3f3fff,
+	0xfffffeff, 0xfcfcffff, 0xfffffeff, 0xf8f8ffff, 0xfffffeff, 0xf1f1ffff, 0xfffffeff, 0xe3e3ffff,
+	0xfffffeff, 0xc7c7ffff, 0xfffffeff, 0x8f8fffff, 0xfffffeff, 0x1f1fffff, 0xfffffeff, 0x3f3fffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00070000, 0x00000000, 0xffffe2e2, 0xffffffff,
+	0xffffc6c7, 0xffffffff, 0xffff8e8f, 0xffffffff, 0xffff1e1f, 0xffffffff, 0xffff3e3f, 0xffffffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0xffe3e2e2, 0xffffffff,
+	0xffc7c6c7, 0xffffffff, 0xff8f8e8f, 0xffffffff, 0xff1f1e1f, 0xffffffff, 0xff3f3e3f, 0xffffffff,
+	0x00000003, 0x00000000, 0x00000002, 0x00000000, 0x00010006, 0x00000000, 0xe3e3e2fe, 0xffffffff,
+	0xc7c7c6ff, 0xffffffff, 0x8f8f8eff, 0xffffffff, 0x1f1f1eff, 0xffffffff, 0x3f3f3eff, 0xffffffff,
+	0xfcfcfeff, 0xfffffffc, 0xf8f8feff, 0xfffffff8, 0xf1f1feff, 0xfffffff1, 0xe3e3feff, 0xffffffe3,
+	0xc7c7feff, 0xffffffc7, 0x8f8ffeff, 0xffffff8f, 0x1f1ffeff, 0xffffff1f, 0x3f3ffeff, 0xffffff3f,
+	0xfcfffeff, 0xfffffcfc, 0xf8fffeff, 0xfffff8f8, 0xf1fffeff, 0xfffff1f1, 0xe3fffeff, 0xffffe3e3,
+	0xc7fffeff, 0xffffc7c7, 0x8ffffeff, 0xffff8f8f, 0x1ffffeff, 0xffff1f1f, 0x3ffffeff, 0xffff3f3f,
+	0xfffffeff, 0xfffcfcfc, 0xfffffeff, 0xfff8f8f8, 0xfffffeff, 0xfff1f1f1, 0xfffffeff, 0xffe3e3e3,
+	0xfffffeff, 0xffc7c7c7, 0xfffffeff, 0xff8f8f8f, 0xfffffeff, 0xff1f1f1f, 0xfffffeff, 0xff3f3f3f,
+	0xfffffeff, 0xfcfcfcff, 0xfffffeff, 0xf8f8f8ff, 0xfffffeff, 0xf1f1f1ff, 0xfffffeff, 0xe3e3e3ff,
+	0xfffffeff, 0xc7c7c7ff, 0xfffffeff, 0x8f8f8fff, 0xfffffeff, 0x1f1f1fff, 0xfffffeff, 0x3f3f3fff,
+	0xfffffeff, 0xfcfcffff, 0xfffffeff, 0xf8f8ffff, 0xfffffeff, 0xf1f1ffff, 0xfffffeff, 0xe3e3ffff,
+	0xfffffeff, 0xc7c7ffff, 0xfffffeff, 0x8f8fffff, 0xfffffeff, 0x1f1fffff, 0xfffffeff, 0x3f3fffff,
+	0x00000000, 0x00000000, 0x0f0a0800, 0x00000000, 0x00000000, 0x00000000, 0xffffe1e3, 0xffffffff,
+	0xffffc5c7, 0xffffffff, 0xffff8d8f, 0xffffffff, 0xffff1d1f, 0xffffffff, 0xffff3d3f, 0xffffffff,
+	0x000c0c0c, 0x00000000, 0x00000000, 0x00000000, 0x00010101, 0x00000000, 0xffe3e1e3, 0xffffffff,
+	0xffc7c5c7, 0xffffffff, 0xff8f8d8f, 0xffffffff, 0xff1f1d1f, 0xffffffff, 0xff3f3d3f, 0xffffffff,
+	0xfcfcfcff, 0xffffffff, 0xf8f8f8ff, 0xffffffff, 0xf1f1f1ff, 0xffffffff, 0xe3e3e1ff, 0xffffffff,
+	0xc7c7c5ff, 0xffffffff, 0x8f8f8dff, 0xffffffff, 0x1f1f1dff, 0xffffffff, 0x3f3f3dff, 0xffffffff,
+	0xfcfcfdff, 0xfffffffc, 0xf8f8fdff, 0xfffffff8, 0xf1f1fdff, 0xfffffff1, 0xe3e3fdff, 0xffffffe3,
+	0xc7c7fdff, 0xffffffc7, 0x8f8ffdff, 0xffffff8f, 0x1f1ffdff, 0xffffff1f, 0x3f3ffdff, 0xffffff3f,
+	0xfcfffdff, 0xfffffcfc, 0xf8fffdff, 0xfffff8f8, 0xf1fffdff, 0xfffff1f1, 0xe3fffdff, 0xffffe3e3,
+	0xc7fffdff, 0xffffc7c7, 0x8ffffdff, 0xffff8f8f, 0x1ffffdff, 0xffff1f1f, 0x3ffffdff, 0xffff3f3f,
+	0xfffffdff, 0xfffcfcfc, 0xfffffdff, 0xfff8f8f8, 0xfffffdff, 0xfff1f1f1, 0xfffffdff, 0xffe3e3e3,
+	0xfffffdff, 0xffc7c7c7, 0xfffffdff, 0xff8f8f8f, 0xfffffdff, 0xff1f1f1f, 0xfffffdff, 0xff3f3f3f,
+	0xfffffdff, 0xfcfcfcff, 0xfffffdff, 0xf8f8f8ff, 0xfffffdff, 0xf1f1f1ff, 0xfffffdff, 0xe3e3e3ff,
+	0xfffffdff, 0xc7c7c7ff, 0xfffffdff, 0x8f8f8fff, 0xfffffdff, 0x1f1f1fff, 0xfffffdff, 0x3f3f3fff,
+	0xfffffdff, 0xfcfcffff, 0xfffffdff, 0xf8f8ffff, 0xfffffdff, 0xf1f1ffff, 0xfffffdff, 0xe3e3ffff,
+	0xfffffdff, 0xc7c7ffff, 0xfffffdff, 0x8f8fffff, 0xfffffdff, 0x1f1fffff, 0xfffffdff, 0x3f3fffff,
+	0x00020404, 0x00000000, 0x00050000, 0x00000000, 0x00020101, 0x00000000, 0x000f0103, 0x00000000,
+	0xffffc5c7, 0xffffffff, 0xffff8d8f, 0xffffffff, 0xffff1d1f, 0xffffffff, 0xffff3d3f, 0xffffffff,
+	0x00000404, 0x00000000, 0x00000000, 0x00000000, 0x00000101, 0x00000000, 0x00030103, 0x00000000,
+	0xffc7c5c7, 0xffffffff, 0xff8f8d8f, 0xffffffff, 0xff1f1d1f, 0xffffffff, 0xff3f3d3f, 0xffffffff,
+	0x00040407, 0x00000000, 0x00000007, 0x00000000, 0x00010107, 0x00000000, 0x0003010f, 0x00000000,
+	0xc7c7c5ff, 0xffffffff, 0x8f8f8dff, 0xffffffff, 0x1f1f1dff, 0xffffffff, 0x3f3f3dff, 0xffffffff,
+	0xfcfcfdff, 0xfffffffc, 0xf8f8fdff, 0xfffffff8, 0xf1f1fdff, 0xfffffff1, 0xe3e3fdff, 0xffffffe3,
+	0xc7c7fdff, 0xffffffc7, 0x8f8ffdff, 0xffffff8f, 0x1f1ffdff, 0xffffff1f, 0x3f3ffdff, 0xffffff3f,
+	0xfcfffdff, 0xfffffcfc, 0xf8fffdff, 0xfffff8f8, 0xf1fffdff, 0xfffff1f1, 0xe3fffdff, 0xffffe3e3,
+	0xc7fffdff, 0xffffc7c7, 0x8ffffdff, 0xffff8f8f, 0x1ffffdff, 0xffff1f1f, 0x3ffffdff, 0xffff3f3f,
+	0xfffffdff, 0xfffcfcfc, 0xfffffdff, 0xfff8f8f8, 0xfffffdff, 0xfff1f1f1, 0xfffffdff, 0xffe3e3e3,
+	0xfffffdff, 0xffc7c7c7, 0xfffffdff, 0xff8f8f8f, 0xfffffdff, 0xff1f1f1f, 0xfffffdff, 0xff3f3f3f,
+	0xfffffdff, 0xfcfcfcff, 0xfffffdff, 0xf8f8f8ff, 0xfffffdff, 0xf1f1f1ff, 0xfffffdff, 0xe3e3e3ff,
+	0xfffffdff, 0xc7c7c7ff, 0xfffffdff, 0x8f8f8fff, 0xfffffdff, 0x1f1f1fff, 0xfffffdff, 0x3f3f3fff,
+	0xfffffdff, 0xfcfcffff, 0xfffffdff, 0xf8f8ffff, 0xfffffdff, 0xf1f1ffff, 0xfffffdff, 0xe3e3ffff,
+	0xfffffdff, 0xc7c7ffff, 0xfffffdff, 0x8f8fffff, 0xfffffdff, 0x1f1fffff, 0xfffffdff, 0x3f3fffff,
+	0xfffff8fc, 0xffffffff, 0x00000000, 0x00000000, 0x1f151100, 0x00000000, 0x00000000, 0x00000000,
+	0xffffc3c7, 0xffffffff, 0xffff8b8f, 0xffffffff, 0xffff1b1f, 0xffffffff, 0xffff3b3f, 0xffffffff,
+	0xfffcf8fc, 0xffffffff, 0x00181818, 0x00000000, 0x00000000, 0x00000000, 0x00030303, 0x00000000,
+	0xffc7c3c7, 0xffffffff, 0xff8f8b8f, 0xffffffff, 0xff1f1b1f, 0xffffffff, 0xff3f3b3f, 0xffffffff,
+	0xfcfcf8ff, 0xffffffff, 0xf8f8f8ff, 0xffffffff, 0xf1f1f1ff, 0xffffffff, 0xe3e3e3ff, 0xffffffff,
+	0xc7c7c3ff, 0xffffffff, 0x8f8f8bff, 0xffffffff, 0x1f1f1bff, 0xffffffff, 0x3f3f3bff, 0xffffffff,
+	0xfcfcfbff, 0xfffffffc, 0xf8f8fbff, 0xfffffff8, 0xf1f1fbff, 0xfffffff1, 0xe3e3fbff, 0xffffffe3,
+	0xc7c7fbff, 0xffffffc7, 0x8f8ffbff, 0xffffff8f, 0x1f1ffbff, 0xffffff1f, 0x3f3ffbff, 0xffffff3f,
+	0xfcfffbff, 0xfffffcfc, 0xf8fffbff, 0xfffff8f8, 0xf1fffbff, 0xfffff1f1, 0xe3fffbff, 0xffffe3e3,
+	0xc7fffbff, 0xffffc7c7, 0x8ffffbff, 0xffff8f8f, 0x1ffffbff, 0xffff1f1f, 0x3ffffbff, 0xffff3f3f,
+	0xfffffbff, 0xfffcfcfc, 0xfffffbff, 0xfff8f8f8, 0xfffffbff, 0xfff1f1f1, 0xfffffbff, 0xffe3e3e3,
+	0xfffffbff, 0xffc7c7c7, 0xfffffbff, 0xff8f8f8f, 0xfffffbff, 0xff1f1f1f, 0xfffffbff, 0xff3f3f3f,
+	0xfffffbff, 0xfcfcfcff, 0xfffffbff, 0xf8f8f8ff, 0xfffffbff, 0xf1f1f1ff, 0xfffffbff, 0xe3e3e3ff,
+	0xfffffbff, 0xc7c7c7ff, 0xfffffbff, 0x8f8f8fff, 0xfffffbff, 0x1f1f1fff, 0xfffffbff, 0x3f3f3fff,
+	0xfffffbff, 0xfcfcffff, 0xfffffbff, 0xf8f8ffff, 0xfffffbff, 0xf1f1ffff, 0xfffffbff, 0xe3e3ffff,
+	0xfffffbff, 0xc7c7ffff, 0xfffffbff, 0x8f8fffff, 0xfffffbff, 0x1f1fffff, 0xfffffbff, 0x3f3fffff,
+	0x001c181c, 0x00000000, 0x00040808, 0x00000000, 0x000a0000, 0x00000000, 0x00040202, 0x00000000,
+	0x001f0307, 0x00000000, 0xffff8b8f, 0xffffffff, 0xffff1b1f, 0xffffffff, 0xffff3b3f, 0xffffffff,
+	0x001c181c, 0x00000000, 0x00000808, 0x00000000, 0x00000000, 0x00000000, 0x00000202, 0x00000000,
+	0x00070307, 0x00000000, 0xff8f8b8f, 0xffffffff, 0xff1f1b1f, 0xffffffff, 0xff3f3b3f, 0xffffffff,
+	0x001c181f, 0x00000000, 0x0008080e, 0x00000000, 0x0000000e, 0x00000000, 0x0002020e, 0x00000000,
+	0x0007031f, 0x00000000, 0x8f8f8bff, 0xffffffff, 0x1f1f1bff, 0xffffffff, 0x3f3f3bff, 0xffffffff,
+	0xfcfcfbff, 0xfffffffc, 0xf8f8fbff, 0xfffffff8, 0xf1f1fbff, 0xfffffff1, 0xe3e3fbff, 0xffffffe3,
+	0xc7c7fbff, 0xffffffc7, 0x8f8ffbff, 0xffffff8f, 0x1f1ffbff, 0xffffff1f, 0x3f3ffbff, 0xffffff3f,
+	0xfcfffbff, 0xfffffcfc, 0xf8fffbff, 0xfffff8f8, 0xf1fffbff, 0xfffff1f1, 0xe3fffbff, 0xffffe3e3,
+	0xc7fffbff, 0xffffc7c7, 0x8ffffbff, 0xffff8f8f, 0x1ffffbff, 0xffff1f1f, 0x3ffffbff, 0xffff3f3f,
+	0xfffffbff, 0xfffcfcfc, 0xfffffbff, 0xfff8f8f8, 0xfffffbff, 0xfff1f1f1, 0xfffffbff, 0xffe3e3e3,
+	0xfffffbff, 0xffc7c7c7, 0xfffffbff, 0xff8f8f8f, 0xfffffbff, 0xff1f1f1f, 0xfffffbff, 0xff3f3f3f,
+	0xfffffbff, 0xfcfcfcff, 0xfffffbff, 0xf8f8f8ff, 0xfffffbff, 0xf1f1f1ff, 0xfffffbff, 0xe3e3e3ff,
+	0xfffffbff, 0xc7c7c7ff, 0xfffffbff, 0x8f8f8fff, 0xfffffbff, 0x1f1f1fff, 0xfffffbff, 0x3f3f3fff,
+	0xfffffbff, 0xfcfcffff, 0xfffffbff, 0xf8f8ffff, 0xfffffbff, 0xf1f1ffff, 0xfffffbff, 0xe3e3ffff,
+	0xfffffbff, 0xc7c7ffff, 0xfffffbff, 0x8f8fffff, 0xfffffbff, 0x1f1fffff, 0xfffffbff, 0x3f3fffff,
+	0xfffff4fc, 0xffffffff, 0xfffff0f8, 0xffffffff, 0x00000000, 0x00000000, 0x3e2a2200, 0x00000000,
+	0x00000000, 0x00000000, 0xffff878f, 0xffffffff, 0xffff171f, 0xffffffff, 0xffff373f, 0xffffffff,
+	0xfffcf4fc, 0xffffffff, 0xfff8f0f8, 0xffffffff, 0x00303030, 0x00000000, 0x00000000, 0x00000000,
+	0x00060606, 0x00000000, 0xff8f878f, 0xffffffff, 0xff1f171f, 0xffffffff, 0xff3f373f, 0xffffffff,
+	0xfcfcf4ff, 0xffffffff, 0xf8f8f0ff, 0xffffffff, 0xf1f1f1ff, 0xffffffff, 0xe3e3e3ff, 0xffffffff,
+	0xc7c7c7ff, 0xffffffff, 0x8f8f87ff, 0xffffffff, 0x1f1f17ff, 0xffffffff, 0x3f3f37ff, 0xffffffff,
+	0xfcfcf7ff, 0xfffffffc, 0xf8f8f7ff, 0xfffffff8, 0xf1f1f7ff, 0xfffffff1, 0xe3e3f7ff, 0xffffffe3,
+	0xc7c7f7ff, 0xffffffc7, 0x8f8ff7ff, 0xffffff8f, 0x1f1ff7ff, 0xffffff1f, 0x3f3ff7ff, 0xffffff3f,
+	0xfcfff7ff, 0xfffffcfc, 0xf8fff7ff, 0xfffff8f8, 0xf1fff7ff, 0xfffff1f1, 0xe3fff7ff, 0xffffe3e3,
+	0xc7fff7ff, 0xffffc7c7, 0x8ffff7ff, 0xffff8f8f, 0x1ffff7ff, 0xffff1f1f, 0x3ffff7ff, 0xffff3f3f,
+	0xfffff7ff, 0xfffcfcfc, 0xfffff7ff, 0xfff8f8f8, 0xfffff7ff, 0xfff1f1f1, 0xfffff7ff, 0xffe3e3e3,
+	0xfffff7ff, 0xffc7c7c7, 0xfffff7ff, 0xff8f8f8f, 0xfffff7ff, 0xff1f1f1f, 0xfffff7ff, 0xff3f3f3f,
+	0xfffff7ff, 0xfcfcfcff, 0xfffff7ff, 0xf8f8f8ff, 0xfffff7ff, 0xf1f1f1ff, 0xfffff7ff, 0xe3e3e3ff,
+	0xfffff7ff, 0xc7c7c7ff, 0xfffff7ff, 0x8f8f8fff, 0xfffff7ff, 0x1f1f1fff, 0xfffff7ff, 0x3f3f3fff,
+	0xfffff7ff, 0xfcfcffff, 0xfffff7ff, 0xf8f8ffff, 0xfffff7ff, 0xf1f1ffff, 0xfffff7ff, 0xe3e3ffff,
+	0xfffff7ff, 0xc7c7ffff, 0xfffff7ff, 0x8f8fffff, 0xfffff7ff, 0x1f1fffff, 0xfffff7ff, 0x3f3fffff,
+	0xfffff4fc, 0xffffffff, 0x003e3038, 0x00000000, 0x00081010, 0x00000000, 0x00140000, 0x00000000,
+	0x00080404, 0x00000000, 0x003e060e, 0x00000000, 0xffff171f, 0xffffffff, 0xffff373f, 0xffffffff,
+	0xfffcf4fc, 0xffffffff, 0x00383038, 0x00000000, 0x00001010, 0x00000000, 0x00000000, 0x00000000,
+	0x00000404, 0x00000000, 0x000e060e, 0x00000000, 0xff1f171f, 0xffffffff, 0xff3f373f, 0xffffffff,
+	0xfcfcf4ff, 0xffffffff, 0x0038303e, 0x00000000, 0x0010101c, 0x00000000, 0x0000001c, 0x00000000,
+	0x0004041c, 0x00000000, 0x000e063e, 0x00000000, 0x1f1f17ff, 0xffffffff, 0x3f3f37ff, 0xffffffff,
+	0xfcfcf7ff, 0xfffffffc, 0xf8f8f7ff, 0xfffffff8, 0xf1f1f7ff, 0xfffffff1, 0xe3e3f7ff, 0xffffffe3,
+	0xc7c7f7ff, 0xffffffc7, 0x8f8ff7ff, 0xffffff8f, 0x1f1ff7ff, 0xffffff1f, 0x3f3ff7ff, 0xffffff3f,
+	0xfcfff7ff, 0xfffffcfc, 0xf8fff7ff, 0xfffff8f8, 0xf1fff7ff, 0xfffff1f1, 0xe3fff7ff, 0xffffe3e3,
+	0xc7fff7ff, 0xffffc7c7, 0x8ffff7ff, 0xffff8f8f, 0x1ffff7ff, 0xffff1f1f, 0x3ffff7ff, 0xffff3f3f,
+	0xfffff7ff, 0xfffcfcfc, 0xfffff7ff, 0xfff8f8f8, 0xfffff7ff, 0xfff1f1f1, 0xfffff7ff, 0xffe3e3e3,
+	0xfffff7ff, 0xffc7c7c7, 0xfffff7ff, 0xff8f8f8f, 0xfffff7ff, 0xff1f1f1f, 0xfffff7ff, 0xff3f3f3f,
+	0xfffff7ff, 0xfcfcfcff, 0xfffff7ff, 0xf8f8f8ff, 0xfffff7ff, 0xf1f1f1ff, 0xfffff7ff, 0xe3e3e3ff,
+	0xfffff7ff, 0xc7c7c7ff, 0xfffff7ff, 0x8f8f8fff, 0xfffff7ff, 0x1f1f1fff, 0xfffff7ff, 0x3f3f3fff,
+	0xfffff7ff, 0xfcfcffff, 0xfffff7ff, 0xf8f8ffff, 0xfffff7ff, 0xf1f1ffff, 0xfffff7ff, 0xe3e3ffff,
+	0xfffff7ff, 0xc7c7ffff, 0xfffff7ff, 0x8f8fffff, 0xfffff7ff, 0x1f1fffff, 0xfffff7ff, 0x3f3fffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00060000, 0x00000000, 0xfffee3e3, 0xffffffff,
+	0xfffec7c7, 0xffffffff, 0xfffe8f8f, 0xffffffff, 0xfffe1f1f, 0xffffffff, 0xfffe3f3f, 0xffffffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffe2e3e3, 0xffffffff,
+	0xffc6c7c7, 0xffffffff, 0xff8e8f8f, 0xffffffff, 0xff1e1f1f, 0xffffffff, 0xff3e3f3f, 0xffffffff,
+	0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x00000107, 0x00000000, 0xe3e2e3ff, 0xffffffff,
+	0xc7c6c7ff, 0xffffffff, 0x8f8e8fff, 0xffffffff, 0x1f1e1fff, 0xffffffff, 0x3f3e3fff, 0xffffffff,
+	0xfcfcffff, 0xfffffffc, 0xf8f8ffff, 0xfffffff8, 0xf1f0ffff, 0xfffffff1, 0xe3e2ffff, 0xffffffe3,
+	0xc7c6ffff, 0xffffffc7, 0x8f8effff, 0xffffff8f, 0x1f1effff, 0xffffff1f, 0x3f3effff, 0xffffff3f,
+	0xfcfeffff, 0xfffffcfc, 0xf8feffff, 0xfffff8f8, 0xf1feffff, 0xfffff1f1, 0xe3feffff, 0xffffe3e3,
+	0xc7feffff, 0xffffc7c7, 0x8ffeffff, 0xffff8f8f, 0x1ffeffff, 0xffff1f1f, 0x3ffeffff, 0xffff3f3f,
+	0xfffeffff, 0xfffcfcfc, 0xfffeffff, 0xfff8f8f8, 0xfffeffff, 0xfff1f1f1, 0xfffeffff, 0xffe3e3e3,
+	0xfffeffff, 0xffc7c7c7, 0xfffeffff, 0xff8f8f8f, 0xfffeffff, 0xff1f1f1f, 0xfffeffff, 0xff3f3f3f,
+	0xfffeffff, 0xfcfcfcff, 0xfffeffff, 0xf8f8f8ff, 0xfffeffff, 0xf1f1f1ff, 0xfffeffff, 0xe3e3e3ff,
+	0xfffeffff, 0xc7c7c7ff, 0xfffeffff, 0x8f8f8fff, 0xfffeffff, 0x1f1f1fff, 0xfffeffff, 0x3f3f3fff,
+	0xfffeffff, 0xfcfcffff, 0xfffeffff, 0xf8f8ffff, 0xfffeffff, 0xf1f1ffff, 0xfffeffff, 0xe3e3ffff,
+	0xfffeffff, 0xc7c7ffff, 0xfffeffff, 0x8f8fffff, 0xfffeffff, 0x1f1fffff, 0xfffeffff, 0x3f3fffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00060202, 0x00000000,
+	0xfffec7c7, 0xffffffff, 0xfffe8f8f, 0xffffffff, 0xfffe1f1f, 0xffffffff, 0xfffe3f3f, 0xffffffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020202, 0x00000000,
+	0xffc6c7c7, 0xffffffff, 0xff8e8f8f, 0xffffffff, 0xff1e1f1f, 0xffffffff, 0xff3e3f3f, 0xffffffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x00020206, 0x00000000,
+	0xc7c6c7ff, 0xffffffff, 0x8f8e8fff, 0xffffffff, 0x1f1e1fff, 0xffffffff, 0x3f3e3fff, 0xffffffff,
+	0x00000300, 0x00000000, 0x00000300, 0x00000000, 0x00000702, 0x00000000, 0x02020f07, 0x00000000,
+	0xc7c6ffff, 0xffffffc7, 0x8f8effff, 0xffffff8f, 0x1f1effff, 0xffffff1f, 0x3f3effff, 0xffffff3f,
+	0xfcfeffff, 0xfffffcfc, 0xf8feffff, 0xfffff8f8, 0xf1feffff, 0xfffff1f1, 0xe3feffff, 0xffffe3e3,
+	0xc7feffff, 0xffffc7c7, 0x8ffeffff, 0xffff8f8f, 0x1ffeffff, 0xffff1f1f, 0x3ffeffff, 0xffff3f3f,
+	0xfffeffff, 0xfffcfcfc, 0xfffeffff, 0xfff8f8f8, 0xfffeffff, 0xfff1f1f1, 0xfffeffff, 0xffe3e3e3,
+	0xfffeffff, 0xffc7c7c7, 0xfffeffff, 0xff8f8f8f, 0xfffeffff, 0xff1f1f1f, 0xfffeffff, 0xff3f3f3f,
+	0xfffeffff, 0xfcfcfcff, 0xfffeffff, 0xf8f8f8ff, 0xfffeffff, 0xf1f1f1ff, 0xfffeffff, 0xe3e3e3ff,
+	0xfffeffff, 0xc7c7c7ff, 0xfffeffff, 0x8f8f8fff, 0xfffeffff, 0x1f1f1fff, 0xfffeffff, 0x3f3f3fff,
+	0xfffeffff, 0xfcfcffff, 0xfffeffff, 0xf8f8ffff, 0xfffeffff, 0xf1f1ffff, 0xfffeffff, 0xe3e3ffff,
+	0xfffeffff, 0xc7c7ffff, 0xfffeffff, 0x8f8fffff, 0xfffeffff, 0x1f1fffff, 0xfffeffff, 0x3f3fffff,
+	0x0f080c04, 0x00000000, 0x00050000, 0x00000000, 0x0f090101, 0x00000000, 0x1f1d0303, 0x0000001f,
+	0xfffdc7c7, 0xffffffff, 0xfffd8f8f, 0xffffffff, 0xfffd1f1f, 0xffffffff, 0xfffd3f3f, 0xffffffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1f010303, 0x0000001f,
+	0xffc5c7c7, 0xffffffff, 0xff8d8f8f, 0xffffffff, 0xff1d1f1f, 0xffffffff, 0xff3d3f3f, 0xffffffff,
+	0x0c0c0c0f, 0x00000000, 0x00000000, 0x00000000, 0x01010107, 0x00000000, 0x0301030f, 0x00000007,
+	0xc7c5c7ff, 0xffffffff, 0x8f8d8fff, 0xffffffff, 0x1f1d1fff, 0xffffffff, 0x3f3d3fff, 0xffffffff,
+	0xfcfcffff, 0xfffffffc, 0xf8f8ffff, 0xfffffff8, 0xf1f1ffff, 0xfffffff1, 0xe3e1ffff, 0xffffffe3,
+	0xc7c5ffff, 0xffffffc7, 0x8f8dffff, 0xffffff8f, 0x1f1dffff, 0xffffff1f, 0x3f3dffff, 0xffffff3f,
+	0xfcfdffff, 0xfffffcfc, 0xf8fdffff, 0xfffff8f8, 0xf1fdffff, 0xfffff1f1, 0xe3fdffff, 0xffffe3e3,
+	0xc7fdffff, 0xffffc7c7, 0x8ffdffff, 0xffff8f8f, 0x1ffdffff, 0xffff1f1f, 0x3ffdffff, 0xffff3f3f,
+	0xfffdffff, 0xfffcfcfc, 0xfffdffff, 0xfff8f8f8, 0xfffdffff, 0xfff1f1f1, 0xfffdffff, 0xffe3e3e3,
+	0xfffdffff, 0xffc7c7c7, 0xfffdffff, 0xff8f8f8f, 0xfffdffff, 0xff1f1f1f, 0xfffdffff, 0xff3f3f3f,
+	0xfffdffff, 0xfcfcfcff, 0xfffdffff, 0xf8f8f8ff, 0xfffdffff, 0xf1f1f1ff, 0xfffdffff, 0xe3e3e3ff,
+	0xfffdffff, 0xc7c7c7ff, 0xfffdffff, 0x8f8f8fff, 0xfffdffff, 0x1f1f1fff, 0xfffdffff, 0x3f3f3fff,
+	0xfffdffff, 0xfcfcffff, 0xfffdffff, 0xf8f8ffff, 0xfffdffff, 0xf1f1ffff, 0xfffdffff, 0xe3e3ffff,
+	0xfffdffff, 0xc7c7ffff, 0xfffdffff, 0x8f8fffff, 0xfffdffff, 0x1f1fffff, 0xfffdffff, 0x3f3fffff,
+	0x00050000, 0x00000000, 0x00000000, 0x00000000, 0x00050101, 0x00000000, 0x0f090303, 0x00000000,
+	0x1f1d0707, 0x0000001f, 0xfffd8f8f, 0xffffffff, 0xfffd1f1f, 0xffffffff, 0xfffd3f3f, 0xffffffff,
+	0x00000400, 0x00000000, 0x00000000, 0x00000000, 0x00010100, 0x00000000, 0x0f010303, 0x00000000,
+	0x1f050707, 0x00000007, 0xff8d8f8f, 0xffffffff, 0xff1d1f1f, 0xffffffff, 0xff3d3f3f, 0xffffffff,
+	0x00040400, 0x00000000, 0x00000000, 0x00000000, 0x00010100, 0x00000000, 0x03010307, 0x00000000,
+	0x0705070f, 0x00000007, 0x8f8d8fff, 0xffffffff, 0x1f1d1fff, 0xffffffff, 0x3f3d3fff, 0xffffffff,
+	0x04040700, 0x00000000, 0x00000700, 0x00000000, 0x01010700, 0x00000000, 0x03010f07, 0x00000000,
+	0x07051f0f, 0x00000007, 0x8f8dffff, 0xffffff8f, 0x1f1dffff, 0xffffff1f, 0x3f3dffff, 0xffffff3f,
+	0xfcfdffff, 0xfffffcfc, 0xf8fdffff, 0xfffff8f8, 0xf1fdffff, 0xfffff1f1, 0xe3fdffff, 0xffffe3e3,
+	0xc7fdffff, 0xffffc7c7, 0x8ffdffff, 0xffff8f8f, 0x1ffdffff, 0xffff1f1f, 0x3ffdffff, 0xffff3f3f,
+	0xfffdffff, 0xfffcfcfc, 0xfffdffff, 0xfff8f8f8, 0xfffdffff, 0xfff1f1f1, 0xfffdffff, 0xffe3e3e3,
+	0xfffdffff, 0xffc7c7c7, 0xfffdffff, 0xff8f8f8f, 0xfffdffff, 0xff1f1f1f, 0xfffdffff, 0xff3f3f3f,
+	0xfffdffff, 0xfcfcfcff, 0xfffdffff, 0xf8f8f8ff, 0xfffdffff, 0xf1f1f1ff, 0xfffdffff, 0xe3e3e3ff,
+	0xfffdffff, 0xc7c7c7ff, 0xfffdffff, 0x8f8f8fff, 0xfffdffff, 0x1f1f1fff, 0xfffdffff, 0x3f3f3fff,
+	0xfffdffff, 0xfcfcffff, 0xfffdffff, 0xf8f8ffff, 0xfffdffff, 0xf1f1ffff, 0xfffdffff, 0xe3e3ffff,
+	0xfffdffff, 0xc7c7ffff, 0xfffdffff, 0x8f8fffff, 0xfffdffff, 0x1f1fffff, 0xfffdffff, 0x3f3fffff,
+	0x3f3b3c3c, 0x0000003f, 0x1f191818, 0x00000000, 0x000a0000, 0x00000000, 0x1f130303, 0x00000000,
+	0x3f3b0707, 0x0000003f, 0xfffb8f8f, 0xffffffff, 0xfffb1f1f, 0xffffffff, 0xfffb3f3f, 0xffffffff,
+	0x3f383c3c, 0x0000003f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x3f030707, 0x0000003f, 0xff8b8f8f, 0xffffffff, 0xff1b1f1f, 0xffffffff, 0xff3b3f3f, 0xffffffff,
+	0x3c383c3f, 0x0000003e, 0x1818181e, 0x00000000, 0x00000000, 0x00000000, 0x0303030f, 0x00000000,
+	0x0703071f, 0x0000000f, 0x8f8b8fff, 0xffffffff, 0x1f1b1fff, 0xffffffff, 0x3f3b3fff, 0xffffffff,
+	0xfcf8ffff, 0xfffffffc, 0xf8f8ffff, 0xfffffff8, 0xf1f1ffff, 0xfffffff1, 0xe3e3ffff, 0xffffffe3,
+	0xc7c3ffff, 0xffffffc7, 0x8f8bffff, 0xffffff8f, 0x1f1bffff, 0xffffff1f, 0x3f3bffff, 0xffffff3f,
+	0xfcfbffff, 0xfffffcfc, 0xf8fbffff, 0xfffff8f8, 0xf1fbffff, 0xfffff1f1, 0xe3fbffff, 0xffffe3e3,
+	0xc7fbffff, 0xffffc7c7, 0x8ffbffff, 0xffff8f8f, 0x1ffbffff, 0xffff1f1f, 0x3ffbffff, 0xffff3f3f,
+	0xfffbffff, 0xfffcfcfc, 0xfffbffff, 0xfff8f8f8, 0xfffbffff, 0xfff1f1f1, 0xfffbffff, 0xffe3e3e3,
+	0xfffbffff, 0xffc7c7c7, 0xfffbffff, 0xff8f8f8f, 0xfffbffff, 0xff1f1f1f, 0xfffbffff, 0xff3f3f3f,
+	0xfffbffff, 0xfcfcfcff, 0xfffbffff, 0xf8f8f8ff, 0xfffbffff, 0xf1f1f1ff, 0xfffbffff, 0xe3e3e3ff,
+	0xfffbffff, 0xc7c7c7ff, 0xfffbffff, 0x8f8f8fff, 0xfffbffff, 0x1f1f1fff, 0xfffbffff, 0x3f3f3fff,
+	0xfffbffff, 0xfcfcffff, 0xfffbffff, 0xf8f8ffff, 0xfffbffff, 0xf1f1ffff, 0xfffbffff, 0xe3e3ffff,
+	0xfffbffff, 0xc7c7ffff, 0xfffbffff, 0x8f8fffff, 0xfffbffff, 0x1f1fffff, 0xfffbffff, 0x3f3fffff,
+	0x1f191c1c, 0x00000000, 0x000a0808, 0x00000000, 0x00000000, 0x00000000, 0x000a0202, 0x00000000,
+	0x1f130707, 0x00000000, 0x3f3b0f0f, 0x0000003f, 0xfffb1f1f, 0xffffffff, 0xfffb3f3f, 0xffffffff,
+	0x1f181c1c, 0x00000000, 0x00080800, 0x00000000, 0x00000000, 0x00000000, 0x00020200, 0x00000000,
+	0x1f030707, 0x00000000, 0x3f0b0f0f, 0x0000000f, 0xff1b1f1f, 0xffffffff, 0xff3b3f3f, 0xffffffff,
+	0x1c181c1e, 0x00000000, 0x00080800, 0x00000000, 0x00000000, 0x00000000, 0x00020200, 0x00000000,
+	0x0703070f, 0x00000000, 0x0f0b0f1f, 0x0000000f, 0x1f1b1fff, 0xffffffff, 0x3f3b3fff, 0xffffffff,
+	0x1c181f1e, 0x00000000, 0x08080e00, 0x00000000, 0x00000e00, 0x00000000, 0x02020e00, 0x00000000,
+	0x07031f0f, 0x00000000, 0x0f0b3f1f, 0x0000000f, 0x1f1bffff, 0xffffff1f, 0x3f3bffff, 0xffffff3f,
+	0xfcfbffff, 0xfffffcfc, 0xf8fbffff, 0xfffff8f8, 0xf1fbffff, 0xfffff1f1, 0xe3fbffff, 0xffffe3e3,
+	0xc7fbffff, 0xffffc7c7, 0x8ffbffff, 0xffff8f8f, 0x1ffbffff, 0xffff1f1f, 0x3ffbffff, 0xffff3f3f,
+	0xfffbffff, 0xfffcfcfc, 0xfffbffff, 0xfff8f8f8, 0xfffbffff, 0xfff1f1f1, 0xfffbffff, 0xffe3e3e3,
+	0xfffbffff, 0xffc7c7c7, 0xfffbffff, 0xff8f8f8f, 0xfffbffff, 0xff1f1f1f, 0xfffbffff, 0xff3f3f3f,
+	0xfffbffff, 0xfcfcfcff, 0xfffbffff, 0xf8f8f8ff, 0xfffbffff, 0xf1f1f1ff, 0xfffbffff, 0xe3e3e3ff,
+	0xfffbffff, 0xc7c7c7ff, 0xfffbffff, 0x8f8f8fff, 0xfffbffff, 0x1f1f1fff, 0xfffbffff, 0x3f3f3fff,
+	0xfffbffff, 0xfcfcffff, 0xfffbffff, 0xf8f8ffff, 0xfffbffff, 0xf1f1ffff, 0xfffbffff, 0xe3e3ffff,
+	0xfffbffff, 0xc7c7ffff, 0xfffbffff, 0x8f8fffff, 0xfffbffff, 0x1f1fffff, 0xfffbffff, 0x3f3fffff,
+	0xfff7fcfc, 0xffffffff, 0x7f777878, 0x0000007f, 0x3e323030, 0x00000000, 0x00140000, 0x00000000,
+	0x3e260606, 0x00000000, 0x7f770f0f, 0x0000007f, 0xfff71f1f, 0xffffffff, 0xfff73f3f, 0xffffffff,
+	0xfff4fcfc, 0xffffffff, 0x7f707878, 0x0000007f, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x7f070f0f, 0x0000007f, 0xff171f1f, 0xffffffff, 0xff373f3f, 0xffffffff,
+	0xfcf4fcff, 0xffffffff, 0x7870787e, 0x0000007c, 0x3030303c, 0x00000000, 0x00000000, 0x00000000,
+	0x0606061e, 0x00000000, 0x0f070f3f, 0x0000001f, 0x1f171fff, 0xffffffff, 0x3f373fff, 0xffffffff,
+	0xfcf4ffff, 0xfffffffc, 0xf8f0ffff, 0xfffffff8, 0xf1f1ffff, 0xfffffff1, 0xe3e3ffff, 0xffffffe3,
+	0xc7c7ffff, 0xffffffc7, 0x8f87ffff, 0xffffff8f, 0x1f17ffff, 0xffffff1f, 0x3f37ffff, 0xffffff3f,
+	0xfcf7ffff, 0xfffffcfc, 0xf8f7ffff, 0xfffff8f8, 0xf1f7ffff, 0xfffff1f1, 0xe3f7ffff, 0xffffe3e3,
+	0xc7f7ffff, 0xffffc7c7, 0x8ff7ffff, 0xffff8f8f, 0x1ff7ffff, 0xffff1f1f, 0x3ff7ffff, 0xffff3f3f,
+	0xfff7ffff, 0xfffcfcfc, 0xfff7ffff, 0xfff8f8f8, 0xfff7ffff, 0xfff1f1f1, 0xfff7ffff, 0xffe3e3e3,
+	0xfff7ffff, 0xffc7c7c7, 0xfff7ffff, 0xff8f8f8f, 0xfff7ffff, 0xff1f1f1f, 0xfff7ffff, 0xff3f3f3f,
+	0xfff7ffff, 0xfcfcfcff, 0xfff7ffff, 0xf8f8f8ff, 0xfff7ffff, 0xf1f1f1ff, 0xfff7ffff, 0xe3e3e3ff,
+	0xfff7ffff, 0xc7c7c7ff, 0xfff7ffff, 0x8f8f8fff, 0xfff7ffff, 0x1f1f1fff, 0xfff7ffff, 0x3f3f3fff,
+	0xfff7ffff, 0xfcfcffff, 0xfff7ffff, 0xf8f8ffff, 0xfff7ffff, 0xf1f1ffff, 0xfff7ffff, 0xe3e3ffff,
+	0xfff7ffff, 0xc7c7ffff, 0xfff7ffff, 0x8f8fffff, 0xfff7ffff, 0x1f1fffff, 0xfff7ffff, 0x3f3fffff,
+	0x7f777c7c, 0x0000007f, 0x3e323838, 0x00000000, 0x00141010, 0x00000000, 0x00000000, 0x00000000,
+	0x00140404, 0x00000000, 0x3e260e0e, 0x00000000, 0x7f771f1f, 0x0000007f, 0xfff73f3f, 0xffffffff,
+	0x7f747c7c, 0x0000007c, 0x3e303838, 0x00000000, 0x00101000, 0x00000000, 0x00000000, 0x00000000,
+	0x00040400, 0x00000000, 0x3e060e0e, 0x00000000, 0x7f171f1f, 0x0000001f, 0xff373f3f, 0xffffffff,
+	0x7c747c7e, 0x0000007c, 0x3830383c, 0x00000000, 0x00101000, 0x00000000, 0x00000000, 0x00000000,
+	0x00040400, 0x00000000, 0x0e060e1e, 0x00000000, 0x1f171f3f, 0x0000001f, 0x3f373fff, 0xffffffff,
+	0x7c747f7e, 0x0000007c, 0x38303e3c, 0x00000000, 0x10101c00, 0x00000000, 0x00001c00, 0x00000000,
+	0x04041c00, 0x00000000, 0x0e063e1e, 0x00000000, 0x1f177f3f, 0x0000001f, 0x3f37ffff, 0xffffff3f,
+	0xfcf7ffff, 0xfffffcfc, 0xf8f7ffff, 0xfffff8f8, 0xf1f7ffff, 0xfffff1f1, 0xe3f7ffff, 0xffffe3e3,
+	0xc7f7ffff, 0xffffc7c7, 0x8ff7ffff, 0xffff8f8f, 0x1ff7ffff, 0xffff1f1f, 0x3ff7ffff, 0xffff3f3f,
+	0xfff7ffff, 0xfffcfcfc, 0xfff7ffff, 0xfff8f8f8, 0xfff7ffff, 0xfff1f1f1, 0xfff7ffff, 0xffe3e3e3,
+	0xfff7ffff, 0xffc7c7c7, 0xfff7ffff, 0xff8f8f8f, 0xfff7ffff, 0xff1f1f1f, 0xfff7ffff, 0xff3f3f3f,
+	0xfff7ffff, 0xfcfcfcff, 0xfff7ffff, 0xf8f8f8ff, 0xfff7ffff, 0xf1f1f1ff, 0xfff7ffff, 0xe3e3e3ff,
+	0xfff7ffff, 0xc7c7c7ff, 0xfff7ffff, 0x8f8f8fff, 0xfff7ffff, 0x1f1f1fff, 0xfff7ffff, 0x3f3f3fff,
+	0xfff7ffff, 0xfcfcffff, 0xfff7ffff, 0xf8f8ffff, 0xfff7ffff, 0xf1f1ffff, 0xfff7ffff, 0xe3e3ffff,
+	0xfff7ffff, 0xc7c7ffff, 0xfff7ffff, 0x8f8fffff, 0xfff7ffff, 0x1f1fffff, 0xfff7ffff, 0x3f3fffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00070303, 0x00000000,
+	0xfeffc7c7, 0xffffffff, 0xfeff8f8f, 0xffffffff, 0xfeff1f1f, 0xffffffff, 0xfeff3f3f, 0xffffffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00030303, 0x00000000,
+	0xfec7c7c7, 0xffffffff, 0xfe8f8f8f, 0xffffffff, 0xfe1f1f1f, 0xffffffff, 0xfe3f3f3f, 0xffffffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x00000000, 0x02030307, 0x00000000,
+	0xc6c7c7ff, 0xffffffff, 0x8e8f8fff, 0xffffffff, 0x1e1f1fff, 0xffffffff, 0x3e3f3fff, 0xffffffff,
+	0x00000000, 0x00000000, 0x00000300, 0x00000000, 0x00010707, 0x00000000, 0x02030f0f, 0x00000003,
+	0xc6c7ffff, 0xffffffc7, 0x8e8fffff, 0xffffff8f, 0x1e1fffff, 0xffffff1f, 0x3e3fffff, 0xffffff3f,
+	0xfcffffff, 0xfffffcfc, 0xf8ffffff, 0xfffff8f8, 0xf0ffffff, 0xfffff1f1, 0xe2ffffff, 0xffffe3e3,
+	0xc6ffffff, 0xffffc7c7, 0x8effffff, 0xffff8f8f, 0x1effffff, 0xffff1f1f, 0x3effffff, 0xffff3f3f,
+	0xfeffffff, 0xfffcfcfc, 0xfeffffff, 0xfff8f8f8, 0xfeffffff, 0xfff1f1f1, 0xfeffffff, 0xffe3e3e3,
+	0xfeffffff, 0xffc7c7c7, 0xfeffffff, 0xff8f8f8f, 0xfeffffff, 0xff1f1f1f, 0xfeffffff, 0xff3f3f3f,
+	0xfeffffff, 0xfcfcfcff, 0xfeffffff, 0xf8f8f8ff, 0xfeffffff, 0xf1f1f1ff, 0xfeffffff, 0xe3e3e3ff,
+	0xfeffffff, 0xc7c7c7ff, 0xfeffffff, 0x8f8f8fff, 0xfeffffff, 0x1f1f1fff, 0xfeffffff, 0x3f3f3fff,
+	0xfeffffff, 0xfcfcffff, 0xfeffffff, 0xf8f8ffff, 0xfeffffff, 0xf1f1ffff, 0xfeffffff, 0xe3e3ffff,
+	0xfeffffff, 0xc7c7ffff, 0xfeffffff, 0x8f8fffff, 0xfeffffff, 0x1f1fffff, 0xfeffffff, 0x3f3fffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000202, 0x00000000,
+	0x00070707, 0x00000000, 0xfeff8f8f, 0xffffffff, 0xfeff1f1f, 0xffffffff, 0xfeff3f3f, 0xffffffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000202, 0x00000000,
+	0x00070707, 0x00000000, 0xfe8f8f8f, 0xffffffff, 0xfe1f1f1f, 0xffffffff, 0xfe3f3f3f, 0xffffffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020202, 0x00000000,
+	0x00070707, 0x00000000, 0x8e8f8fff, 0xffffffff, 0x1e1f1fff, 0xffffffff, 0x3e3f3fff, 0xffffffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000200, 0x00000000, 0x02020602, 0x00000000,
+	0x06070f07, 0x00000000, 0x8e8fffff, 0xffffff8f, 0x1e1fffff, 0xffffff1f, 0x3e3fffff, 0xffffff3f,
+	0x00030000, 0x00000000, 0x00030000, 0x00000000, 0x00070300, 0x00000000, 0x020f0707, 0x00000002,
+	0x061f0f0f, 0x00000007, 0x8effffff, 0xffff8f8f, 0x1effffff, 0xffff1f1f, 0x3effffff, 0xffff3f3f,
+	0xfeffffff, 0xfffcfcfc, 0xfeffffff, 0xfff8f8f8, 0xfeffffff, 0xfff1f1f1, 0xfeffffff, 0xffe3e3e3,
+	0xfeffffff, 0xffc7c7c7, 0xfeffffff, 0xff8f8f8f, 0xfeffffff, 0xff1f1f1f, 0xfeffffff, 0xff3f3f3f,
+	0xfeffffff, 0xfcfcfcff, 0xfeffffff, 0xf8f8f8ff, 0xfeffffff, 0xf1f1f1ff, 0xfeffffff, 0xe3e3e3ff,
+	0xfeffffff, 0xc7c7c7ff, 0xfeffffff, 0x8f8f8fff, 0xfeffffff, 0x1f1f1fff, 0xfeffffff, 0x3f3f3fff,
+	0xfeffffff, 0xfcfcffff, 0xfeffffff, 0xf8f8ffff, 0xfeffffff, 0xf1f1ffff, 0xfeffffff, 0xe3e3ffff,
+	0xfeffffff, 0xc7c7ffff, 0xfeffffff, 0x8f8fffff, 0xfeffffff, 0x1f1fffff, 0xfeffffff, 0x3f3fffff,
+	0x0d0f0c0c, 0x00000000, 0x0d0f0800, 0x00000000, 0x0d0f0101, 0x00000000, 0x1d1f0303, 0x00000003,
+	0x3d3f0707, 0x0000071f, 0xfdff8f8f, 0xffffffff, 0xfdff1f1f, 0xffffffff, 0xfdff3f3f, 0xffffffff,
+	0x0c0c0c0c, 0x00000000, 0x00000000, 0x00000000, 0x01010101, 0x00000000, 0x0d030303, 0x00000003,
+	0x1d070707, 0x0000071f, 0xfd8f8f8f, 0xffffffff, 0xfd1f1f1f, 0xffffffff, 0xfd3f3f3f, 0xffffffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01030307, 0x00000003,
+	0x0507070f, 0x0000070f, 0x8d8f8fff, 0xffffffff, 0x1d1f1fff, 0xffffffff, 0x3d3f3fff, 0xffffffff,
+	0x0c0c0f00, 0x0000000c, 0x00000000, 0x00000000, 0x01010700, 0x00000001, 0x01030f0f, 0x00000703,
+	0x05071f1f, 0x00000707, 0x8d8fffff, 0xffffff8f, 0x1d1fffff, 0xffffff1f, 0x3d3fffff, 0xffffff3f,
+	0xfcffffff, 0xfffffcfc, 0xf8ffffff, 0xfffff8f8, 0xf1ffffff, 0xfffff1f1, 0xe1ffffff, 0xffffe3e3,
+	0xc5ffffff, 0xffffc7c7, 0x8dffffff, 0xffff8f8f, 0x1dffffff, 0xffff1f1f, 0x3dffffff, 0xffff3f3f,
+	0xfdffffff, 0xfffcfcfc, 0xfdffffff, 0xfff8f8f8, 0xfdffffff, 0xfff1f1f1, 0xfdffffff, 0xffe3e3e3,
+	0xfdffffff, 0xffc7c7c7, 0xfdffffff, 0xff8f8f8f, 0xfdffffff, 0xff1f1f1f, 0xfdffffff, 0xff3f3f3f,
+	0xfdffffff, 0xfcfcfcff, 0xfdffffff, 0xf8f8f8ff, 0xfdffffff, 0xf1f1f1ff, 0xfdffffff, 0xe3e3e3ff,
+	0xfdffffff, 0xc7c7c7ff, 0xfdffffff, 0x8f8f8fff, 0xfdffffff, 0x1f1f1fff, 0xfdffffff, 0x3f3f3fff,
+	0xfdffffff, 0xfcfcffff, 0xfdffffff, 0xf8f8ffff, 0xfdffffff, 0xf1f1ffff, 0xfdffffff, 0xe3e3ffff,
+	0xfdffffff, 0xc7c7ffff, 0xfdffffff, 0x8f8fffff, 0xfdffffff, 0x1f1fffff, 0xfdffffff, 0x3f3fffff,
+	0x00070404, 0x00000000, 0x00070000, 0x00000000, 0x00070101, 0x00000000, 0x010f0303, 0x00000000,
+	0x0d1f0707, 0x00000003, 0x1d3f0f0f, 0x0000071f, 0xfdff1f1f, 0xffffffff, 0xfdff3f3f, 0xffffffff,
+	0x00040400, 0x00000000, 0x00000000, 0x00000000, 0x00010100, 0x00000000, 0x01030303, 0x00000000,
+	0x0d070707, 0x00000003, 0x1d0f0f0f, 0x0000070f, 0xfd1f1f1f, 0xffffffff, 0xfd3f3f3f, 0xffffffff,
+	0x00040000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x01030300, 0x00000000,
+	0x05070707, 0x00000003, 0x0d0f0f0f, 0x0000070f, 0x1d1f1fff, 0xffffffff, 0x3d3f3fff, 0xffffffff,
+	0x04040000, 0x00000000, 0x00000000, 0x00000000, 0x01010000, 0x00000000, 0x01030700, 0x00000003,
+	0x05070f07, 0x00000003, 0x0d0f1f0f, 0x0000070f, 0x1d1fffff, 0xffffff1f, 0x3d3fffff, 0xffffff3f,
+	0x04070000, 0x00000004, 0x00070000, 0x00000000, 0x01070000, 0x00000001, 0x010f0700, 0x00000003,
+	0x051f0f0f, 0x00000707, 0x0d3f1f1f, 0x0000070f, 0x1dffffff, 0xffff1f1f, 0x3dffffff, 0xffff3f3f,
+	0xfdffffff, 0xfffcfcfc, 0xfdffffff, 0xfff8f8f8, 0xfdffffff, 0xfff1f1f1, 0xfdffffff, 0xffe3e3e3,
+	0xfdffffff, 0xffc7c7c7, 0xfdffffff, 0xff8f8f8f, 0xfdffffff, 0xff1f1f1f, 0xfdffffff, 0xff3f3f3f,
+	0xfdffffff, 0xfcfcfcff, 0xfdffffff, 0xf8f8f8ff, 0xfdffffff, 0xf1f1f1ff, 0xfdffffff, 0xe3e3e3ff,
+	0xfdffffff, 0xc7c7c7ff, 0xfdffffff, 0x8f8f8fff, 0xfdffffff, 0x1f1f1fff, 0xfdffffff, 0x3f3f3fff,
+	0xfdffffff, 0xfcfcffff, 0xfdffffff, 0xf8f8ffff, 0xfdffffff, 0xf1f1ffff, 0xfdffffff, 0xe3e3ffff,
+	0xfdffffff, 0xc7c7ffff, 0xfdffffff, 0x8f8fffff, 0xfdffffff, 0x1f1fffff, 0xfdffffff, 0x3f3fffff,
+	0x3b3f3c3c, 0x0000003c, 0x1b1f1818, 0x00000000, 0x1b1f1100, 0x00000000, 0x1b1f0303, 0x00000000,
+	0x3b3f0707, 0x00000007, 0x7b7f0f0f, 0x00000f3f, 0xfbff1f1f, 0xffffffff, 0xfbff3f3f, 0xffffffff,
+	0x3b3c3c3c, 0x0000003c, 0x18181818, 0x00000000, 0x00000000, 0x00000000, 0x03030303, 0x00000000,
+	0x1b070707, 0x00000007, 0x3b0f0f0f, 0x00000f3f, 0xfb1f1f1f, 0xffffffff, 0xfb3f3f3f, 0xffffffff,
+	0x383c3c3e, 0x0000003c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0307070f, 0x00000007, 0x0b0f0f1f, 0x00000f1f, 0x1b1f1fff, 0xffffffff, 0x3b3f3fff, 0xffffffff,
+	0x383c3f3f, 0x00003e3c, 0x18181e00, 0x00000018, 0x00000000, 0x00000000, 0x03030f00, 0x00000003,
+	0x03071f1f, 0x00000f07, 0x0b0f3f3f, 0x00000f0f, 0x1b1fffff, 0xffffff1f, 0x3b3fffff, 0xffffff3f,
+	0xf8ffffff, 0xfffffcfc, 0xf8ffffff, 0xfffff8f8, 0xf1ffffff, 0xfffff1f1, 0xe3ffffff, 0xffffe3e3,
+	0xc3ffffff, 0xffffc7c7, 0x8bffffff, 0xffff8f8f, 0x1bffffff, 0xffff1f1f, 0x3bffffff, 0xffff3f3f,
+	0xfbffffff, 0xfffcfcfc, 0xfbffffff, 0xfff8f8f8, 0xfbffffff, 0xfff1f1f1, 0xfbffffff, 0xffe3e3e3,
+	0xfbffffff, 0xffc7c7c7, 0xfbffffff, 0xff8f8f8f, 0xfbffffff, 0xff1f1f1f, 0xfbffffff, 0xff3f3f3f,
+	0xfbffffff, 0xfcfcfcff, 0xfbffffff, 0xf8f8f8ff, 0xfbffffff, 0xf1f1f1ff, 0xfbffffff, 0xe3e3e3ff,
+	0xfbffffff, 0xc7c7c7ff, 0xfbffffff, 0x8f8f8fff, 0xfbffffff, 0x1f1f1fff, 0xfbffffff, 0x3f3f3fff,
+	0xfbffffff, 0xfcfcffff, 0xfbffffff, 0xf8f8ffff, 0xfbffffff, 0xf1f1ffff, 0xfbffffff, 0xe3e3ffff,
+	0xfbffffff, 0xc7c7ffff, 0xfbffffff, 0x8f8fffff, 0xfbffffff, 0x1f1fffff, 0xfbffffff, 0x3f3fffff,
+	0x181f1c1c, 0x00000000, 0x000e0808, 0x00000000, 0x000e0000, 0x00000000, 0x000e0202, 0x00000000,
+	0x031f0707, 0x00000000, 0x1b3f0f0f, 0x00000007, 0x3b7f1f1f, 0x00000f3f, 0xfbff3f3f, 0xffffffff,
+	0x181c1c1c, 0x00000000, 0x00080800, 0x00000000, 0x00000000, 0x00000000, 0x00020200, 0x00000000,
+	0x03070707, 0x00000000, 0x1b0f0f0f, 0x00000007, 0x3b1f1f1f, 0x00000f1f, 0xfb3f3f3f, 0xffffffff,
+	0x181c1c00, 0x00000000, 0x00080000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000,
+	0x03070700, 0x00000000, 0x0b0f0f0f, 0x00000007, 0x1b1f1f1f, 0x00000f1f, 0x3b3f3fff, 0xffffffff,
+	0x181c1e00, 0x0000001c, 0x08080000, 0x00000000, 0x00000000, 0x00000000, 0x02020000, 0x00000000,
+	0x03070f00, 0x00000007, 0x0b0f1f0f, 0x00000007, 0x1b1f3f1f, 0x00000f1f, 0x3b3fffff, 0xffffff3f,
+	0x181f1e00, 0x0000001c, 0x080e0000, 0x00000008, 0x000e0000, 0x00000000, 0x020e0000, 0x00000002,
+	0x031f0f00, 0x00000007, 0x0b3f1f1f, 0x00000f0f, 0x1b7f3f3f, 0x00000f1f, 0x3bffffff, 0xffff3f3f,
+	0xfbffffff, 0xfffcfcfc, 0xfbffffff, 0xfff8f8f8, 0xfbffffff, 0xfff1f1f1, 0xfbffffff, 0xffe3e3e3,
+	0xfbffffff, 0xffc7c7c7, 0xfbffffff, 0xff8f8f8f, 0xfbffffff, 0xff1f1f1f, 0xfbffffff, 0xff3f3f3f,
+	0xfbffffff, 0xfcfcfcff, 0xfbffffff, 0xf8f8f8ff, 0xfbffffff, 0xf1f1f1ff, 0xfbffffff, 0xe3e3e3ff,
+	0xfbffffff, 0xc7c7c7ff, 0xfbffffff, 0x8f8f8fff, 0xfbffffff, 0x1f1f1fff, 0xfbffffff, 0x3f3f3fff,
+	0xfbffffff, 0xfcfcffff, 0xfbffffff, 0xf8f8ffff, 0xfbffffff, 0xf1f1ffff, 0xfbffffff, 0xe3e3ffff,
+	0xfbffffff, 0xc7c7ffff, 0xfbffffff, 0x8f8fffff, 0xfbffffff, 0x1f1fffff, 0xfbffffff, 0x3f3fffff,
+	0xf7fffcfc, 0x0000fcff, 0x777f7878, 0x00000078, 0x363e3030, 0x00000000, 0x363e2200, 0x00000000,
+	0x363e0606, 0x00000000, 0x777f0f0f, 0x0000000f, 0xf7ff1f1f, 0x00001f7f, 0xf7ff3f3f, 0xffffffff,
+	0xf7fcfcfc, 0x0000fcff, 0x76787878, 0x00000078, 0x30303030, 0x00000000, 0x00000000, 0x00000000,
+	0x06060606, 0x00000000, 0x370f0f0f, 0x0000000f, 0x771f1f1f, 0x00001f7f, 0xf73f3f3f, 0xffffffff,
+	0xf4fcfcfe, 0x0000fcfe, 0x7078787c, 0x00000078, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x070f0f1f, 0x0000000f, 0x171f1f3f, 0x00001f3f, 0x373f3fff, 0xffffffff,
+	0xf4fcffff, 0x0000fcfc, 0x70787e7e, 0x00007c78, 0x30303c00, 0x00000030, 0x00000000, 0x00000000,
+	0x06061e00, 0x00000006, 0x070f3f3f, 0x00001f0f, 0x171f7f7f, 0x00001f1f, 0x373fffff, 0xffffff3f,
+	0xf4ffffff, 0xfffffcfc, 0xf0ffffff, 0xfffff8f8, 0xf1ffffff, 0xfffff1f1, 0xe3ffffff, 0xffffe3e3,
+	0xc7ffffff, 0xffffc7c7, 0x87ffffff, 0xffff8f8f, 0x17ffffff, 0xffff1f1f, 0x37ffffff, 0xffff3f3f,
+	0xf7ffffff, 0xfffcfcfc, 0xf7ffffff, 0xfff8f8f8, 0xf7ffffff, 0xfff1f1f1, 0xf7ffffff, 0xffe3e3e3,
+	0xf7ffffff, 0xffc7c7c7, 0xf7ffffff, 0xff8f8f8f, 0xf7ffffff, 0xff1f1f1f, 0xf7ffffff, 0xff3f3f3f,
+	0xf7ffffff, 0xfcfcfcff, 0xf7ffffff, 0xf8f8f8ff, 0xf7ffffff, 0xf1f1f1ff, 0xf7ffffff, 0xe3e3e3ff,
+	0xf7ffffff, 0xc7c7c7ff, 0xf7ffffff, 0x8f8f8fff, 0xf7ffffff, 0x1f1f1fff, 0xf7ffffff, 0x3f3f3fff,
+	0xf7ffffff, 0xfcfcffff, 0xf7ffffff, 0xf8f8ffff, 0xf7ffffff, 0xf1f1ffff, 0xf7ffffff, 0xe3e3ffff,
+	0xf7ffffff, 0xc7c7ffff, 0xf7ffffff, 0x8f8fffff, 0xf7ffffff, 0x1f1fffff, 0xf7ffffff, 0x3f3fffff,
+	0x767f7c7c, 0x00000078, 0x303e3838, 0x00000000, 0x001c1010, 0x00000000, 0x001c0000, 0x00000000,
+	0x001c0404, 0x00000000, 0x063e0e0e, 0x00000000, 0x377f1f1f, 0x0000000f, 0x77ff3f3f, 0x00001f7f,
+	0x767c7c7c, 0x00000078, 0x30383838, 0x00000000, 0x00101000, 0x00000000, 0x00000000, 0x00000000,
+	0x00040400, 0x00000000, 0x060e0e0e, 0x00000000, 0x371f1f1f, 0x0000000f, 0x773f3f3f, 0x00001f3f,
+	0x747c7c7c, 0x00000078, 0x30383800, 0x00000000, 0x00100000, 0x00000000, 0x00000000, 0x00000000,
+	0x00040000, 0x00000000, 0x060e0e00, 0x00000000, 0x171f1f1f, 0x0000000f, 0x373f3f3f, 0x00001f3f,
+	0x747c7e7c, 0x00000078, 0x30383c00, 0x00000038, 0x10100000, 0x00000000, 0x00000000, 0x00000000,
+	0x04040000, 0x00000000, 0x060e1e00, 0x0000000e, 0x171f3f1f, 0x0000000f, 0x373f7f3f, 0x00001f3f,
+	0x747f7e7e, 0x00007c7c, 0x303e3c00, 0x00000038, 0x101c0000, 0x00000010, 0x001c0000, 0x00000000,
+	0x041c0000, 0x00000004, 0x063e1e00, 0x0000000e, 0x177f3f3f, 0x00001f1f, 0x37ff7f7f, 0x00001f3f,
+	0xf7ffffff, 0xfffcfcfc, 0xf7ffffff, 0xfff8f8f8, 0xf7ffffff, 0xfff1f1f1, 0xf7ffffff, 0xffe3e3e3,
+	0xf7ffffff, 0xffc7c7c7, 0xf7ffffff, 0xff8f8f8f, 0xf7ffffff, 0xff1f1f1f, 0xf7ffffff, 0xff3f3f3f,
+	0xf7ffffff, 0xfcfcfcff, 0xf7ffffff, 0xf8f8f8ff, 0xf7ffffff, 0xf1f1f1ff, 0xf7ffffff, 0xe3e3e3ff,
+	0xf7ffffff, 0xc7c7c7ff, 0xf7ffffff, 0x8f8f8fff, 0xf7ffffff, 0x1f1f1fff, 0xf7ffffff, 0x3f3f3fff,
+	0xf7ffffff, 0xfcfcffff, 0xf7ffffff, 0xf8f8ffff, 0xf7ffffff, 0xf1f1ffff, 0xf7ffffff, 0xe3e3ffff,
+	0xf7ffffff, 0xc7c7ffff, 0xf7ffffff, 0x8f8fffff, 0xf7ffffff, 0x1f1fffff, 0xf7ffffff, 0x3f3fffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00070303, 0x00000000,
+	0x0f0f0707, 0x00000000, 0xffff8f8f, 0xfffffffe, 0xffff1f1f, 0xfffffffe, 0xffff3f3f, 0xfffffffe,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00030303, 0x00000000,
+	0x0f070707, 0x00000000, 0xff8f8f8f, 0xfffffffe, 0xff1f1f1f, 0xfffffffe, 0xff3f3f3f, 0xfffffffe,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03030307, 0x00000000,
+	0x0707070f, 0x00000000, 0x8f8f8fff, 0xfffffffe, 0x1f1f1fff, 0xfffffffe, 0x3f3f3fff, 0xfffffffe,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000200, 0x00000000, 0x03030707, 0x00000002,
+	0x07070f0f, 0x00000006, 0x8f8fffff, 0xffffff8e, 0x1f1fffff, 0xffffff1e, 0x3f3fffff, 0xffffff3e,
+	0x00000000, 0x00000000, 0x00030000, 0x00000000, 0x01070700, 0x00000000, 0x030f0f07, 0x00000302,
+	0x071f1f0f, 0x00000706, 0x8fffffff, 0xffff8f8e, 0x1fffffff, 0xffff1f1e, 0x3fffffff, 0xffff3f3e,
+	0xffffffff, 0xfffcfcfc, 0xffffffff, 0xfff8f8f8, 0xffffffff, 0xfff1f1f0, 0xffffffff, 0xffe3e3e2,
+	0xffffffff, 0xffc7c7c6, 0xffffffff, 0xff8f8f8e, 0xffffffff, 0xff1f1f1e, 0xffffffff, 0xff3f3f3e,
+	0xffffffff, 0xfcfcfcfe, 0xffffffff, 0xf8f8f8fe, 0xffffffff, 0xf1f1f1fe, 0xffffffff, 0xe3e3e3fe,
+	0xffffffff, 0xc7c7c7fe, 0xffffffff, 0x8f8f8ffe, 0xffffffff, 0x1f1f1ffe, 0xffffffff, 0x3f3f3ffe,
+	0xffffffff, 0xfcfcfffe, 0xffffffff, 0xf8f8fffe, 0xffffffff, 0xf1f1fffe, 0xffffffff, 0xe3e3fffe,
+	0xffffffff, 0xc7c7fffe, 0xffffffff, 0x8f8ffffe, 0xffffffff, 0x1f1ffffe, 0xffffffff, 0x3f3ffffe,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000202, 0x00000000,
+	0x00070707, 0x00000000, 0x0f0f0f0f, 0x00000000, 0xffff1f1f, 0xfffffffe, 0xffff3f3f, 0xfffffffe,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000200, 0x00000000,
+	0x00070707, 0x00000000, 0x0f0f0f0f, 0x00000000, 0xff1f1f1f, 0xfffffffe, 0xff3f3f3f, 0xfffffffe,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020200, 0x00000000,
+	0x00070707, 0x00000000, 0x0f0f0f0f, 0x00000000, 0x1f1f1fff, 0xfffffffe, 0x3f3f3fff, 0xfffffffe,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02020200, 0x00000000,
+	0x07070707, 0x00000000, 0x0f0f0f0f, 0x00000000, 0x1f1fffff, 0xffffff1e, 0x3f3fffff, 0xffffff3e,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x02060200, 0x00000002,
+	0x070f0707, 0x00000006, 0x0f1f0f0f, 0x0000000e, 0x1fffffff, 0xffff1f1e, 0x3fffffff, 0xffff3f3e,
+	0x03000000, 0x00000000, 0x03000000, 0x00000000, 0x07030000, 0x00000000, 0x0f070700, 0x00000202,
+	0x1f0f0f07, 0x00000706, 0x3f1f1f0f, 0x00000f0e, 0xffffffff, 0xff1f1f1e, 0xffffffff, 0xff3f3f3e,
+	0xffffffff, 0xfcfcfcfe, 0xffffffff, 0xf8f8f8fe, 0xffffffff, 0xf1f1f1fe, 0xffffffff, 0xe3e3e3fe,
+	0xffffffff, 0xc7c7c7fe, 0xffffffff, 0x8f8f8ffe, 0xffffffff, 0x1f1f1ffe, 0xffffffff, 0x3f3f3ffe,
+	0xffffffff, 0xfcfcfffe, 0xffffffff, 0xf8f8fffe, 0xffffffff, 0xf1f1fffe, 0xffffffff, 0xe3e3fffe,
+	0xffffffff, 0xc7c7fffe, 0xffffffff, 0x8f8ffffe, 0xffffffff, 0x1f1ffffe, 0xffffffff, 0x3f3ffffe,
+	0x0f0f0c0c, 0x0000000c, 0x0f0f0800, 0x00000000, 0x0f0f0101, 0x00000001, 0x1f1f0303, 0x00000305,
+	0x3f3f0707, 0x00070f0d, 0x7f7f0f0f, 0x0f1f1f1d, 0xffff1f1f, 0xfffffffd, 0xffff3f3f, 0xfffffffd,
+	0x0e0c0c0c, 0x0000000d, 0x05000000, 0x00000005, 0x0b010101, 0x0000000d, 0x17030303, 0x0000031d,
+	0x2f070707, 0x00070f3d, 0x5f0f0f0f, 0x0f1f1f7d, 0xff1f1f1f, 0xfffffffd, 0xff3f3f3f, 0xfffffffd,
+	0x0c0c0c00, 0x0000000c, 0x00000000, 0x00000000, 0x01010100, 0x00000001, 0x03030307, 0x00000305,
+	0x0707070f, 0x00070f0d, 0x0f0f0f1f, 0x0f1f1f1d, 0x1f1f1fff, 0xfffffffd, 0x3f3f3fff, 0xfffffffd,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03030700, 0x00000301,
+	0x07070f0f, 0x00070f05, 0x0f0f1f1f, 0x0f1f1f0d, 0x1f1fffff, 0xffffff1d, 0x3f3fffff, 0xffffff3d,
+	0x0c0f0000, 0x00000c0c, 0x00000000, 0x00000000, 0x01070000, 0x00000101, 0x030f0f00, 0x00070301,
+	0x071f1f0f, 0x00070705, 0x0f3f3f1f, 0x0f1f0f0d, 0x1fffffff, 0xffff1f1d, 0x3fffffff, 0xffff3f3d,
+	0xffffffff, 0xfffcfcfc, 0xffffffff, 0xfff8f8f8, 0xffffffff, 0xfff1f1f1, 0xffffffff, 0xffe3e3e1,
+	0xffffffff, 0xffc7c7c5, 0xffffffff, 0xff8f8f8d, 0xffffffff, 0xff1f1f1d, 0xffffffff, 0xff3f3f3d,
+	0xffffffff, 0xfcfcfcfd, 0xffffffff, 0xf8f8f8fd, 0xffffffff, 0xf1f1f1fd, 0xffffffff, 0xe3e3e3fd,
+	0xffffffff, 0xc7c7c7fd, 0xffffffff, 0x8f8f8ffd, 0xffffffff, 0x1f1f1ffd, 0xffffffff, 0x3f3f3ffd,
+	0xffffffff, 0xfcfcfffd, 0xffffffff, 0xf8f8fffd, 0xffffffff, 0xf1f1fffd, 0xffffffff, 0xe3e3fffd,
+	0xffffffff, 0xc7c7fffd, 0xffffffff, 0x8f8ffffd, 0xffffffff, 0x1f1ffffd, 0xffffffff, 0x3f3ffffd,
+	0x04070404, 0x00000000, 0x00070000, 0x00000000, 0x01070101, 0x00000000, 0x030f0303, 0x00000001,
+	0x071f0707, 0x00000305, 0x0f3f0f0f, 0x00070f0d, 0x5f7f1f1f, 0x0f1f1f1d, 0xffff3f3f, 0xfffffffd,
+	0x05040400, 0x00000000, 0x02000000, 0x00000000, 0x05010100, 0x00000000, 0x0b030300, 0x00000001,
+	0x17070707, 0x00000305, 0x2f0f0f0f, 0x00070f0d, 0x5f1f1f1f, 0x0f1f1f1d, 0xff3f3f3f, 0xfffffffd,
+	0x04040000, 0x00000000, 0x00000000, 0x00000000, 0x01010000, 0x00000000, 0x03030300, 0x00000001,
+	0x07070700, 0x00000305, 0x0f0f0f0f, 0x00070f0d, 0x1f1f1f1f, 0x0f1f1f1d, 0x3f3f3fff, 0xfffffffd,
+	0x04000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x00000000, 0x03030000, 0x00000001,
+	0x07070700, 0x00000305, 0x0f0f0f0f, 0x00070f0d, 0x1f1f1f1f, 0x0f1f1f1d, 0x3f3fffff, 0xffffff3d,
+	0x04000000, 0x00000004, 0x00000000, 0x00000000, 0x01000000, 0x00000001, 0x03070000, 0x00000301,
+	0x070f0700, 0x00000305, 0x0f1f0f0f, 0x00070f0d, 0x1f3f1f1f, 0x0f1f1f1d, 0x3fffffff, 0xffff3f3d,
+	0x07000000, 0x00000404, 0x07000000, 0x00000000, 0x07000000, 0x00000101, 0x0f070000, 0x00000301,
+	0x1f0f0f00, 0x00070705, 0x3f1f1f0f, 0x00070f0d, 0x7f3f3f1f, 0x0f1f1f1d, 0xffffffff, 0xff3f3f3d,
+	0xffffffff, 0xfcfcfcfd, 0xffffffff, 0xf8f8f8fd, 0xffffffff, 0xf1f1f1fd, 0xffffffff, 0xe3e3e3fd,
+	0xffffffff, 0xc7c7c7fd, 0xffffffff, 0x8f8f8ffd, 0xffffffff, 0x1f1f1ffd, 0xffffffff, 0x3f3f3ffd,
+	0xffffffff, 0xfcfcfffd, 0xffffffff, 0xf8f8fffd, 0xffffffff, 0xf1f1fffd, 0xffffffff, 0xe3e3fffd,
+	0xffffffff, 0xc7c7fffd, 0xffffffff, 0x8f8ffffd, 0xffffffff, 0x1f1ffffd, 0xffffffff, 0x3f3ffffd,
+	0x3f3f3c3c, 0x00003c3a, 0x1f1f1818, 0x00000018, 0x1f1f1100, 0x00000000, 0x1f1f0303, 0x00000003,
+	0x3f3f0707, 0x0000070b, 0x7f7f0f0f, 0x000f1f1b, 0xffff1f1f, 0x1f3f3f3b, 0xffff3f3f, 0xfffffffb,
+	0x3e3c3c3c, 0x00003c3b, 0x1d181818, 0x0000001b, 0x0a000000, 0x0000000a, 0x17030303, 0x0000001b,
+	0x2f070707, 0x0000073b, 0x5f0f0f0f, 0x000f1f7b, 0xbf1f1f1f, 0x1f3f3ffb, 0xff3f3f3f, 0xfffffffb,
+	0x3c3c3c3e, 0x00003c3a, 0x18181800, 0x00000018, 0x00000000, 0x00000000, 0x03030300, 0x00000003,
+	0x0707070f, 0x0000070b, 0x0f0f0f1f, 0x000f1f1b, 0x1f1f1f3f, 0x1f3f3f3b, 0x3f3f3fff, 0xfffffffb,
+	0x3c3c3e00, 0x00003c38, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x07070f00, 0x00000703, 0x0f0f1f1f, 0x000f1f0b, 0x1f1f3f3f, 0x1f3f3f1b, 0x3f3fffff, 0xffffff3b,
+	0x3c3f3f00, 0x003e3c38, 0x181e0000, 0x00001818, 0x00000000, 0x00000000, 0x030f0000, 0x00000303,
+	0x071f1f00, 0x000f0703, 0x0f3f3f1f, 0x000f0f0b, 0x1f7f7f3f, 0x1f3f1f1b, 0x3fffffff, 0xffff3f3b,
+	0xffffffff, 0xfffcfcf8, 0xffffffff, 0xfff8f8f8, 0xffffffff, 0xfff1f1f1, 0xffffffff, 0xffe3e3e3,
+	0xffffffff, 0xffc7c7c3, 0xffffffff, 0xff8f8f8b, 0xffffffff, 0xff1f1f1b, 0xffffffff, 0xff3f3f3b,
+	0xffffffff, 0xfcfcfcfb, 0xffffffff, 0xf8f8f8fb, 0xffffffff, 0xf1f1f1fb, 0xffffffff, 0xe3e3e3fb,
+	0xffffffff, 0xc7c7c7fb, 0xffffffff, 0x8f8f8ffb, 0xffffffff, 0x1f1f1ffb, 0xffffffff, 0x3f3f3ffb,
+	0xffffffff, 0xfcfcfffb, 0xffffffff, 0xf8f8fffb, 0xffffffff, 0xf1f1fffb, 0xffffffff, 0xe3e3fffb,
+	0xffffffff, 0xc7c7fffb, 0xffffffff, 0x8f8ffffb, 0xffffffff, 0x1f1ffffb, 0xffffffff, 0x3f3ffffb,
+	0x1c1f1c1c, 0x00000018, 0x080e0808, 0x00000000, 0x000e0000, 0x00000000, 0x020e0202, 0x00000000,
+	0x071f0707, 0x00000003, 0x0f3f0f0f, 0x0000070b, 0x1f7f1f1f, 0x000f1f1b, 0xbfff3f3f, 0x1f3f3f3b,
+	0x1d1c1c00, 0x00000018, 0x0a080800, 0x00000000, 0x04000000, 0x00000000, 0x0a020200, 0x00000000,
+	0x17070700, 0x00000003, 0x2f0f0f0f, 0x0000070b, 0x5f1f1f1f, 0x000f1f1b, 0xbf3f3f3f, 0x1f3f3f3b,
+	0x1c1c1c00, 0x00000018, 0x08080000, 0x00000000, 0x00000000, 0x00000000, 0x02020000, 0x00000000,
+	0x07070700, 0x00000003, 0x0f0f0f00, 0x0000070b, 0x1f1f1f1f, 0x000f1f1b, 0x3f3f3f3f, 0x1f3f3f3b,
+	0x1c1c0000, 0x00000018, 0x08000000, 0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x00000000,
+	0x07070000, 0x00000003, 0x0f0f0f00, 0x0000070b, 0x1f1f1f1f, 0x000f1f1b, 0x3f3f3f3f, 0x1f3f3f3b,
+	0x1c1e0000, 0x00001c18, 0x08000000, 0x00000008, 0x00000000, 0x00000000, 0x02000000, 0x00000002,
+	0x070f0000, 0x00000703, 0x0f1f0f00, 0x0000070b, 0x1f3f1f1f, 0x000f1f1b, 0x3f7f3f3f, 0x1f3f3f3b,
+	0x1f1e0000, 0x00001c18, 0x0e000000, 0x00000808, 0x0e000000, 0x00000000, 0x0e000000, 0x00000202,
+	0x1f0f0000, 0x00000703, 0x3f1f1f00, 0x000f0f0b, 0x7f3f3f1f, 0x000f1f1b, 0xff7f7f3f, 0x1f3f3f3b,
+	0xffffffff, 0xfcfcfcfb, 0xffffffff, 0xf8f8f8fb, 0xffffffff, 0xf1f1f1fb, 0xffffffff, 0xe3e3e3fb,
+	0xffffffff, 0xc7c7c7fb, 0xffffffff, 0x8f8f8ffb, 0xffffffff, 0x1f1f1ffb, 0xffffffff, 0x3f3f3ffb,
+	0xffffffff, 0xfcfcfffb, 0xffffffff, 0xf8f8fffb, 0xffffffff, 0xf1f1fffb, 0xffffffff, 0xe3e3fffb,
+	0xffffffff, 0xc7c7fffb, 0xffffffff, 0x8f8ffffb, 0xffffffff, 0x1f1ffffb, 0xffffffff, 0x3f3ffffb,
+	0xfffffcfc, 0x00fcfef6, 0x7f7f7878, 0x00007874, 0x3e3e3030, 0x00000030, 0x3e3e2200, 0x00000000,
+	0x3e3e0606, 0x00000006, 0x7f7f0f0f, 0x00000f17, 0xffff1f1f, 0x001f3f37, 0xffff3f3f, 0x3f7f7f77,
+	0xfefcfcfc, 0x00fcfef7, 0x7d787878, 0x00007877, 0x3a303030, 0x00000036, 0x14000000, 0x00000014,
+	0x2e060606, 0x00000036, 0x5f0f0f0f, 0x00000f77, 0xbf1f1f1f, 0x001f3ff7, 0x7f3f3f3f, 0x3f7f7ff7,
+	0xfcfcfcfe, 0x00fcfef6, 0x7878787c, 0x00007874, 0x30303000, 0x00000030, 0x00000000, 0x00000000,
+	0x06060600, 0x00000006, 0x0f0f0f1f, 0x00000f17, 0x1f1f1f3f, 0x001f3f37, 0x3f3f3f7f, 0x3f7f7f77,
+	0xfcfcfefe, 0x00fcfef4, 0x78787c00, 0x00007870, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0f0f1f00, 0x00000f07, 0x1f1f3f3f, 0x001f3f17, 0x3f3f7f7f, 0x3f7f7f37,
+	0xfcfffffe, 0x00fcfcf4, 0x787e7e00, 0x007c7870, 0x303c0000, 0x00003030, 0x00000000, 0x00000000,
+	0x061e0000, 0x00000606, 0x0f3f3f00, 0x001f0f07, 0x1f7f7f3f, 0x001f1f17, 0x3fffff7f, 0x3f7f3f37,
+	0xffffffff, 0xfffcfcf4, 0xffffffff, 0xfff8f8f0, 0xffffffff, 0xfff1f1f1, 0xffffffff, 0xffe3e3e3,
+	0xffffffff, 0xffc7c7c7, 0xffffffff, 0xff8f8f87, 0xffffffff, 0xff1f1f17, 0xffffffff, 0xff3f3f37,
+	0xffffffff, 0xfcfcfcf7, 0xffffffff, 0xf8f8f8f7, 0xffffffff, 0xf1f1f1f7, 0xffffffff, 0xe3e3e3f7,
+	0xffffffff, 0xc7c7c7f7, 0xffffffff, 0x8f8f8ff7, 0xffffffff, 0x1f1f1ff7, 0xffffffff, 0x3f3f3ff7,
+	0xffffffff, 0xfcfcfff7, 0xffffffff, 0xf8f8fff7, 0xffffffff, 0xf1f1fff7, 0xffffffff, 0xe3e3fff7,
+	0xffffffff, 0xc7c7fff7, 0xffffffff, 0x8f8ffff7, 0xffffffff, 0x1f1ffff7, 0xffffffff, 0x3f3ffff7,
+	0x7c7f7c7c, 0x00007874, 0x383e3838, 0x00000030, 0x101c1010, 0x00000000, 0x001c0000, 0x00000000,
+	0x041c0404, 0x00000000, 0x0e3e0e0e, 0x00000006, 0x1f7f1f1f, 0x00000f17, 0x3fff3f3f, 0x001f3f37,
+	0x7d7c7c7c, 0x00007874, 0x3a383800, 0x00000030, 0x14101000, 0x00000000, 0x08000000, 0x00000000,
+	0x14040400, 0x00000000, 0x2e0e0e00, 0x00000006, 0x5f1f1f1f, 0x00000f17, 0xbf3f3f3f, 0x001f3f37,
+	0x7c7c7c00, 0x00007874, 0x38383800, 0x00000030, 0x10100000, 0x00000000, 0x00000000, 0x00000000,
+	0x04040000, 0x00000000, 0x0e0e0e00, 0x00000006, 0x1f1f1f00, 0x00000f17, 0x3f3f3f3f, 0x001f3f37,
+	0x7c7c7c00, 0x00007874, 0x38380000, 0x00000030, 0x10000000, 0x00000000, 0x00000000, 0x00000000,
+	0x04000000, 0x00000000, 0x0e0e0000, 0x00000006, 0x1f1f1f00, 0x00000f17, 0x3f3f3f3f, 0x001f3f37,
+	0x7c7e7c00, 0x00007874, 0x383c0000, 0x00003830, 0x10000000, 0x00000010, 0x00000000, 0x00000000,
+	0x04000000, 0x00000004, 0x0e1e0000, 0x00000e06, 0x1f3f1f00, 0x00000f17, 0x3f7f3f3f, 0x001f3f37,
+	0x7f7e7e00, 0x007c7c74, 0x3e3c0000, 0x00003830, 0x1c000000, 0x00001010, 0x1c000000, 0x00000000,
+	0x1c000000, 0x00000404, 0x3e1e0000, 0x00000e06, 0x7f3f3f00, 0x001f1f17, 0xff7f7f3f, 0x001f3f37,
+	0xffffffff, 0xfcfcfcf7, 0xffffffff, 0xf8f8f8f7, 0xffffffff, 0xf1f1f1f7, 0xffffffff, 0xe3e3e3f7,
+	0xffffffff, 0xc7c7c7f7, 0xffffffff, 0x8f8f8ff7, 0xffffffff, 0x1f1f1ff7, 0xffffffff, 0x3f3f3ff7,
+	0xffffffff, 0xfcfcfff7, 0xffffffff, 0xf8f8fff7, 0xffffffff, 0xf1f1fff7, 0xffffffff, 0xe3e3fff7,
+	0xffffffff, 0xc7c7fff7, 0xffffffff, 0x8f8ffff7, 0xffffffff, 0x1f1ffff7, 0xffffffff, 0x3f3ffff7,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00070303, 0x00000000,
+	0x0f0f0707, 0x00000000, 0x1f1f0f0f, 0x0000001f, 0xffff1f1f, 0xfffffeff, 0xffff3f3f, 0xfffffeff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00030303, 0x00000000,
+	0x0f070707, 0x00000000, 0x1f0f0f0f, 0x0000001f, 0xff1f1f1f, 0xfffffeff, 0xff3f3f3f, 0xfffffeff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03030300, 0x00000000,
+	0x0707070f, 0x00000000, 0x0f0f0f1f, 0x0000001f, 0x1f1f1fff, 0xfffffeff, 0x3f3f3fff, 0xfffffeff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03030700, 0x00000003,
+	0x07070f0f, 0x00000007, 0x0f0f1f1f, 0x0000000f, 0x1f1fffff, 0xfffffe1f, 0x3f3fffff, 0xfffffe3f,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x03070700, 0x00000203,
+	0x070f0f0f, 0x00000607, 0x0f1f1f1f, 0x00000e0f, 0x1fffffff, 0xffff1e1f, 0x3fffffff, 0xffff3e3f,
+	0x00000000, 0x00000000, 0x03000000, 0x00000000, 0x07070000, 0x00000001, 0x0f0f0700, 0x00030203,
+	0x1f1f0f0f, 0x00070607, 0x3f3f1f1f, 0x000f0e0f, 0xffffffff, 0xff1f1e1f, 0xffffffff, 0xff3f3e3f,
+	0xffffffff, 0xfcfcfcff, 0xffffffff, 0xf8f8f8ff, 0xffffffff, 0xf1f1f0ff, 0xffffffff, 0xe3e3e2ff,
+	0xffffffff, 0xc7c7c6ff, 0xffffffff, 0x8f8f8eff, 0xffffffff, 0x1f1f1eff, 0xffffffff, 0x3f3f3eff,
+	0xffffffff, 0xfcfcfeff, 0xffffffff, 0xf8f8feff, 0xffffffff, 0xf1f1feff, 0xffffffff, 0xe3e3feff,
+	0xffffffff, 0xc7c7feff, 0xffffffff, 0x8f8ffeff, 0xffffffff, 0x1f1ffeff, 0xffffffff, 0x3f3ffeff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000202, 0x00000000,
+	0x00070707, 0x00000000, 0x0f0f0f0f, 0x00000000, 0x1f1f1f1f, 0x0000001f, 0xffff3f3f, 0xfffffeff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000200, 0x00000000,
+	0x00070700, 0x00000000, 0x0f0f0f0f, 0x00000000, 0x1f1f1f1f, 0x0000001f, 0xff3f3f3f, 0xfffffeff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000,
+	0x00070700, 0x00000000, 0x0f0f0f0f, 0x00000000, 0x1f1f1f1f, 0x0000001f, 0x3f3f3fff, 0xfffffeff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02020000, 0x00000000,
+	0x07070700, 0x00000000, 0x0f0f0f0f, 0x00000000, 0x1f1f1f1f, 0x0000001f, 0x3f3fffff, 0xfffffe3f,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02020000, 0x00000002,
+	0x07070700, 0x00000007, 0x0f0f0f0f, 0x0000000f, 0x1f1f1f1f, 0x0000001f, 0x3fffffff, 0xffff3e3f,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x00000000, 0x06020000, 0x00000202,
+	0x0f070700, 0x00000607, 0x1f0f0f0f, 0x00000e0f, 0x3f1f1f1f, 0x00001e1f, 0xffffffff, 0xff3f3e3f,
+	0x00000000, 0x00000003, 0x00000000, 0x00000003, 0x03000000, 0x00000007, 0x07070000, 0x0002020f,
+	0x0f0f0700, 0x0007061f, 0x1f1f0f0f, 0x000f0e3f, 0x3f3f1f1f, 0x001f1e7f, 0xffffffff, 0x3f3f3eff,
+	0xffffffff, 0xfcfcfeff, 0xffffffff, 0xf8f8feff, 0xffffffff, 0xf1f1feff, 0xffffffff, 0xe3e3feff,
+	0xffffffff, 0xc7c7feff, 0xffffffff, 0x8f8ffeff, 0xffffffff, 0x1f1ffeff, 0xffffffff, 0x3f3ffeff,
+	0x1f1f1c0c, 0x00001d1f, 0x1f1f1800, 0x00001d1f, 0x1f1f1101, 0x00001d1f, 0x1f1f0303, 0x00031d1f,
+	0x3f3f0707, 0x070f3d3f, 0x7f7f0f0f, 0x1f1f7d7f, 0xffff1f1f, 0x3f3ffdff, 0xffff3f3f, 0xfffffdff,
+	0x0f0c0c0c, 0x00000c0f, 0x0f080000, 0x0000000f, 0x0f010101, 0x0000010f, 0x1f030303, 0x0003051f,
+	0x3f070707, 0x070f0d3f, 0x7f0f0f0f, 0x1f1f1d7f, 0xff1f1f1f, 0x3f3f3dff, 0xff3f3f3f, 0xfffffdff,
+	0x0c0c0c00, 0x00000d0e, 0x00000000, 0x00000505, 0x01010100, 0x00000d0b, 0x03030300, 0x00031d17,
+	0x0707070f, 0x070f3d2f, 0x0f0f0f1f, 0x1f1f7d5f, 0x1f1f1f3f, 0x3f3ffdbf, 0x3f3f3fff, 0xfffffdff,
+	0x0c0c0000, 0x00000c0c, 0x00000000, 0x00000000, 0x01010000, 0x00000101, 0x03030700, 0x00030503,
+	0x07070f00, 0x070f0d07, 0x0f0f1f1f, 0x1f1f1d0f, 0x1f1f3f3f, 0x3f3f3d1f, 0x3f3fffff, 0xfffffd3f,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03070000, 0x00030103,
+	0x070f0f00, 0x070f0507, 0x0f1f1f1f, 0x1f1f0d0f, 0x1f3f3f3f, 0x3f3f1d1f, 0x3fffffff, 0xffff3d3f,
+	0x0f000000, 0x000c0c0c, 0x00000000, 0x00000000, 0x07000000, 0x00010101, 0x0f0f0000, 0x07030103,
+	0x1f1f0f00, 0x07070507, 0x3f3f1f1f, 0x1f0f0d0f, 0x7f7f3f3f, 0x3f1f1d1f, 0xffffffff, 0xff3f3d3f,
+	0xffffffff, 0xfcfcfcff, 0xffffffff, 0xf8f8f8ff, 0xffffffff, 0xf1f1f1ff, 0xffffffff, 0xe3e3e1ff,
+	0xffffffff, 0xc7c7c5ff, 0xffffffff, 0x8f8f8dff, 0xffffffff, 0x1f1f1dff, 0xffffffff, 0x3f3f3dff,
+	0xffffffff, 0xfcfcfdff, 0xffffffff, 0xf8f8fdff, 0xffffffff, 0xf1f1fdff, 0xffffffff, 0xe3e3fdff,
+	0xffffffff, 0xc7c7fdff, 0xffffffff, 0x8f8ffdff, 0xffffffff, 0x1f1ffdff, 0xffffffff, 0x3f3ffdff,
+	0x0f0f0404, 0x0000000f, 0x0f0f0000, 0x0000000f, 0x0f0f0101, 0x0000000f, 0x0f0f0303, 0x0000010f,
+	0x1f1f0707, 0x0003051f, 0x3f3f0f0f, 0x070f0d3f, 0x7f7f1f1f, 0x1f1f1d7f, 0xffff3f3f, 0x3f3f3dff,
+	0x07040400, 0x00000004, 0x07000000, 0x00000000, 0x07010100, 0x00000001, 0x0f030300, 0x00000103,
+	0x1f070700, 0x00030507, 0x3f0f0f0f, 0x070f0d0f, 0x7f1f1f1f, 0x1f1f1d1f, 0xff3f3f3f, 0x3f3f3dbf,
+	0x04040000, 0x00000005, 0x00000000, 0x00000002, 0x01010000, 0x00000005, 0x03030000, 0x0000010b,
+	0x07070700, 0x00030517, 0x0f0f0f00, 0x070f0d2f, 0x1f1f1f1f, 0x1f1f1d5f, 0x3f3f3f3f, 0x3f3f3dbf,
+	0x04000000, 0x00000004, 0x00000000, 0x00000000, 0x01000000, 0x00000001, 0x03030000, 0x00000103,
+	0x07070000, 0x00030507, 0x0f0f0f00, 0x070f0d0f, 0x1f1f1f1f, 0x1f1f1d1f, 0x3f3f3f3f, 0x3f3f3d3f,
+	0x00000000, 0x00000004, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x03000000, 0x00000103,
+	0x07070000, 0x00030507, 0x0f0f0f00, 0x070f0d0f, 0x1f1f1f1f, 0x1f1f1d1f, 0x3f3f3f3f, 0x3f3f3d3f,
+	0x00000000, 0x00000404, 0x00000000, 0x00000000, 0x00000000, 0x00000101, 0x07000000, 0x00030103,
+	0x0f070000, 0x00030507, 0x1f0f0f00, 0x070f0d0f, 0x3f1f1f1f, 0x1f1f1d1f, 0x7f3f3f3f, 0x3f3f3d3f,
+	0x00000000, 0x00040407, 0x00000000, 0x00000007, 0x00000000, 0x00010107, 0x07000000, 0x0003010f,
+	0x0f0f0000, 0x0707051f, 0x1f1f0f00, 0x070f0d3f, 0x3f3f1f1f, 0x1f1f1d7f, 0x7f7f3f3f, 0x3f3f3dff,
+	0xffffffff, 0xfcfcfdff, 0xffffffff, 0xf8f8fdff, 0xffffffff, 0xf1f1fdff, 0xffffffff, 0xe3e3fdff,
+	0xffffffff, 0xc7c7fdff, 0xffffffff, 0x8f8ffdff, 0xffffffff, 0x1f1ffdff, 0xffffffff, 0x3f3ffdff,
+	0x3f3f3c3c, 0x003c3b3f, 0x3f3f3818, 0x00003b3f, 0x3f3f3100, 0x00003b3f, 0x3f3f2303, 0x00003b3f,
+	0x3f3f0707, 0x00073b3f, 0x7f7f0f0f, 0x0f1f7b7f, 0xffff1f1f, 0x3f3ffbff, 0xffff3f3f, 0x7f7ffbff,
+	0x3f3c3c3c, 0x003c3a3f, 0x1f181818, 0x0000181f, 0x1f110000, 0x0000001f, 0x1f030303, 0x0000031f,
+	0x3f070707, 0x00070b3f, 0x7f0f0f0f, 0x0f1f1b7f, 0xff1f1f1f, 0x3f3f3bff, 0xff3f3f3f, 0x7f7f7bff,
+	0x3c3c3c00, 0x003c3b3e, 0x18181800, 0x00001b1d, 0x00000000, 0x00000a0a, 0x03030300, 0x00001b17,
+	0x07070700, 0x00073b2f, 0x0f0f0f1f, 0x0f1f7b5f, 0x1f1f1f3f, 0x3f3ffbbf, 0x3f3f3f7f, 0x7f7ffb7f,
+	0x3c3c3e00, 0x003c3a3c, 0x18180000, 0x00001818, 0x00000000, 0x00000000, 0x03030000, 0x00000303,
+	0x07070f00, 0x00070b07, 0x0f0f1f00, 0x0f1f1b0f, 0x1f1f3f3f, 0x3f3f3b1f, 0x3f3f7f7f, 0x7f7f7b3f,
+	0x3c3e0000, 0x003c383c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x070f0000, 0x00070307, 0x0f1f1f00, 0x0f1f0b0f, 0x1f3f3f3f, 0x3f3f1b1f, 0x3f7f7f7f, 0x7f7f3b3f,
+	0x3f3f0000, 0x3e3c383c, 0x1e000000, 0x00181818, 0x00000000, 0x00000000, 0x0f000000, 0x00030303,
+	0x1f1f0000, 0x0f070307, 0x3f3f1f00, 0x0f0f0b0f, 0x7f7f3f3f, 0x3f1f1b1f, 0xffff7f7f, 0x7f3f3b3f,
+	0xffffffff, 0xfcfcf8ff, 0xffffffff, 0xf8f8f8ff, 0xffffffff, 0xf1f1f1ff, 0xffffffff, 0xe3e3e3ff,
+	0xffffffff, 0xc7c7c3ff, 0xffffffff, 0x8f8f8bff, 0xffffffff, 0x1f1f1bff, 0xffffffff, 0x3f3f3bff,
+	0xffffffff, 0xfcfcfbff, 0xffffffff, 0xf8f8fbff, 0xffffffff, 0xf1f1fbff, 0xffffffff, 0xe3e3fbff,
+	0xffffffff, 0xc7c7fbff, 0xffffffff, 0x8f8ffbff, 0xffffffff, 0x1f1ffbff, 0xffffffff, 0x3f3ffbff,
+	0x1f1f1c1c, 0x0000181f, 0x1f1f0808, 0x0000001f, 0x1f1f0000, 0x0000001f, 0x1f1f0202, 0x0000001f,
+	0x1f1f0707, 0x0000031f, 0x3f3f0f0f, 0x00070b3f, 0x7f7f1f1f, 0x0f1f1b7f, 0xffff3f3f, 0x3f3f3bff,
+	0x1f1c1c00, 0x0000181c, 0x0e080800, 0x00000008, 0x0e000000, 0x00000000, 0x0e020200, 0x00000002,
+	0x1f070700, 0x00000307, 0x3f0f0f00, 0x00070b0f, 0x7f1f1f1f, 0x0f1f1b1f, 0xff3f3f3f, 0x3f3f3b3f,
+	0x1c1c0000, 0x0000181d, 0x08080000, 0x0000000a, 0x00000000, 0x00000004, 0x02020000, 0x0000000a,
+	0x07070000, 0x00000317, 0x0f0f0f00, 0x00070b2f, 0x1f1f1f00, 0x0f1f1b5f, 0x3f3f3f3f, 0x3f3f3bbf,
+	0x1c1c0000, 0x0000181c, 0x08000000, 0x00000008, 0x00000000, 0x00000000, 0x02000000, 0x00000002,
+	0x07070000, 0x00000307, 0x0f0f0000, 0x00070b0f, 0x1f1f1f00, 0x0f1f1b1f, 0x3f3f3f3f, 0x3f3f3b3f,
+	0x1c000000, 0x0000181c, 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000002,
+	0x07000000, 0x00000307, 0x0f0f0000, 0x00070b0f, 0x1f1f1f00, 0x0f1f1b1f, 0x3f3f3f3f, 0x3f3f3b3f,
+	0x1e000000, 0x001c181c, 0x00000000, 0x00000808, 0x00000000, 0x00000000, 0x00000000, 0x00000202,
+	0x0f000000, 0x00070307, 0x1f0f0000, 0x00070b0f, 0x3f1f1f00, 0x0f1f1b1f, 0x7f3f3f3f, 0x3f3f3b3f,
+	0x1e000000, 0x001c181f, 0x00000000, 0x0008080e, 0x00000000, 0x0000000e, 0x00000000, 0x0002020e,
+	0x0f000000, 0x0007031f, 0x1f1f0000, 0x0f0f0b3f, 0x3f3f1f00, 0x0f1f1b7f, 0x7f7f3f3f, 0x3f3f3bff,
+	0xffffffff, 0xfcfcfbff, 0xffffffff, 0xf8f8fbff, 0xffffffff, 0xf1f1fbff, 0xffffffff, 0xe3e3fbff,
+	0xffffffff, 0xc7c7fbff, 0xffffffff, 0x8f8ffbff, 0xffffffff, 0x1f1ffbff, 0xffffffff, 0x3f3ffbff,
+	0xfffffcfc, 0xfcfef7ff, 0x7f7f7878, 0x0078777f, 0x7f7f7130, 0x0000777f, 0x7f7f6300, 0x0000777f,
+	0x7f7f4706, 0x0000777f, 0x7f7f0f0f, 0x000f777f, 0xffff1f1f, 0x1f3ff7ff, 0xffff3f3f, 0x7f7ff7ff,
+	0xfffcfcfc, 0xfcfef6ff, 0x7f787878, 0x0078747f, 0x3e303030, 0x0000303e, 0x3e220000, 0x0000003e,
+	0x3e060606, 0x0000063e, 0x7f0f0f0f, 0x000f177f, 0xff1f1f1f, 0x1f3f37ff, 0xff3f3f3f, 0x7f7f77ff,
+	0xfcfcfcfe, 0xfcfef7fe, 0x78787800, 0x0078777d, 0x30303000, 0x0000363a, 0x00000000, 0x00001414,
+	0x06060600, 0x0000362e, 0x0f0f0f00, 0x000f775f, 0x1f1f1f3f, 0x1f3ff7bf, 0x3f3f3f7f, 0x7f7ff77f,
+	0xfcfcfe00, 0xfcfef6fc, 0x78787c00, 0x00787478, 0x30300000, 0x00003030, 0x00000000, 0x00000000,
+	0x06060000, 0x00000606, 0x0f0f1f00, 0x000f170f, 0x1f1f3f00, 0x1f3f371f, 0x3f3f7f7f, 0x7f7f773f,
+	0xfcfefe00, 0xfcfef4fc, 0x787c0000, 0x00787078, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0f1f0000, 0x000f070f, 0x1f3f3f00, 0x1f3f171f, 0x3f7f7f7f, 0x7f7f373f,
+	0xfffffe00, 0xfcfcf4fc, 0x7e7e0000, 0x7c787078, 0x3c000000, 0x00303030, 0x00000000, 0x00000000,
+	0x1e000000, 0x00060606, 0x3f3f0000, 0x1f0f070f, 0x7f7f3f00, 0x1f1f171f, 0xffff7f7f, 0x7f3f373f,
+	0xffffffff, 0xfcfcf4ff, 0xffffffff, 0xf8f8f0ff, 0xffffffff, 0xf1f1f1ff, 0xffffffff, 0xe3e3e3ff,
+	0xffffffff, 0xc7c7c7ff, 0xffffffff, 0x8f8f87ff, 0xffffffff, 0x1f1f17ff, 0xffffffff, 0x3f3f37ff,
+	0xffffffff, 0xfcfcf7ff, 0xffffffff, 0xf8f8f7ff, 0xffffffff, 0xf1f1f7ff, 0xffffffff, 0xe3e3f7ff,
+	0xffffffff, 0xc7c7f7ff, 0xffffffff, 0x8f8ff7ff, 0xffffffff, 0x1f1ff7ff, 0xffffffff, 0x3f3ff7ff,
+	0x7f7f7c7c, 0x0078747f, 0x3e3e3838, 0x0000303e, 0x3e3e1010, 0x0000003e, 0x3e3e0000, 0x0000003e,
+	0x3e3e0404, 0x0000003e, 0x3e3e0e0e, 0x0000063e, 0x7f7f1f1f, 0x000f177f, 0xffff3f3f, 0x1f3f37ff,
+	0x7f7c7c00, 0x0078747c, 0x3e383800, 0x00003038, 0x1c101000, 0x00000010, 0x1c000000, 0x00000000,
+	0x1c040400, 0x00000004, 0x3e0e0e00, 0x0000060e, 0x7f1f1f00, 0x000f171f, 0xff3f3f3f, 0x1f3f373f,
+	0x7c7c7c00, 0x0078747d, 0x38380000, 0x0000303a, 0x10100000, 0x00000014, 0x00000000, 0x00000008,
+	0x04040000, 0x00000014, 0x0e0e0000, 0x0000062e, 0x1f1f1f00, 0x000f175f, 0x3f3f3f00, 0x1f3f37bf,
+	0x7c7c0000, 0x0078747c, 0x38380000, 0x00003038, 0x10000000, 0x00000010, 0x00000000, 0x00000000,
+	0x04000000, 0x00000004, 0x0e0e0000, 0x0000060e, 0x1f1f0000, 0x000f171f, 0x3f3f3f00, 0x1f3f373f,
+	0x7c7c0000, 0x0078747c, 0x38000000, 0x00003038, 0x00000000, 0x00000010, 0x00000000, 0x00000000,
+	0x00000000, 0x00000004, 0x0e000000, 0x0000060e, 0x1f1f0000, 0x000f171f, 0x3f3f3f00, 0x1f3f373f,
+	0x7e7c0000, 0x0078747c, 0x3c000000, 0x00383038, 0x00000000, 0x00001010, 0x00000000, 0x00000000,
+	0x00000000, 0x00000404, 0x1e000000, 0x000e060e, 0x3f1f0000, 0x000f171f, 0x7f3f3f00, 0x1f3f373f,
+	0x7e7e0000, 0x7c7c747f, 0x3c000000, 0x0038303e, 0x00000000, 0x0010101c, 0x00000000, 0x0000001c,
+	0x00000000, 0x0004041c, 0x1e000000, 0x000e063e, 0x3f3f0000, 0x1f1f177f, 0x7f7f3f00, 0x1f3f37ff,
+	0xffffffff, 0xfcfcf7ff, 0xffffffff, 0xf8f8f7ff, 0xffffffff, 0xf1f1f7ff, 0xffffffff, 0xe3e3f7ff,
+	0xffffffff, 0xc7c7f7ff, 0xffffffff, 0x8f8ff7ff, 0xffffffff, 0x1f1ff7ff, 0xffffffff, 0x3f3ff7ff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00070303, 0x00000000,
+	0x0f0f0707, 0x00000000, 0x1f1f0f0f, 0x0000001f, 0xffff1f1f, 0xfffeffff, 0xffff3f3f, 0xfffeffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00030303, 0x00000000,
+	0x0f070707, 0x00000000, 0x1f0f0f0f, 0x0000001f, 0xff1f1f1f, 0xfffeffff, 0xff3f3f3f, 0xfffeffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03030300, 0x00000000,
+	0x0707070f, 0x00000000, 0x0f0f0f1f, 0x0000001f, 0x1f1f1fff, 0xfffeffff, 0x3f3f3fff, 0xfffeffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03030700, 0x00000003,
+	0x07070f0f, 0x00000007, 0x0f0f1f1f, 0x0000000f, 0x1f1fffff, 0xfffeff1f, 0x3f3fffff, 0xfffeff3f,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x03070700, 0x00000303,
+	0x070f0f0f, 0x00000707, 0x0f1f1f1f, 0x00000f0f, 0x1fffffff, 0xfffe1f1f, 0x3fffffff, 0xfffe3f3f,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0f0f0000, 0x00000001, 0x1f1f0700, 0x00020303,
+	0x3f3f0f0f, 0x00060707, 0x7f7f1f1f, 0x000e0f0f, 0xffffffff, 0xff1e1f1f, 0xffffffff, 0xff3e3f3f,
+	0x00000000, 0x00000000, 0xffffffff, 0xf8f8f8ff, 0xffffffff, 0xf1f0f1ff, 0xffffffff, 0xe3e2e3ff,
+	0xffffffff, 0xc7c6c7ff, 0xffffffff, 0x8f8e8fff, 0xffffffff, 0x1f1e1fff, 0xffffffff, 0x3f3e3fff,
+	0xffffffff, 0xfcfcffff, 0xffffffff, 0xf8f8ffff, 0xffffffff, 0xf1f0ffff, 0xffffffff, 0xe3e2ffff,
+	0xffffffff, 0xc7c6ffff, 0xffffffff, 0x8f8effff, 0xffffffff, 0x1f1effff, 0xffffffff, 0x3f3effff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000202, 0x00000000,
+	0x00070707, 0x00000000, 0x0f0f0f0f, 0x00000000, 0x1f1f1f1f, 0x0000001f, 0xffff3f3f, 0xfffeffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000200, 0x00000000,
+	0x00070700, 0x00000000, 0x0f0f0f0f, 0x00000000, 0x1f1f1f1f, 0x0000001f, 0xff3f3f3f, 0xfffeffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000,
+	0x00070700, 0x00000000, 0x0f0f0f0f, 0x00000000, 0x1f1f1f1f, 0x0000001f, 0x3f3f3fff, 0xfffeffff,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02020000, 0x00000000,
+	0x07070700, 0x00000000, 0x0f0f0f0f, 0x00000000, 0x1f1f1f1f, 0x0000001f, 0x3f3fffff, 0xfffeff3f,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02020000, 0x00000002,
+	0x07070700, 0x00000007, 0x0f0f0f0f, 0x0000000f, 0x1f1f1f1f, 0x0000001f, 0x3fffffff, 0xfffe3f3f,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x06000000, 0x00000000, 0x0e020000, 0x00000202,
+	0x1f070700, 0x00000707, 0x3f0f0f0f, 0x00000f0f, 0x7f1f1f1f, 0x00001f1f, 0xffffffff, 0xff3e3f3f,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0f0f0000, 0x0000000f, 0x0f0f0000, 0x0002020f,
+	0x1f1f0700, 0x0006071f, 0x3f3f0f0f, 0x000e0f3f, 0x7f7f1f1f, 0x001e1f7f, 0xffffffff, 0x3f3e3fff,
+	0x00000000, 0x00000300, 0x00000000, 0x00000300, 0xffffffff, 0xf1f0ffff, 0xffffffff, 0xe3e2ffff,
+	0xffffffff, 0xc7c6ffff, 0xffffffff, 0x8f8effff, 0xffffffff, 0x1f1effff, 0xffffffff, 0x3f3effff,
+	0x3f3f3c0c, 0x3f3d3f3f, 0x3f3f3800, 0x3f3d3f3f, 0x3f3f3101, 0x3f3d3f3f, 0x3f3f2303, 0x3f3d3f3f,
+	0x3f3f0707, 0x3f3d3f3f, 0x7f7f0f0f, 0x7f7d7f7f, 0xffff1f1f, 0xfffdffff, 0xffff3f3f, 0xfffdffff,
+	0x1f1c0c0c, 0x001d1f1f, 0x1f180000, 0x001d1f1f, 0x1f110101, 0x001d1f1f, 0x1f030303, 0x031d1f1f,
+	0x3f070707, 0x0f3d3f3f, 0x7f0f0f0f, 0x1f7d7f7f, 0xff1f1f1f, 0x3ffdffff, 0xff3f3f3f, 0xfffdffff,
+	0x0c0c0c00, 0x000c0f0f, 0x08000000, 0x00000f0f, 0x01010100, 0x00010f0f, 0x03030300, 0x03051f1f,
+	0x07070700, 0x0f0d3f3f, 0x0f0f0f1f, 0x1f1d7f7f, 0x1f1f1f3f, 0x3f3dffff, 0x3f3f3fff, 0xfffdffff,
+	0x0c0c0000, 0x000d0e0c, 0x00000000, 0x00050500, 0x01010000, 0x000d0b01, 0x03030000, 0x031d1703,
+	0x07070f00, 0x0f3d2f07, 0x0f0f1f1f, 0x1f7d5f0f, 0x1f1f3f3f, 0x3ffdbf1f, 0x3f3fffff, 0xfffdff3f,
+	0x0c000000, 0x000c0c0c, 0x00000000, 0x00000000, 0x01000000, 0x00010101, 0x03070000, 0x03050303,
+	0x070f0f00, 0x0f0d0707, 0x0f1f1f1f, 0x1f1d0f0f, 0x1f3f3f3f, 0x3f3d1f1f, 0x3fffffff, 0xfffd3f3f,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1f1f0000, 0x03010303,
+	0x3f3f0f00, 0x0f050707, 0x7f7f1f1f, 0x1f0d0f0f, 0xffff3f3f, 0x3f1d1f1f, 0xffffffff, 0xff3d3f3f,
+	0xffffffff, 0xfcfcfcff, 0x00000000, 0x00000000, 0xffffffff, 0xf1f1f1ff, 0xffffffff, 0xe3e1e3ff,
+	0xffffffff, 0xc7c5c7ff, 0xffffffff, 0x8f8d8fff, 0xffffffff, 0x1f1d1fff, 0xffffffff, 0x3f3d3fff,
+	0xffffffff, 0xfcfcffff, 0xffffffff, 0xf8f8ffff, 0xffffffff, 0xf1f1ffff, 0xffffffff, 0xe3e1ffff,
+	0xffffffff, 0xc7c5ffff, 0xffffffff, 0x8f8dffff, 0xffffffff, 0x1f1dffff, 0xffffffff, 0x3f3dffff,
+	0x1f1f0404, 0x001d1f1f, 0x1f1f0000, 0x001d1f1f, 0x1f1f0101, 0x001d1f1f, 0x1f1f0303, 0x001d1f1f,
+	0x1f1f0707, 0x031d1f1f, 0x3f3f0f0f, 0x0f3d3f3f, 0x7f7f1f1f, 0x1f7d7f7f, 0xffff3f3f, 0x3ffdffff,
+	0x0f040400, 0x00000f0f, 0x0f000000, 0x00000f0f, 0x0f010100, 0x00000f0f, 0x0f030300, 0x00010f0f,
+	0x1f070700, 0x03051f1f, 0x3f0f0f00, 0x0f0d3f3f, 0x7f1f1f1f, 0x1f1d7f7f, 0xff3f3f3f, 0x3f3dffff,
+	0x04040000, 0x00000407, 0x00000000, 0x00000007, 0x01010000, 0x00000107, 0x03030000, 0x0001030f,
+	0x07070000, 0x0305071f, 0x0f0f0f00, 0x0f0d0f3f, 0x1f1f1f1f, 0x1f1d1f7f, 0x3f3f3f3f, 0x3f3dbfff,
+	0x04000000, 0x00000504, 0x00000000, 0x00000200, 0x01000000, 0x00000501, 0x03000000, 0x00010b03,
+	0x07070000, 0x03051707, 0x0f0f0f00, 0x0f0d2f0f, 0x1f1f1f1f, 0x1f1d5f1f, 0x3f3f3f3f, 0x3f3dbf3f,
+	0x00000000, 0x00000404, 0x00000000, 0x00000000, 0x00000000, 0x00000101, 0x03000000, 0x00010303,
+	0x07070000, 0x03050707, 0x0f0f0f00, 0x0f0d0f0f, 0x1f1f1f1f, 0x1f1d1f1f, 0x3f3f3f3f, 0x3f3d3f3f,
+	0x00000000, 0x00000400, 0x00000000, 0x00000000, 0x00000000, 0x00000100, 0x0f000000, 0x00010303,
+	0x1f070000, 0x03050707, 0x3f0f0f00, 0x0f0d0f0f, 0x7f1f1f1f, 0x1f1d1f1f, 0xff3f3f3f, 0x3f3d3f3f,
+	0x00000000, 0x00040400, 0x00000000, 0x00000000, 0x00000000, 0x00010100, 0x1f1f0000, 0x0301031f,
+	0x1f1f0000, 0x0305071f, 0x3f3f0f00, 0x0f0d0f3f, 0x7f7f1f1f, 0x1f1d1f7f, 0xffff3f3f, 0x3f3d3fff,
+	0x00000000, 0x04040700, 0x00000000, 0x00000700, 0x00000000, 0x01010700, 0xffffffff, 0xe3e1ffff,
+	0xffffffff, 0xc7c5ffff, 0xffffffff, 0x8f8dffff, 0xffffffff, 0x1f1dffff, 0xffffffff, 0x3f3dffff,
+	0x7f7f7c3c, 0x7f7b7f7f, 0x7f7f7818, 0x7f7b7f7f, 0x7f7f7100, 0x7f7b7f7f, 0x7f7f6303, 0x7f7b7f7f,
+	0x7f7f4707, 0x7f7b7f7f, 0x7f7f0f0f, 0x7f7b7f7f, 0xffff1f1f, 0xfffbffff, 0xffff3f3f, 0xfffbffff,
+	0x3f3c3c3c, 0x3c3b3f3f, 0x3f381818, 0x003b3f3f, 0x3f310000, 0x003b3f3f, 0x3f230303, 0x003b3f3f,
+	0x3f070707, 0x073b3f3f, 0x7f0f0f0f, 0x1f7b7f7f, 0xff1f1f1f, 0x3ffbffff, 0xff3f3f3f, 0x7ffbffff,
+	0x3c3c3c00, 0x3c3a3f3f, 0x18181800, 0x00181f1f, 0x11000000, 0x00001f1f, 0x03030300, 0x00031f1f,
+	0x07070700, 0x070b3f3f, 0x0f0f0f00, 0x1f1b7f7f, 0x1f1f1f3f, 0x3f3bffff, 0x3f3f3f7f, 0x7f7bffff,
+	0x3c3c0000, 0x3c3b3e3c, 0x18180000, 0x001b1d18, 0x00000000, 0x000a0a00, 0x03030000, 0x001b1703,
+	0x07070000, 0x073b2f07, 0x0f0f1f00, 0x1f7b5f0f, 0x1f1f3f3f, 0x3ffbbf1f, 0x3f3f7f7f, 0x7ffb7f3f,
+	0x3c3e0000, 0x3c3a3c3c, 0x18000000, 0x00181818, 0x00000000, 0x00000000, 0x03000000, 0x00030303,
+	0x070f0000, 0x070b0707, 0x0f1f1f00, 0x1f1b0f0f, 0x1f3f3f3f, 0x3f3b1f1f, 0x3f7f7f7f, 0x7f7b3f3f,
+	0x3f3f0000, 0x3c383c3c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x3f3f0000, 0x07030707, 0x7f7f1f00, 0x1f0b0f0f, 0xffff3f3f, 0x3f1b1f1f, 0xffff7f7f, 0x7f3b3f3f,
+	0xffffffff, 0xfcf8fcff, 0xffffffff, 0xf8f8f8ff, 0x00000000, 0x00000000, 0xffffffff, 0xe3e3e3ff,
+	0xffffffff, 0xc7c3c7ff, 0xffffffff, 0x8f8b8fff, 0xffffffff, 0x1f1b1fff, 0xffffffff, 0x3f3b3fff,
+	0xffffffff, 0xfcf8ffff, 0xffffffff, 0xf8f8ffff, 0xffffffff, 0xf1f1ffff, 0xffffffff, 0xe3e3ffff,
+	0xffffffff, 0xc7c3ffff, 0xffffffff, 0x8f8bffff, 0xffffffff, 0x1f1bffff, 0xffffffff, 0x3f3bffff,
+	0x3f3f1c1c, 0x003b3f3f, 0x3f3f0808, 0x003b3f3f, 0x3f3f0000, 0x003b3f3f, 0x3f3f0202, 0x003b3f3f,
+	0x3f3f0707, 0x003b3f3f, 0x3f3f0f0f, 0x073b3f3f, 0x7f7f1f1f, 0x1f7b7f7f, 0xffff3f3f, 0x3ffbffff,
+	0x1f1c1c00, 0x00181f1f, 0x1f080800, 0x00001f1f, 0x1f000000, 0x00001f1f, 0x1f020200, 0x00001f1f,
+	0x1f070700, 0x00031f1f, 0x3f0f0f00, 0x070b3f3f, 0x7f1f1f00, 0x1f1b7f7f, 0xff3f3f3f, 0x3f3bffff,
+	0x1c1c0000, 0x00181c1f, 0x08080000, 0x0000080e, 0x00000000, 0x0000000e, 0x02020000, 0x0000020e,
+	0x07070000, 0x0003071f, 0x0f0f0000, 0x070b0f3f, 0x1f1f1f00, 0x1f1b1f7f, 0x3f3f3f3f, 0x3f3b3fff,
+	0x1c000000, 0x00181d1c, 0x08000000, 0x00000a08, 0x00000000, 0x00000400, 0x02000000, 0x00000a02,
+	0x07000000, 0x00031707, 0x0f0f0000, 0x070b2f0f, 0x1f1f1f00, 0x1f1b5f1f, 0x3f3f3f3f, 0x3f3bbf3f,
+	0x1c000000, 0x00181c1c, 0x00000000, 0x00000808, 0x00000000, 0x00000000, 0x00000000, 0x00000202,
+	0x07000000, 0x00030707, 0x0f0f0000, 0x070b0f0f, 0x1f1f1f00, 0x1f1b1f1f, 0x3f3f3f3f, 0x3f3b3f3f,
+	0x1f000000, 0x00181c1c, 0x00000000, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000200,
+	0x1f000000, 0x00030707, 0x3f0f0000, 0x070b0f0f, 0x7f1f1f00, 0x1f1b1f1f, 0xff3f3f3f, 0x3f3b3f3f,
+	0x3f3f0000, 0x3c383c3f, 0x00000000, 0x00080800, 0x00000000, 0x00000000, 0x00000000, 0x00020200,
+	0x3f3f0000, 0x0703073f, 0x3f3f0000, 0x070b0f3f, 0x7f7f1f00, 0x1f1b1f7f, 0xffff3f3f, 0x3f3b3fff,
+	0xffffffff, 0xfcf8ffff, 0x00000000, 0x08080e00, 0x00000000, 0x00000e00, 0x00000000, 0x02020e00,
+	0xffffffff, 0xc7c3ffff, 0xffffffff, 0x8f8bffff, 0xffffffff, 0x1f1bffff, 0xffffffff, 0x3f3bffff,
+	0xfffffcfc, 0xfff7ffff, 0xfffff878, 0xfff7ffff, 0xfffff130, 0xfff7ffff, 0xffffe300, 0xfff7ffff,
+	0xffffc706, 0xfff7ffff, 0xffff8f0f, 0xfff7ffff, 0xffff1f1f, 0xfff7ffff, 0xffff3f3f, 0xfff7ffff,
+	0xfffcfcfc, 0xfef7ffff, 0x7f787878, 0x78777f7f, 0x7f713030, 0x00777f7f, 0x7f630000, 0x00777f7f,
+	0x7f470606, 0x00777f7f, 0x7f0f0f0f, 0x0f777f7f, 0xff1f1f1f, 0x3ff7ffff, 0xff3f3f3f, 0x7ff7ffff,
+	0xfcfcfc00, 0xfef6ffff, 0x78787800, 0x78747f7f, 0x30303000, 0x00303e3e, 0x22000000, 0x00003e3e,
+	0x06060600, 0x00063e3e, 0x0f0f0f00, 0x0f177f7f, 0x1f1f1f00, 0x3f37ffff, 0x3f3f3f7f, 0x7f77ffff,
+	0xfcfcfe00, 0xfef7fefc, 0x78780000, 0x78777d78, 0x30300000, 0x00363a30, 0x00000000, 0x00141400,
+	0x06060000, 0x00362e06, 0x0f0f0000, 0x0f775f0f, 0x1f1f3f00, 0x3ff7bf1f, 0x3f3f7f7f, 0x7ff77f3f,
+	0xfcfefe00, 0xfef6fcfc, 0x787c0000, 0x78747878, 0x30000000, 0x00303030, 0x00000000, 0x00000000,
+	0x06000000, 0x00060606, 0x0f1f0000, 0x0f170f0f, 0x1f3f3f00, 0x3f371f1f, 0x3f7f7f7f, 0x7f773f3f,
+	0xfffffe00, 0xfef4fcfc, 0x7f7f0000, 0x78707878, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x7f7f0000, 0x0f070f0f, 0xffff3f00, 0x3f171f1f, 0xffff7f7f, 0x7f373f3f,
+	0xffffffff, 0xfcf4fcff, 0xffffffff, 0xf8f0f8ff, 0xffffffff, 0xf1f1f1ff, 0x00000000, 0x00000000,
+	0xffffffff, 0xc7c7c7ff, 0xffffffff, 0x8f878fff, 0xffffffff, 0x1f171fff, 0xffffffff, 0x3f373fff,
+	0xffffffff, 0xfcf4ffff, 0xffffffff, 0xf8f0ffff, 0xffffffff, 0xf1f1ffff, 0xffffffff, 0xe3e3ffff,
+	0xffffffff, 0xc7c7ffff, 0xffffffff, 0x8f87ffff, 0xffffffff, 0x1f17ffff, 0xffffffff, 0x3f37ffff,
+	0x7f7f7c7c, 0x78777f7f, 0x7f7f3838, 0x00777f7f, 0x7f7f1010, 0x00777f7f, 0x7f7f0000, 0x00777f7f,
+	0x7f7f0404, 0x00777f7f, 0x7f7f0e0e, 0x00777f7f, 0x7f7f1f1f, 0x0f777f7f, 0xffff3f3f, 0x3ff7ffff,
+	0x7f7c7c00, 0x78747f7f, 0x3e383800, 0x00303e3e, 0x3e101000, 0x00003e3e, 0x3e000000, 0x00003e3e,
+	0x3e040400, 0x00003e3e, 0x3e0e0e00, 0x00063e3e, 0x7f1f1f00, 0x0f177f7f, 0xff3f3f00, 0x3f37ffff,
+	0x7c7c0000, 0x78747c7f, 0x38380000, 0x0030383e, 0x10100000, 0x0000101c, 0x00000000, 0x0000001c,
+	0x04040000, 0x0000041c, 0x0e0e0000, 0x00060e3e, 0x1f1f0000, 0x0f171f7f, 0x3f3f3f00, 0x3f373fff,
+	0x7c7c0000, 0x78747d7c, 0x38000000, 0x00303a38, 0x10000000, 0x00001410, 0x00000000, 0x00000800,
+	0x04000000, 0x00001404, 0x0e000000, 0x00062e0e, 0x1f1f0000, 0x0f175f1f, 0x3f3f3f00, 0x3f37bf3f,
+	0x7c7c0000, 0x78747c7c, 0x38000000, 0x00303838, 0x00000000, 0x00001010, 0x00000000, 0x00000000,
+	0x00000000, 0x00000404, 0x0e000000, 0x00060e0e, 0x1f1f0000, 0x0f171f1f, 0x3f3f3f00, 0x3f373f3f,
+	0x7f7c0000, 0x78747c7c, 0x3e000000, 0x00303838, 0x00000000, 0x00001000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000400, 0x3e000000, 0x00060e0e, 0x7f1f0000, 0x0f171f1f, 0xff3f3f00, 0x3f373f3f,
+	0x7f7f0000, 0x78747c7f, 0x7f7f0000, 0x7870787f, 0x00000000, 0x00101000, 0x00000000, 0x00000000,
+	0x00000000, 0x00040400, 0x7f7f0000, 0x0f070f7f, 0x7f7f0000, 0x0f171f7f, 0xffff3f00, 0x3f373fff,
+	0xffffffff, 0xfcf4ffff, 0xffffffff, 0xf8f0ffff, 0x00000000, 0x10101c00, 0x00000000, 0x00001c00,
+	0x00000000, 0x04041c00, 0xffffffff, 0x8f87ffff, 0xffffffff, 0x1f17ffff, 0xffffffff, 0x3f37ffff,
+};
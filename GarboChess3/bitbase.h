@@ -0,0 +1,20 @@
+// King and pawn versus king bitbase, one bit per position telling whether the side with the pawn wins.
+//
+// Positions are indexed with the pawn side playing white and the pawn on files a-d (other positions are mirrored):
+// 64 white king squares x 64 black king squares x 2 sides to move x 24 pawn squares = 196608 bits (24 KB).
+// The table is embedded in the binary, it was written by the kpkgen command from GenerateKpkBitbase.
+const int KpkBitbaseSize = 64 * 64 * 2 * 24 / 32;
+
+extern const u32 KpkBitbase[KpkBitbaseSize];
+
+// Squares as seen by the side with the pawn, which is white here
+bool ProbeKpk(Square whiteKing, Square whitePawn, Square blackKing, const Color toMove);
+
+// Whether position (which must be KPK) is won for the side with the pawn
+bool ProbeKpk(const Position &position);
+
+// Solves KPK by retrograde analysis
+void GenerateKpkBitbase(u32 bitbase[KpkBitbaseSize]);
+
+// Writes a freshly generated table out as C++ source for bitbase.cpp
+bool WriteKpkBitbase(const std::string &filename);
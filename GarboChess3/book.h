@@ -0,0 +1,37 @@
+#include <vector>
+
+// Opening book in the Polyglot .bin layout: 16 byte big endian entries (key, move, weight, learn) sorted by key, so
+// a probe is a binary search of the mapped file.
+//
+// Keys are Polyglot's (the en passant square only counts when a pawn can capture onto it), so books made by other
+// tools work as they are.
+struct BookEntry
+{
+	u64 Key;
+	u16 Move;
+	u16 Weight;
+	u32 Learn;
+};
+
+const int BookEntrySize = 16;
+const int BookMaxMoves = 64;
+
+// Maps a book file, returns false (leaving no book loaded) if it is missing or malformed
+bool LoadBook(const std::string &filename);
+void UnloadBook();
+bool IsBookLoaded();
+
+u64 GetBookKey(const Position &position);
+
+// Polyglot move encoding: to file/rank in bits 0-5, from file/rank in bits 6-11, promotion piece in bits 12-14.
+// Castling is the king taking its own rook.
+u16 GetBookMove(const Move move);
+
+// Every legal book move for position with its weight, returns the number of moves
+int GetBookMoves(Position &position, Move *moves, int *weights);
+
+// Picks a book move with probability proportional to its weight, 0 when out of book
+Move ProbeBook(Position &position);
+
+// Sorts entries (merging duplicate moves by adding their weights) and writes them out
+bool WriteBook(const std::string &filename, std::vector<BookEntry> &entries);
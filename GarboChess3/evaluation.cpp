@@ -3,6 +3,10 @@
 #include "movegen.h"
 #include "evaluation.h"
 #include "search.h"
+#include "nnue.h"
+#include "bitbase.h"
+
+#include <cstdio>
 
 const int EvalFeatureScale = 32;
 
@@ -12,7 +16,7 @@ EVAL_FEATURE(BishopPhaseScale, 1);
 EVAL_FEATURE(RookPhaseScale, 2);
 EVAL_FEATURE(QueenPhaseScale, 4);
 
-EVAL_CONST int gamePhaseMax = (4 * KnightPhaseScale) + (4 * BishopPhaseScale) + (4 * RookPhaseScale) + (2 * QueenPhaseScale);
+EVAL_DERIVED(int, gamePhaseMax, (4 * KnightPhaseScale) + (4 * BishopPhaseScale) + (4 * RookPhaseScale) + (2 * QueenPhaseScale));
 
 EVAL_FEATURE(TempoOpening, 20 * EvalFeatureScale);
 EVAL_FEATURE(TempoEndgame, 10 * EvalFeatureScale);
@@ -60,6 +64,18 @@ EVAL_FEATURE(BishopPairEndgame, 70 * EvalFeatureScale);
 
 EVAL_FEATURE(ExchangePenalty, 30 * EvalFeatureScale);
 
+// Endgame scale factors (out of ScaleFactorNormal), applied to the endgame score of the side that is ahead
+const int ScaleFactorNormal = 64;
+const int ScaleFactorDraw = 0;
+EVAL_FEATURE(ScaleFactorNoPawnsMinorAhead, 4);
+EVAL_FEATURE(ScaleFactorNoPawnsAhead, 14);
+EVAL_FEATURE(ScaleFactorOppositeBishops, 24);
+
+// How far the piece terms (mobility, king attacks, rook files) are assumed to move the score, in centipawns.  This is a
+// heuristic, not a bound: big king attacks can go past it, and the lazy exit then returns a wrong bound.  On WAC
+// positions and their children that happens in about 0.2% of the lazy exits, by at most 90cp.
+const int LazyEvalMargin = 300;
+
 // King attack scoring
 EVAL_FEATURE(KingAttackWeightPawn, 20 * EvalFeatureScale);
 EVAL_FEATURE(KingAttackWeightKnight, 35 * EvalFeatureScale);
@@ -67,6 +83,23 @@ EVAL_FEATURE(KingAttackWeightBishop, 30 * EvalFeatureScale);
 EVAL_FEATURE(KingAttackWeightRook, 60 * EvalFeatureScale);
 EVAL_FEATURE(KingAttackWeightQueen, 120 * EvalFeatureScale);
 
+// Packed versions of the features above
+EVAL_DERIVED(EvalScore, Tempo, ES(TempoOpening, TempoEndgame));
+EVAL_DERIVED(EvalScore, KnightMobility, ES(KnightMobilityOpening, KnightMobilityEndgame));
+EVAL_DERIVED(EvalScore, BishopMobility, ES(BishopMobilityOpening, BishopMobilityEndgame));
+EVAL_DERIVED(EvalScore, RookMobility, ES(RookMobilityOpening, RookMobilityEndgame));
+EVAL_DERIVED(EvalScore, QueenMobility, ES(QueenMobilityOpening, QueenMobilityEndgame));
+EVAL_DERIVED(EvalScore, RookClosedFileScore, ES(-(RookSemiOpenFile + RookOpenFile) / 2, -(RookSemiOpenFile + RookOpenFile) / 2));
+EVAL_DERIVED(EvalScore, RookSemiOpenFileScore, ES(RookSemiOpenFile, RookSemiOpenFile));
+EVAL_DERIVED(EvalScore, RookOpenFileScore, ES(RookOpenFile, RookOpenFile));
+EVAL_DERIVED(EvalScore, DoubledPawn, ES(DoubledPawnOpening, DoubledPawnEndgame));
+EVAL_DERIVED(EvalScore, IsolatedPawn, ES(IsolatedPawnOpening, IsolatedPawnEndgame));
+EVAL_DERIVED(EvalScore, IsolatedOpenFilePawn, ES(IsolatedOpenFilePawnOpening, IsolatedPawnEndgame));
+EVAL_DERIVED(EvalScore, BackwardPawn, ES(BackwardPawnOpening, BackwardPawnEndgame));
+EVAL_DERIVED(EvalScore, BackwardOpenFilePawn, ES(BackwardOpenFilePawnOpening, BackwardPawnEndgame));
+EVAL_DERIVED(EvalScore, BishopPair, ES(BishopPairOpening, BishopPairEndgame));
+EVAL_DERIVED(EvalScore, Exchange, ES(ExchangePenalty, ExchangePenalty));
+
 static const int KingAttackWeightScale[16] =
 {
 	0, 24, 136, 210, 232, 246, 252, 253, 254, 255, 256, 256, 256, 256, 256, 256,
@@ -80,12 +113,29 @@ Bitboard PassedPawnBitboards[64][2];
 Bitboard IsolatedPawnBitboards[64];
 
 void InitializePsqTable();
+#ifdef EVAL_TUNING
+void TracePsqFeatures(const Piece piece, const Square square, const int scale);
+#endif
 
 int RowScoreMultiplier[8];
 
+int PiecePhase[8];
+
+static void InitializeEndgameRecognizers();
+
 void InitializeEvaluation()
 {
 	InitializePsqTable();
+	InitializeEndgameRecognizers();
+
+	for (PieceType piece = PIECE_NONE; piece <= 7; piece++)
+	{
+		PiecePhase[piece] = 0;
+	}
+	PiecePhase[KNIGHT] = KnightPhaseScale;
+	PiecePhase[BISHOP] = BishopPhaseScale;
+	PiecePhase[ROOK] = RookPhaseScale;
+	PiecePhase[QUEEN] = QueenPhaseScale;
 
 	for (Square square = 0; square < 64; square++)
 	{
@@ -155,19 +205,371 @@ void InitializeEvaluation()
 	RowScoreMultiplier[RANK_7] = 256;
 }
 
+#ifdef EVAL_TUNING
+const int MaxEvalParameters = 256;
+
+// Function statics, so registration works no matter which file's static initializers run first
+static EvalParameter &GetEvalParameterStorage(const int index)
+{
+	static EvalParameter parameters[MaxEvalParameters];
+	return parameters[index];
+}
+
+static int &GetEvalParameterCountStorage()
+{
+	static int count;
+	return count;
+}
+
+static void (*&GetEvalDerivedUpdate(const int index))()
+{
+	static void (*updates[MaxEvalParameters])();
+	return updates[index];
+}
+
+static int &GetEvalDerivedCountStorage()
+{
+	static int count;
+	return count;
+}
+
+int RegisterEvalFeature(const char *name, int *value, const int defaultValue)
+{
+	int &count = GetEvalParameterCountStorage();
+	ASSERT(count < MaxEvalParameters);
+
+	EvalParameter &parameter = GetEvalParameterStorage(count++);
+	parameter.Name = name;
+	parameter.Value = value;
+	parameter.Default = defaultValue;
+	return defaultValue;
+}
+
+int RegisterEvalDerived(void (*update)())
+{
+	int &count = GetEvalDerivedCountStorage();
+	ASSERT(count < MaxEvalParameters);
+
+	GetEvalDerivedUpdate(count++) = update;
+	return 0;
+}
+
+int GetEvalParameterCount()
+{
+	return GetEvalParameterCountStorage();
+}
+
+EvalParameter &GetEvalParameter(const int index)
+{
+	ASSERT(index >= 0 && index < GetEvalParameterCount());
+	return GetEvalParameterStorage(index);
+}
+
+bool SetEvalParameter(const std::string &name, const int value)
+{
+	for (int i = 0; i < GetEvalParameterCount(); i++)
+	{
+		if (name == GetEvalParameter(i).Name)
+		{
+			*GetEvalParameter(i).Value = value;
+			return true;
+		}
+	}
+	return false;
+}
+
+void ResetEvalParameters()
+{
+	for (int i = 0; i < GetEvalParameterCount(); i++)
+	{
+		*GetEvalParameter(i).Value = GetEvalParameter(i).Default;
+	}
+}
+
+// "Name Value" lines as written by the tuner, blank lines and lines starting with # are skipped
+bool LoadEvalParameters(const std::string &filename)
+{
+	std::FILE *file = std::fopen(filename.c_str(), "rt");
+	if (file == NULL)
+	{
+		return false;
+	}
+
+	char line[256];
+	while (std::fgets(line, 256, file) != NULL)
+	{
+		char name[256];
+		int value;
+		if (line[0] == '#' || sscanf(line, "%255s %d", name, &value) != 2)
+		{
+			continue;
+		}
+
+		if (!SetEvalParameter(name, value))
+		{
+			printf("info string unknown evaluation parameter %s\n", name);
+		}
+	}
+
+	std::fclose(file);
+	return true;
+}
+#endif
+
+void UpdateEvalParameters()
+{
+#ifdef EVAL_TUNING
+	for (int i = 0; i < GetEvalDerivedCountStorage(); i++)
+	{
+		GetEvalDerivedUpdate(i)();
+	}
+#endif
+
+	// Piece square tables and piece phases are built from the parameters too
+	InitializeEvaluation();
+	ClearEvaluationCaches();
+}
+
 struct PawnHashInfo
 {
 	u64 Lock;
-	int Opening;
-	int Endgame;
+	EvalScore Value;
 	int Kingside[2], Center[2], Queenside[2];
 	u8 Passed[2];
-	u8 Count[2];
 };
 
-// TODO: need to make these thread independent
 const int PawnHashMask = (1 << 10) - 1;
-PawnHashInfo PawnHash[PawnHashMask + 1];
+EVAL_CACHE_STORAGE PawnHashInfo PawnHash[PawnHashMask + 1];
+
+const int MaterialFlagsDraw = 1;
+const int MaterialFlagsOppositeBishops = 2;
+
+// Material signatures with their own evaluation, see the recognizer table
+enum EndgameType
+{
+	EndgameNone,
+	EndgameDraw,
+	EndgameKXK,			// Rook or queen against a lone king, drive the king to the edge
+	EndgameKBNK,		// Drive the king to a corner of the bishop's color
+	EndgameKPK,			// Exact, from the bitbase
+};
+
+struct MaterialHashInfo
+{
+	u64 Lock;
+	EvalScore Value;
+	int GamePhase;
+	u8 ScaleFactor[2];
+	u8 Flags;
+	u8 Endgame;
+	u8 StrongSide;
+};
+
+struct EndgameRecognizer
+{
+	u64 Signature;
+	EndgameType Type;
+	Color StrongSide;
+};
+
+const int MaxEndgameRecognizers = 32;
+static EndgameRecognizer EndgameRecognizers[MaxEndgameRecognizers];
+static int EndgameRecognizerCount;
+
+// Registers pieces ("KBNK", the strong side first) for both colors
+static void AddEndgameRecognizer(const std::string &pieces, const EndgameType type)
+{
+	const size_t weakKing = pieces.find('K', 1);
+	const std::string mirrored = pieces.substr(weakKing) + pieces.substr(0, weakKing);
+
+	for (Color color = WHITE; color <= BLACK; color++)
+	{
+		if (color == BLACK && mirrored == pieces)
+		{
+			break;
+		}
+
+		ASSERT(EndgameRecognizerCount < MaxEndgameRecognizers);
+		EndgameRecognizer &recognizer = EndgameRecognizers[EndgameRecognizerCount++];
+		recognizer.Signature = Position::GetMaterialSignature(color == WHITE ? pieces : mirrored);
+		recognizer.Type = type;
+		recognizer.StrongSide = color;
+	}
+}
+
+static void InitializeEndgameRecognizers()
+{
+	EndgameRecognizerCount = 0;
+
+	// Nobody can force mate
+	AddEndgameRecognizer("KK", EndgameDraw);
+	AddEndgameRecognizer("KNK", EndgameDraw);
+	AddEndgameRecognizer("KBK", EndgameDraw);
+	AddEndgameRecognizer("KNNK", EndgameDraw);
+	AddEndgameRecognizer("KNKN", EndgameDraw);
+	AddEndgameRecognizer("KBKB", EndgameDraw);
+	AddEndgameRecognizer("KBKN", EndgameDraw);
+
+	// Known wins
+	AddEndgameRecognizer("KRK", EndgameKXK);
+	AddEndgameRecognizer("KQK", EndgameKXK);
+	AddEndgameRecognizer("KBNK", EndgameKBNK);
+
+	// Won or drawn, the bitbase knows which
+	AddEndgameRecognizer("KPK", EndgameKPK);
+}
+
+const int MaterialHashMask = (1 << 9) - 1;
+EVAL_CACHE_STORAGE MaterialHashInfo MaterialHash[MaterialHashMask + 1];
+
+// Full evaluations keyed by position hash.  The lock is stored xor'd with the data, so an entry torn by
+// another thread writing at the same time just looks like a miss.
+struct EvalCacheEntry
+{
+	u64 Lock;
+	u64 Data;
+};
+
+const int EvalCacheMask = (1 << 15) - 1;
+EVAL_CACHE_STORAGE EvalCacheEntry EvalCache[EvalCacheMask + 1];
+
+EVAL_CACHE_STORAGE u64 EvalCacheProbes;
+EVAL_CACHE_STORAGE u64 EvalCacheHits;
+
+void ClearEvaluationCaches()
+{
+	// Locks that no position hashes to, a zero pawn hash is a real (pawnless) key
+	for (int i = 0; i <= PawnHashMask; i++)
+	{
+		PawnHash[i].Lock = ~0ULL;
+	}
+	for (int i = 0; i <= MaterialHashMask; i++)
+	{
+		MaterialHash[i].Lock = ~0ULL;
+	}
+	memset(EvalCache, 0, sizeof(EvalCache));
+	EvalCacheProbes = 0;
+	EvalCacheHits = 0;
+}
+
+// Evaluation terms, as reported by the eval command.  Each side's terms are recorded from its own point of view.
+enum EvalTerm
+{
+	EvalTermPsq,
+	EvalTermTempo,
+	EvalTermImbalance,
+	EvalTermPawnStructure,
+	EvalTermPassedPawns,
+	EvalTermCandidatePawns,
+	EvalTermShelter,
+	EvalTermKnightMobility,
+	EvalTermBishopMobility,
+	EvalTermRookMobility,
+	EvalTermQueenMobility,
+	EvalTermRookFiles,
+	EvalTermKingAttack,
+	EvalTermCount
+};
+
+static const char *EvalTermNames[EvalTermCount] =
+{
+	"Material/PSQ", "Tempo", "Imbalance", "Pawn structure", "Passed pawns", "Candidate pawns", "Pawn shelter",
+	"Knight mobility", "Bishop mobility", "Rook mobility", "Queen mobility", "Rook files", "King attack",
+};
+
+static THREAD_LOCAL EvalScore TraceScores[EvalTermCount][2];
+
+// Compiles away unless the evaluation is instantiated for tracing
+template<bool trace>
+inline void TraceTerm(const EvalTerm term, const Color color, const EvalScore score)
+{
+	if (trace)
+	{
+		TraceScores[term][color] += score;
+	}
+}
+
+#ifdef EVAL_TUNING
+// The parameters, and the pawn shelter
+const int MaxEvalFeatures = MaxEvalParameters + 1;
+
+// How much of each feature went into the opening and endgame scores, white's counts minus black's
+static THREAD_LOCAL float TraceFeatureCounts[MaxEvalFeatures][2];
+
+void AddEvalFeatureCount(const int feature, const Color color, const float opening, const float endgame)
+{
+	ASSERT(feature >= 0 && feature < GetEvalFeatureCount());
+	const float multiplier = color == WHITE ? 1.0f : -1.0f;
+	TraceFeatureCounts[feature][0] += opening * multiplier;
+	TraceFeatureCounts[feature][1] += endgame * multiplier;
+}
+#endif
+
+// Traced evaluations also count the features behind each term, for feature extraction (tuning builds only)
+template<bool trace>
+inline void TraceFeature(const int feature, const Color color, const float opening, const float endgame)
+{
+#ifdef EVAL_TUNING
+	if (trace)
+	{
+		AddEvalFeatureCount(feature, color, opening, endgame);
+	}
+#endif
+}
+
+// Profiling builds (EVAL_PROFILE) count the cycles spent in the parts of the evaluation.  Not thread safe, profile
+// single threaded.
+enum EvalProfileSection
+{
+	EvalProfileEvaluate,
+	EvalProfileMaterial,
+	EvalProfileProbePawnHash,
+	EvalProfileEvalPawns,
+	EvalProfileEvalPassed,
+	EvalProfileShelter,
+	EvalProfileEvalPieces,
+	EvalProfileSectionCount
+};
+
+#ifdef EVAL_PROFILE
+static const char *EvalProfileNames[EvalProfileSectionCount] =
+{
+	"Evaluate", "ProbeMaterialHash", "ProbePawnHash", "  EvalPawns", "EvalPassed", "Shelter", "EvalPieces",
+};
+
+static u64 EvalProfileCycles[EvalProfileSectionCount];
+static u64 EvalProfileCalls[EvalProfileSectionCount];
+
+#define EVAL_PROFILE_BEGIN(section) const u64 section##Start = GetCycleCount();
+#define EVAL_PROFILE_END(section) EvalProfileCycles[section] += GetCycleCount() - section##Start; EvalProfileCalls[section]++;
+#else
+#define EVAL_PROFILE_BEGIN(section)
+#define EVAL_PROFILE_END(section)
+#endif
+
+void ClearEvalProfile()
+{
+#ifdef EVAL_PROFILE
+	memset(EvalProfileCycles, 0, sizeof(EvalProfileCycles));
+	memset(EvalProfileCalls, 0, sizeof(EvalProfileCalls));
+#endif
+}
+
+void PrintEvalProfile()
+{
+#ifdef EVAL_PROFILE
+	const u64 total = max(1ULL, EvalProfileCycles[EvalProfileEvaluate]);
+	printf("%-20s %14s %12s %10s %7s\n", "Section", "Cycles", "Calls", "Cycles/call", "Share");
+	for (int i = 0; i < EvalProfileSectionCount; i++)
+	{
+		printf("%-20s %14llu %12llu %10.1f %6.1f%%\n",
+			EvalProfileNames[i], EvalProfileCycles[i], EvalProfileCalls[i],
+			double(EvalProfileCycles[i]) / max(1ULL, EvalProfileCalls[i]), (EvalProfileCycles[i] * 100.0) / total);
+	}
+#else
+	printf("Evaluation profiling needs a build with EVAL_PROFILE defined\n");
+#endif
+}
 
 template<Color color>
 int GetMultiplier()
@@ -185,6 +587,12 @@ int RowScoreScale(const int scoreMin, const int scoreMax, const int row)
 	return scoreMin + ((scoreMax - scoreMin) * RowScoreMultiplier[row] + 128) / 256;
 }
 
+// How much of scoreMax goes into RowScoreScale, the rest is scoreMin
+inline float GetRowScoreFraction(const int row)
+{
+	return RowScoreMultiplier[row] / 256.0f;
+}
+
 template<Color color>
 inline int PawnRow(const int row)
 {
@@ -198,99 +606,172 @@ inline int ShelterPenalty(const int row)
 	return inverted * inverted;
 }
 
-template<Color color, int multiplier>
+// Set-wise pawn helpers.  Forward is towards the promotion rank of color, which is decreasing rows for white.
+const Bitboard FileABitboard = 0x0101010101010101ULL;
+const Bitboard FileHBitboard = FileABitboard << 7;
+
+inline Bitboard ShiftEast(const Bitboard b)
+{
+	return (b << 1) & ~FileABitboard;
+}
+
+inline Bitboard ShiftWest(const Bitboard b)
+{
+	return (b >> 1) & ~FileHBitboard;
+}
+
+template<Color color>
+inline Bitboard ShiftForward(const Bitboard b)
+{
+	return color == WHITE ? b >> 8 : b << 8;
+}
+
+// Includes the starting squares
+template<Color color>
+inline Bitboard FillForward(Bitboard b)
+{
+	if (color == WHITE)
+	{
+		b |= b >> 8;
+		b |= b >> 16;
+		b |= b >> 32;
+	}
+	else
+	{
+		b |= b << 8;
+		b |= b << 16;
+		b |= b << 32;
+	}
+	return b;
+}
+
+// Squares strictly in front of the pieces in b
+template<Color color>
+inline Bitboard FrontSpan(const Bitboard b)
+{
+	return FillForward<color>(ShiftForward<color>(b));
+}
+
+// Squares strictly behind the pieces in b
+template<Color color>
+inline Bitboard RearSpan(const Bitboard b)
+{
+	return FrontSpan<color ^ 1>(b);
+}
+
+template<Color color, int multiplier, bool trace>
 void EvalPawns(const Position &position, PawnHashInfo &pawnScores)
 {
 	const Color them = FlipColor(color);
-	const Bitboard ourPieces = position.Colors[color];
 	const Bitboard allPawns = position.Pieces[PAWN];
 	const Bitboard theirPawns = allPawns & position.Colors[them];
-	const Bitboard ourPawns = allPawns & ourPieces;
+	const Bitboard ourPawns = allPawns & position.Colors[color];
 
 	pawnScores.Passed[color] = 0;
-	pawnScores.Count[color] = 0;
 
-	int shelter[8];
-	for (int i = 0; i < 8; i++)
+	// Classify all of our pawns at once
+	const Bitboard ourSides = ShiftEast(ourPawns) | ShiftWest(ourPawns);
+	const Bitboard ourFiles = FillForward<color>(ourPawns) | FillForward<color ^ 1>(ourPawns);
+
+	// No pawns in front of us on our file
+	const Bitboard openFile = ourPawns & ~RearSpan<color>(allPawns);
+	// No enemy pawns in front of us on our file, or the two neighboring files
+	const Bitboard passed = ourPawns & ~RearSpan<color>(theirPawns | ShiftEast(theirPawns) | ShiftWest(theirPawns));
+	// One of our pawns in front of us on our file
+	const Bitboard doubled = ourPawns & RearSpan<color>(ourPawns);
+	// None of our pawns on the neighboring files
+	const Bitboard isolated = ourPawns & ~(ShiftEast(ourFiles) | ShiftWest(ourFiles));
+	// No pawns beside or behind us that could support an advance, but pawns in front of us on our file or the neighboring files
+	const Bitboard supported = FillForward<color>(ourSides) | FrontSpan<color>(ourPawns);
+	const Bitboard backward = ourPawns & ~supported & RearSpan<color>(ourPawns | ourSides);
+
+	const EvalScore structure =
+		CountBitsSetFew(doubled) * DoubledPawn +
+		CountBitsSetFew(isolated & openFile) * IsolatedOpenFilePawn +
+		CountBitsSetFew(isolated & ~openFile) * IsolatedPawn +
+		CountBitsSetFew(backward & openFile) * BackwardOpenFilePawn +
+		CountBitsSetFew(backward & ~openFile) * BackwardPawn;
+	pawnScores.Value += multiplier * structure;
+	TraceTerm<trace>(EvalTermPawnStructure, color, structure);
+
+	if (trace)
 	{
-		shelter[i] = ShelterPenalty(RANK_7);
+		const int doubledCount = CountBitsSetFew(doubled);
+		const int isolatedOpenCount = CountBitsSetFew(isolated & openFile);
+		const int isolatedCount = CountBitsSetFew(isolated & ~openFile);
+		const int backwardOpenCount = CountBitsSetFew(backward & openFile);
+		const int backwardCount = CountBitsSetFew(backward & ~openFile);
+		TraceFeature<trace>(DoubledPawnOpeningIndex, color, doubledCount, 0);
+		TraceFeature<trace>(DoubledPawnEndgameIndex, color, 0, doubledCount);
+		TraceFeature<trace>(IsolatedOpenFilePawnOpeningIndex, color, isolatedOpenCount, 0);
+		TraceFeature<trace>(IsolatedPawnOpeningIndex, color, isolatedCount, 0);
+		TraceFeature<trace>(IsolatedPawnEndgameIndex, color, 0, isolatedOpenCount + isolatedCount);
+		TraceFeature<trace>(BackwardOpenFilePawnOpeningIndex, color, backwardOpenCount, 0);
+		TraceFeature<trace>(BackwardPawnOpeningIndex, color, backwardCount, 0);
+		TraceFeature<trace>(BackwardPawnEndgameIndex, color, 0, backwardOpenCount + backwardCount);
 	}
 
-	Bitboard b = ourPawns;
+	// Rank dependent terms are scored per pawn
+	Bitboard b = passed;
 	while (b)
 	{
 		const Square square = PopFirstBit(b);
 		const int row = PawnRow<color>(GetRow(square));
-		const Square pushSquare = GetFirstBitIndex(GetPawnMoves(square, color));
 
-		bool openFile = false;
+		pawnScores.Passed[color] |= 1 << GetColumn(square);
 
-		pawnScores.Count[color]++;
+		int score = RowScoreScale(PassedPawnOpeningMin, PassedPawnOpeningMax, row);
+		if (!IsBitSet(openFile, square)) score /= 2;
 
-		if ((PawnGreaterBitboards[square][color] & allPawns) == 0)
-		{
-			openFile = true;
-		}
+		pawnScores.Value += multiplier * ES(score, 0);
+		TraceTerm<trace>(EvalTermPassedPawns, color, ES(score, 0));
 
-		const Bitboard blockingPawns = PassedPawnBitboards[square][color] & theirPawns;
-		if (blockingPawns == 0)
-		{
-			// Passed pawn
-			pawnScores.Passed[color] |= 1 << GetColumn(square);
+		const float scale = IsBitSet(openFile, square) ? 1.0f : 0.5f;
+		TraceFeature<trace>(PassedPawnOpeningMinIndex, color, (1 - GetRowScoreFraction(row)) * scale, 0);
+		TraceFeature<trace>(PassedPawnOpeningMaxIndex, color, GetRowScoreFraction(row) * scale, 0);
+	}
 
-			int score = RowScoreScale(PassedPawnOpeningMin, PassedPawnOpeningMax, row);
-			if (!openFile) score /= 2;
+	b = openFile & ~passed;
+	while (b)
+	{
+		// Candidate passer
+		const Square square = PopFirstBit(b);
+		const int row = PawnRow<color>(GetRow(square));
+		const Square pushSquare = GetFirstBitIndex(GetPawnMoves(square, color));
 
-			pawnScores.Opening += multiplier * score;
-		}
-		else if (openFile)
+		const Bitboard blockingPawns = PassedPawnBitboards[square][color] & theirPawns;
+		const Bitboard supportingPawns = PassedPawnBitboards[pushSquare][them] & ~PawnLessBitboards[pushSquare][color] & ourPawns;
+		if (CountBitsSetFew(blockingPawns) <= CountBitsSetFew(supportingPawns))
 		{
-			// Candidate passer
-			int count = CountBitsSetFew(blockingPawns);
-			const Bitboard supportingPawns = PassedPawnBitboards[pushSquare][them] & ~PawnLessBitboards[pushSquare][color] & ourPawns;
-			if (count <= CountBitsSetFew(supportingPawns))
+			// Potential candidate.  Now, check if it is being attacked
+			if (CountBitsSetFew(GetPawnAttacks(square, them) & ourPawns) - CountBitsSetFew(GetPawnAttacks(square, color) & theirPawns) >= 0)
 			{
-				// Potential candidate.  Now, check if it is being attacked
-				if (CountBitsSetFew(GetPawnAttacks(square, them) & ourPawns) - CountBitsSetFew(GetPawnAttacks(square, color) & theirPawns) >= 0)
-				{
-					pawnScores.Opening += multiplier * RowScoreScale(CandidatePawnOpeningMin, CandidatePawnOpeningMax, row);
-					pawnScores.Endgame += multiplier * RowScoreScale(CandidatePawnEndgameMin, CandidatePawnEndgameMax, row);
-				}
+				const EvalScore candidate = ES(
+					RowScoreScale(CandidatePawnOpeningMin, CandidatePawnOpeningMax, row),
+					RowScoreScale(CandidatePawnEndgameMin, CandidatePawnEndgameMax, row));
+				pawnScores.Value += multiplier * candidate;
+				TraceTerm<trace>(EvalTermCandidatePawns, color, candidate);
+
+				TraceFeature<trace>(CandidatePawnOpeningMinIndex, color, 1 - GetRowScoreFraction(row), 0);
+				TraceFeature<trace>(CandidatePawnOpeningMaxIndex, color, GetRowScoreFraction(row), 0);
+				TraceFeature<trace>(CandidatePawnEndgameMinIndex, color, 0, 1 - GetRowScoreFraction(row));
+				TraceFeature<trace>(CandidatePawnEndgameMaxIndex, color, 0, GetRowScoreFraction(row));
 			}
 		}
+	}
 
-		if ((PawnGreaterBitboards[square][color] & ourPawns) != 0)
-		{
-			// Doubled pawn
-			pawnScores.Opening += multiplier * DoubledPawnOpening;
-			pawnScores.Endgame += multiplier * DoubledPawnEndgame;
-		}
-
-		if ((IsolatedPawnBitboards[square] & ourPawns) == 0)
-		{
-			// Isolated
-			pawnScores.Opening += multiplier * (openFile ? IsolatedOpenFilePawnOpening : IsolatedPawnOpening);
-			pawnScores.Endgame += multiplier * IsolatedPawnEndgame;
-		}
-
-		// Backward pawns
-		Bitboard supportingPawns = PassedPawnBitboards[pushSquare][them] & ourPawns;
-		XorClearBit(supportingPawns, square);
-		if (supportingPawns == 0)
-		{
-			// Only backward if there is a pawn in a neigboring file ahead of us.
-			if (PassedPawnBitboards[square][color] & ourPawns)
-			{
-				pawnScores.Opening += multiplier * (openFile ? BackwardOpenFilePawnOpening : BackwardPawnOpening);
-				pawnScores.Endgame += multiplier * BackwardPawnEndgame;
-			}
-		}
+	// Pawn shelter is given by our pawn closest to our home rank on each file
+	int shelter[8];
+	for (int i = 0; i < 8; i++)
+	{
+		shelter[i] = ShelterPenalty(RANK_7);
+	}
 
-		if ((PawnLessBitboards[square][color] & ourPawns) == 0)
-		{
-			// Pawn shelter pawn, as its the closest to our home rank
-			shelter[GetColumn(square)] = ShelterPenalty(row);
-		}
+	b = ourPawns & ~FrontSpan<color>(ourPawns);
+	while (b)
+	{
+		const Square square = PopFirstBit(b);
+		shelter[GetColumn(square)] = ShelterPenalty(PawnRow<color>(GetRow(square)));
 	}
 
 	// Kingside pawn shelter
@@ -315,17 +796,125 @@ void ProbePawnHash(const Position &position, PawnHashInfo *&pawnScores)
 	}
 
 	pawnScores->Lock = position.PawnHash;
-	pawnScores->Opening = 0;
-	pawnScores->Endgame = 0;
+	pawnScores->Value = 0;
+
+	EVAL_PROFILE_BEGIN(EvalProfileEvalPawns);
+	EvalPawns<WHITE, 1, false>(position, *pawnScores);
+	EvalPawns<BLACK, -1, false>(position, *pawnScores);
+	EVAL_PROFILE_END(EvalProfileEvalPawns);
+}
+
+// Rough non-pawn material in pawn units, only used to classify material signatures
+inline int GetNonPawnMaterial(const Position &position, const Color color)
+{
+	return 3 * (position.PieceCount[color][KNIGHT] + position.PieceCount[color][BISHOP]) +
+		5 * position.PieceCount[color][ROOK] +
+		9 * position.PieceCount[color][QUEEN];
+}
+
+template<bool trace>
+void EvalMaterial(const Position &position, MaterialHashInfo &materialInfo)
+{
+	materialInfo.Value = 0;
+	materialInfo.Flags = 0;
+
+	// Goes from gamePhaseMax at opening to 0 at endgame
+	materialInfo.GamePhase = min(position.GamePhase[WHITE] + position.GamePhase[BLACK], gamePhaseMax);
+
+	for (Color color = WHITE; color <= BLACK; color++)
+	{
+		const Color them = FlipColor(color);
+		const int multiplier = GetMultiplier(color);
+
+		if (position.PieceCount[color][BISHOP] >= 2)
+		{
+			materialInfo.Value += BishopPair * multiplier;
+			TraceTerm<trace>(EvalTermImbalance, color, BishopPair);
+			TraceFeature<trace>(BishopPairOpeningIndex, color, 1, 0);
+			TraceFeature<trace>(BishopPairEndgameIndex, color, 0, 1);
+		}
+
+		// Exchange penalty
+		if (position.GamePhase[color] > position.GamePhase[them] &&
+			position.PieceCount[them][PAWN] > position.PieceCount[color][PAWN])
+		{
+			materialInfo.Value += Exchange * multiplier;
+			TraceTerm<trace>(EvalTermImbalance, color, Exchange);
+			TraceFeature<trace>(ExchangePenaltyIndex, color, 1, 1);
+		}
+
+		// Without pawns, being up at most a minor piece is rarely enough to win
+		materialInfo.ScaleFactor[color] = ScaleFactorNormal;
+
+		const int ourMaterial = GetNonPawnMaterial(position, color);
+		const int theirMaterial = GetNonPawnMaterial(position, them);
+		if (position.PieceCount[color][PAWN] == 0 && ourMaterial - theirMaterial <= 3)
+		{
+			if (ourMaterial < 5)
+			{
+				materialInfo.ScaleFactor[color] = ScaleFactorDraw;
+			}
+			else
+			{
+				materialInfo.ScaleFactor[color] = theirMaterial <= 3 ? ScaleFactorNoPawnsMinorAhead : ScaleFactorNoPawnsAhead;
+			}
+		}
+	}
+
+	materialInfo.Endgame = EndgameNone;
+	for (int i = 0; i < EndgameRecognizerCount; i++)
+	{
+		if (EndgameRecognizers[i].Signature == position.MaterialHash)
+		{
+			materialInfo.Endgame = EndgameRecognizers[i].Type;
+			materialInfo.StrongSide = EndgameRecognizers[i].StrongSide;
+			if (materialInfo.Endgame == EndgameDraw)
+			{
+				materialInfo.ScaleFactor[WHITE] = ScaleFactorDraw;
+				materialInfo.ScaleFactor[BLACK] = ScaleFactorDraw;
+			}
+			break;
+		}
+	}
 
-	EvalPawns<WHITE, 1>(position, *pawnScores);
-	EvalPawns<BLACK, -1>(position, *pawnScores);
+	if (materialInfo.ScaleFactor[WHITE] == ScaleFactorDraw && materialInfo.ScaleFactor[BLACK] == ScaleFactorDraw)
+	{
+		materialInfo.Flags |= MaterialFlagsDraw;
+	}
+
+	// A single bishop each and nothing else, drawish if they turn out to be on opposite colors
+	if (position.PieceCount[WHITE][BISHOP] == 1 && position.PieceCount[BLACK][BISHOP] == 1 &&
+		position.GamePhase[WHITE] == BishopPhaseScale && position.GamePhase[BLACK] == BishopPhaseScale)
+	{
+		materialInfo.Flags |= MaterialFlagsOppositeBishops;
+	}
+}
+
+void ProbeMaterialHash(const Position &position, MaterialHashInfo *&materialInfo)
+{
+	int index = position.MaterialHash & MaterialHashMask;
+	materialInfo = MaterialHash + index;
+
+	if (materialInfo->Lock == position.MaterialHash)
+	{
+		// We are done
+		return;
+	}
+
+	materialInfo->Lock = position.MaterialHash;
+
+	EvalMaterial<false>(position, *materialInfo);
+}
+
+inline int GetSquareColor(const Square square)
+{
+	return (GetRow(square) + GetColumn(square)) & 1;
 }
 
-template<Color color, int multiplier>
-void EvalPieces(const Position &position, int &openingResult, int &endgameResult, int &gamePhase, bool &kingDanger)
+template<Color color, int multiplier, bool trace>
+void EvalPieces(const Position &position, EvalInfo &evalInfo, EvalScore &scoreResult)
 {
-	int opening = 0, endgame = 0;
+	EvalScore score = 0;
 
 	const Bitboard us = position.Colors[color];
 	const Bitboard allPieces = position.GetAllPieces();
@@ -335,12 +924,15 @@ void EvalPieces(const Position &position, int &openingResult, int &endgameResult
 	int kingAttacks = 0;
 	int kingAttackWeight = 0;
 
-	const Bitboard pawns = position.Pieces[PAWN] & us;
-	if ((color == BLACK && (((pawns << 7) | (pawns << 9)) & kingMoves)) ||
-		(color == WHITE && (((pawns >> 7) | (pawns >> 9)) & kingMoves)))
+	// Attack weights of each piece type that went into kingAttackWeight, only counted when tracing
+	int kingAttackers[8] = { 0 };
+
+	const Bitboard pawnPushes = ShiftForward<color>(position.Pieces[PAWN] & us);
+	if ((ShiftEast(pawnPushes) | ShiftWest(pawnPushes)) & kingMoves)
 	{
 		kingAttacks++;
 		kingAttackWeight += KingAttackWeightPawn;
+		if (trace) kingAttackers[PAWN]++;
 	}
 
 	// Knight evaluation
@@ -352,21 +944,21 @@ void EvalPieces(const Position &position, int &openingResult, int &endgameResult
 		// Mobility
 		const Bitboard attacks = GetKnightAttacks(square);
 		const int mobility = CountBitsSetFew(attacks) - 3;
-		opening += mobility * KnightMobilityOpening;
-		endgame += mobility * KnightMobilityEndgame;
-		
-		gamePhase += KnightPhaseScale;
+		score += mobility * KnightMobility;
+		TraceTerm<trace>(EvalTermKnightMobility, color, mobility * KnightMobility);
+		TraceFeature<trace>(KnightMobilityOpeningIndex, color, mobility, 0);
+		TraceFeature<trace>(KnightMobilityEndgameIndex, color, 0, mobility);
 
 		if (attacks & kingMoves)
 		{
 			kingAttacks++;
 			kingAttackWeight += KingAttackWeightKnight;
+			if (trace) kingAttackers[KNIGHT]++;
 		}
 	}
 
 	// Bishop evaluation
 	b = position.Pieces[BISHOP] & us;
-	int bishopCount = 0;
 	while (b)
 	{
 		const Square square = PopFirstBit(b);
@@ -374,25 +966,19 @@ void EvalPieces(const Position &position, int &openingResult, int &endgameResult
 		// Mobility
 		const Bitboard attacks = GetBishopAttacks(square, allPieces);
 		const int mobility = CountBitsSet(attacks) - 2;
-		opening += mobility * BishopMobilityOpening;
-		endgame += mobility * BishopMobilityEndgame;
-		
-		gamePhase += BishopPhaseScale;
-		bishopCount++;
+		score += mobility * BishopMobility;
+		TraceTerm<trace>(EvalTermBishopMobility, color, mobility * BishopMobility);
+		TraceFeature<trace>(BishopMobilityOpeningIndex, color, mobility, 0);
+		TraceFeature<trace>(BishopMobilityEndgameIndex, color, 0, mobility);
 
 		if (attacks & kingMoves)
 		{
 			kingAttacks++;
 			kingAttackWeight += KingAttackWeightBishop;
+			if (trace) kingAttackers[BISHOP]++;
 		}
 	}
 
-	if (bishopCount >= 2)
-	{
-		opening += BishopPairOpening;
-		endgame += BishopPairEndgame;
-	}
-
 	// Rook evaluation
 	b = position.Pieces[ROOK] & us;
 	while (b)
@@ -402,31 +988,37 @@ void EvalPieces(const Position &position, int &openingResult, int &endgameResult
 		// Mobility
 		const Bitboard attacks = GetRookAttacks(square, allPieces);
 		const int mobility = CountBitsSet(attacks) - 4;
-		opening += mobility * RookMobilityOpening;
-		endgame += mobility * RookMobilityEndgame;
-		
-		gamePhase += RookPhaseScale;
+		score += mobility * RookMobility;
+		TraceTerm<trace>(EvalTermRookMobility, color, mobility * RookMobility);
+		TraceFeature<trace>(RookMobilityOpeningIndex, color, mobility, 0);
+		TraceFeature<trace>(RookMobilityEndgameIndex, color, 0, mobility);
 
 		if (attacks & kingMoves)
 		{
 			kingAttacks++;
 			kingAttackWeight += KingAttackWeightRook;
+			if (trace) kingAttackers[ROOK]++;
 		}
 
 		// Open file
 		const Bitboard pawnFile = ColumnBitboard[GetColumn(square)] & position.Pieces[PAWN];
-		opening -= (RookSemiOpenFile + RookOpenFile) / 2;
-		endgame -= (RookSemiOpenFile + RookOpenFile) / 2;
+		EvalScore fileScore = RookClosedFileScore;
 		if ((pawnFile & us) == 0)
 		{
-			opening += RookSemiOpenFile;
-			endgame += RookSemiOpenFile;
+			fileScore += RookSemiOpenFileScore;
 			if (pawnFile == 0)
 			{
-				opening += RookOpenFile;
-				endgame += RookOpenFile;
+				fileScore += RookOpenFileScore;
 			}
 		}
+		score += fileScore;
+		TraceTerm<trace>(EvalTermRookFiles, color, fileScore);
+
+		// RookClosedFileScore takes half of both
+		const float semiOpen = (pawnFile & us) == 0 ? 0.5f : -0.5f;
+		const float open = pawnFile == 0 ? 0.5f : -0.5f;
+		TraceFeature<trace>(RookSemiOpenFileIndex, color, semiOpen, semiOpen);
+		TraceFeature<trace>(RookOpenFileIndex, color, open, open);
 
 		// TODO: rook on 7th
 		// TODO: penalize rooks trapped inside king
@@ -441,21 +1033,23 @@ void EvalPieces(const Position &position, int &openingResult, int &endgameResult
 		// Mobility
 		const Bitboard attacks = GetQueenAttacks(square, allPieces);
 		const int mobility = CountBitsSet(attacks) - 5;
-		opening += mobility * QueenMobilityOpening;
-		endgame += mobility * QueenMobilityEndgame;
-		
-		gamePhase += QueenPhaseScale;
+		score += mobility * QueenMobility;
+		TraceTerm<trace>(EvalTermQueenMobility, color, mobility * QueenMobility);
+		TraceFeature<trace>(QueenMobilityOpeningIndex, color, mobility, 0);
+		TraceFeature<trace>(QueenMobilityEndgameIndex, color, 0, mobility);
 
 		if (attacks & kingMoves)
 		{
 			kingAttacks++;
 			kingAttackWeight += KingAttackWeightQueen;
+			if (trace) kingAttackers[QUEEN]++;
 
 			if (kingMoves & GetKingAttacks(square))
 			{
 				// Danger!  Queen close to king
 				kingAttacks++;
 				kingAttackWeight += KingAttackWeightQueen;
+				if (trace) kingAttackers[QUEEN]++;
 			}
 		}
 
@@ -463,12 +1057,20 @@ void EvalPieces(const Position &position, int &openingResult, int &endgameResult
 	}
 
 	// Give ourselves a bonus for how many of our big pieces are attacking the king.  The more the better.
-	opening += (kingAttackWeight * KingAttackWeightScale[kingAttacks]) / 256;
+	const EvalScore kingAttack = ES((kingAttackWeight * KingAttackWeightScale[min(kingAttacks, 15)]) / 256, 0);
+	score += kingAttack;
+	TraceTerm<trace>(EvalTermKingAttack, color, kingAttack);
 
-	kingDanger = kingAttacks >= 2;
+	const float kingAttackScale = KingAttackWeightScale[min(kingAttacks, 15)] / 256.0f;
+	TraceFeature<trace>(KingAttackWeightPawnIndex, color, kingAttackers[PAWN] * kingAttackScale, 0);
+	TraceFeature<trace>(KingAttackWeightKnightIndex, color, kingAttackers[KNIGHT] * kingAttackScale, 0);
+	TraceFeature<trace>(KingAttackWeightBishopIndex, color, kingAttackers[BISHOP] * kingAttackScale, 0);
+	TraceFeature<trace>(KingAttackWeightRookIndex, color, kingAttackers[ROOK] * kingAttackScale, 0);
+	TraceFeature<trace>(KingAttackWeightQueenIndex, color, kingAttackers[QUEEN] * kingAttackScale, 0);
 
-	openingResult += opening * multiplier;
-	endgameResult += endgame * multiplier;
+	evalInfo.KingDanger[FlipColor(color)] = kingAttacks >= 2;
+
+	scoreResult += score * multiplier;
 }
 
 inline int GetKingDistance(const int from, const int to)
@@ -476,8 +1078,83 @@ inline int GetKingDistance(const int from, const int to)
 	return max(abs(GetColumn(from) - GetColumn(to)), abs(GetRow(from) - GetRow(to)));
 }
 
-template<Color color, int multiplier>
-void EvalPassed(const Position &position, u8 passedFiles, int oppGamePhase, int &endgameResult)
+// Distance to the closest edge, 0 to 3
+inline int GetEdgeDistance(const Square square)
+{
+	return min(min(GetRow(square), 7 - GetRow(square)), min(GetColumn(square), 7 - GetColumn(square)));
+}
+
+// Known wins score well above anything the normal evaluation gives for the same material, but far from mate scores
+const int KnownWinScore = 2000;
+
+// Below KnownWinScore, so promoting to a KQK win is still progress
+const int KpkWinScore = 1000;
+
+// Mating evaluations for the recognized won endgames, returns the side to move relative score
+int EvalEndgame(const Position &position, const MaterialHashInfo &materialInfo)
+{
+	const Color strongSide = Color(materialInfo.StrongSide);
+	const Square strongKing = position.KingPos[strongSide];
+	const Square weakKing = position.KingPos[FlipColor(strongSide)];
+
+	if (materialInfo.Endgame == EndgameKPK)
+	{
+		if (!ProbeKpk(position))
+		{
+			return 0;
+		}
+
+		// Push the pawn
+		const Square pawn = GetFirstBitIndex(position.Pieces[PAWN]);
+		const int score = KpkWinScore + (strongSide == WHITE ? RANK_1 - GetRow(pawn) : GetRow(pawn)) * 20;
+		return position.ToMove == strongSide ? score : -score;
+	}
+
+	// Our king has to help in all of them
+	int score = KnownWinScore + (7 - GetKingDistance(strongKing, weakKing)) * 10;
+
+	switch (materialInfo.Endgame)
+	{
+	case EndgameKXK:
+		score += (3 - GetEdgeDistance(weakKing)) * 40;
+		break;
+
+	case EndgameKBNK:
+		{
+			// Only the corners of the bishop's color can be mated in, a1/h8 or h1/a8
+			const Square bishop = GetFirstBitIndex(position.Pieces[BISHOP]);
+			const Square a1 = MakeSquare(RANK_1, FILE_A);
+			const Square h1 = MakeSquare(RANK_1, FILE_H);
+			const Square corner = GetSquareColor(bishop) == GetSquareColor(a1) ? a1 : h1;
+			const Square oppositeCorner = MakeSquare(RANK_8 + RANK_1 - GetRow(corner), FILE_H - GetColumn(corner));
+			const int cornerDistance = min(GetKingDistance(weakKing, corner), GetKingDistance(weakKing, oppositeCorner));
+
+			score += (7 - cornerDistance) * 40 + (3 - GetEdgeDistance(weakKing)) * 10;
+		}
+		break;
+
+	default:
+		ASSERT(false);
+		break;
+	}
+
+	return position.ToMove == strongSide ? score : -score;
+}
+
+bool IsDrawnMaterial(const Position &position)
+{
+	MaterialHashInfo *materialInfo;
+	ProbeMaterialHash(position, materialInfo);
+	return (materialInfo->Flags & MaterialFlagsDraw) != 0;
+}
+
+bool IsDrawnKpk(const Position &position)
+{
+	return !ProbeKpk(position);
+}
+
+template<Color color, int multiplier, bool trace>
+void EvalPassed(const Position &position, u8 passedFiles, int oppGamePhase, EvalScore &scoreResult)
 {
 	const Bitboard ourPawns = position.Pieces[PAWN] & position.Colors[color];
 	const Bitboard theirPawns = position.Pieces[PAWN] & position.Colors[FlipColor(color)];
@@ -496,6 +1173,7 @@ void EvalPassed(const Position &position, u8 passedFiles, int oppGamePhase, int
 			const int row = PawnRow<color>(GetRow(square));
 
 			int scoreMax = PassedPawnEndgameMax;
+			bool unstoppable = false, push = false;
 			const Square pushSquare = GetFirstBitIndex(GetPawnMoves(square, color));
 
 			if (oppGamePhase == 0)
@@ -509,13 +1187,15 @@ void EvalPassed(const Position &position, u8 passedFiles, int oppGamePhase, int
 				if (GetKingDistance(position.KingPos[FlipColor(color)], promotionSquare) > stepsToPromote)
 				{
 					scoreMax += UnstoppablePawnEndgame;
+					unstoppable = true;
 				}
 			}
 			else if (position.Board[pushSquare] == PIECE_NONE &&
-				FastSee(position, GenerateMove(square, pushSquare), color))
+				SeeAtLeast(position, GenerateMove(square, pushSquare), color, 0))
 			{
 				// Can we safely push the pawn?
 				scoreMax += PassedPawnPushEndgame;
+				push = true;
 			}
 
 			scoreMax -= GetKingDistance(position.KingPos[color], pushSquare) * PassedPawnFriendlyKingDistanceEndgame;
@@ -524,70 +1204,186 @@ void EvalPassed(const Position &position, u8 passedFiles, int oppGamePhase, int
 			int score = RowScoreScale(PassedPawnEndgameMin, scoreMax, row);
 			if ((PawnGreaterBitboards[square][color] & ourPawns) != 0) score /= 2;
 
-			endgameResult += multiplier * score;
+			scoreResult += multiplier * ES(0, score);
+			TraceTerm<trace>(EvalTermPassedPawns, color, ES(0, score));
+
+			if (trace)
+			{
+				// Everything added to scoreMax gets the same share of the score
+				const float scale = (PawnGreaterBitboards[square][color] & ourPawns) != 0 ? 0.5f : 1.0f;
+				const float maxShare = GetRowScoreFraction(row) * scale;
+				TraceFeature<trace>(PassedPawnEndgameMinIndex, color, 0, (1 - GetRowScoreFraction(row)) * scale);
+				TraceFeature<trace>(PassedPawnEndgameMaxIndex, color, 0, maxShare);
+				TraceFeature<trace>(UnstoppablePawnEndgameIndex, color, 0, unstoppable ? maxShare : 0);
+				TraceFeature<trace>(PassedPawnPushEndgameIndex, color, 0, push ? maxShare : 0);
+				TraceFeature<trace>(PassedPawnFriendlyKingDistanceEndgameIndex, color, 0,
+					-GetKingDistance(position.KingPos[color], pushSquare) * maxShare);
+				TraceFeature<trace>(PassedPawnEnemyKingDistanceEndgameIndex, color, 0,
+					GetKingDistance(position.KingPos[FlipColor(color)], pushSquare) * maxShare);
+			}
 		}
 	}
 }
 
-int Evaluate(const Position &position, EvalInfo &evalInfo)
+// Scale down the endgame score of the side that is ahead in drawish material configurations
+int GetScaleFactor(const Position &position, const MaterialHashInfo *materialInfo, const int endgame)
 {
-	// TODO: Lazy evaluation?
+	int scaleFactor = materialInfo->ScaleFactor[endgame > 0 ? WHITE : BLACK];
+	if ((materialInfo->Flags & MaterialFlagsOppositeBishops) &&
+		scaleFactor > ScaleFactorOppositeBishops)
+	{
+		const Bitboard bishops = position.Pieces[BISHOP];
+		if (GetSquareColor(GetFirstBitIndex(bishops & position.Colors[WHITE])) !=
+			GetSquareColor(GetFirstBitIndex(bishops & position.Colors[BLACK])))
+		{
+			scaleFactor = ScaleFactorOppositeBishops;
+		}
+	}
+	return scaleFactor;
+}
 
-	int opening = position.PsqEvalOpening * EvalFeatureScale;
-	int endgame = position.PsqEvalEndgame * EvalFeatureScale;
+// Applies the endgame scaling, interpolates between the opening and endgame scores and returns the side to move relative score
+int GetFinalScore(const Position &position, const MaterialHashInfo *materialInfo, const EvalScore score)
+{
+	const int opening = GetOpening(score);
+	int endgame = GetEndgame(score);
+
+	const int scaleFactor = GetScaleFactor(position, materialInfo, endgame);
+	if (scaleFactor != ScaleFactorNormal)
+	{
+		endgame = (endgame * scaleFactor) / ScaleFactorNormal;
+	}
+
+	// Linear interpolation between opening and endgame
+	int result = ((opening * materialInfo->GamePhase) + (endgame * (gamePhaseMax - materialInfo->GamePhase))) / gamePhaseMax;
+
+	// Back down to cp scoring
+	result /= EvalFeatureScale;
+
+	return position.ToMove == WHITE ? result : -result;
+}
+
+// Traced evaluations skip the caches, and give every term to the trace
+template<bool trace>
+int EvaluateInternal(const Position &position, EvalInfo &evalInfo, const int alpha, const int beta)
+{
+	evalInfo.GamePhase[WHITE] = position.GamePhase[WHITE];
+	evalInfo.GamePhase[BLACK] = position.GamePhase[BLACK];
+
+	if (NnueEnabled && !trace)
+	{
+		// The network doesn't tell us anything about king safety, so assume the worst
+		evalInfo.KingDanger[WHITE] = true;
+		evalInfo.KingDanger[BLACK] = true;
+		return NnueEvaluate(position);
+	}
+
+	EvalCacheEntry &cacheEntry = EvalCache[position.Hash & EvalCacheMask];
+	const u64 cacheData = cacheEntry.Data;
+
+	EvalCacheProbes++;
+	if (!trace && (cacheEntry.Lock ^ cacheData) == position.Hash)
+	{
+		EvalCacheHits++;
+		evalInfo.KingDanger[WHITE] = (cacheData & (1 << 16)) != 0;
+		evalInfo.KingDanger[BLACK] = (cacheData & (1 << 17)) != 0;
+		return s16(cacheData & 0xFFFF);
+	}
+
+	EvalScore score = WidenScore(position.PsqEval) * EvalFeatureScale;
 
 	if (position.ToMove == WHITE)
 	{
-		opening += TempoOpening;
-		endgame += TempoEndgame;
+		score += Tempo;
 	}
 	else
 	{
-		opening -= TempoOpening;
-		endgame -= TempoEndgame;
+		score -= Tempo;
 	}
 
-	evalInfo.GamePhase[WHITE] = 0;
-	evalInfo.GamePhase[BLACK] = 0;
+	if (trace)
+	{
+		for (Square square = 0; square < 64; square++)
+		{
+			const Piece piece = position.Board[square];
+			if (piece != PIECE_NONE)
+			{
+				const Color color = GetPieceColor(piece);
+				TraceTerm<trace>(EvalTermPsq, color, GetMultiplier(color) * WidenScore(PsqTable[piece][square]) * EvalFeatureScale);
+#ifdef EVAL_TUNING
+				TracePsqFeatures(piece, square, EvalFeatureScale);
+#endif
+			}
+		}
+		TraceTerm<trace>(EvalTermTempo, position.ToMove, Tempo);
+		TraceFeature<trace>(TempoOpeningIndex, position.ToMove, 1, 0);
+		TraceFeature<trace>(TempoEndgameIndex, position.ToMove, 0, 1);
+	}
 
-	EvalPieces<WHITE, 1>(position, opening, endgame, evalInfo.GamePhase[WHITE], evalInfo.KingDanger[BLACK]);
-	EvalPieces<BLACK, -1>(position, opening, endgame, evalInfo.GamePhase[BLACK], evalInfo.KingDanger[WHITE]);
+	// Material imbalance, game phase and scaling only depend on the piece counts
+	MaterialHashInfo traceMaterialInfo;
+	MaterialHashInfo *materialInfo;
+	if (trace)
+	{
+		EvalMaterial<true>(position, traceMaterialInfo);
+		materialInfo = &traceMaterialInfo;
+	}
+	else
+	{
+		EVAL_PROFILE_BEGIN(EvalProfileMaterial);
+		ProbeMaterialHash(position, materialInfo);
+		EVAL_PROFILE_END(EvalProfileMaterial);
+	}
 
-	// Goes from gamePhaseMax at opening to 0 at endgame
-	int gamePhase = evalInfo.GamePhase[WHITE] + evalInfo.GamePhase[BLACK];
-	ASSERT(gamePhase ==
+	if (materialInfo->Flags & MaterialFlagsDraw)
+	{
+		// Neither side has enough material left to win
+		evalInfo.KingDanger[WHITE] = false;
+		evalInfo.KingDanger[BLACK] = false;
+		return 0;
+	}
+
+	if (materialInfo->Endgame != EndgameNone)
+	{
+		evalInfo.KingDanger[WHITE] = false;
+		evalInfo.KingDanger[BLACK] = false;
+		return EvalEndgame(position, *materialInfo);
+	}
+
+	score += materialInfo->Value;
+
+	ASSERT(materialInfo->GamePhase == min(
 			(CountBitsSetFew(position.Pieces[KNIGHT]) * KnightPhaseScale) +
 			(CountBitsSetFew(position.Pieces[BISHOP]) * BishopPhaseScale) +
 			(CountBitsSetFew(position.Pieces[ROOK]) * RookPhaseScale) +
-			(CountBitsSetFew(position.Pieces[QUEEN]) * QueenPhaseScale));
-
-	if (gamePhase > gamePhaseMax) gamePhase = gamePhaseMax;
+			(CountBitsSetFew(position.Pieces[QUEEN]) * QueenPhaseScale), gamePhaseMax));
 
+	PawnHashInfo tracePawnScores;
 	PawnHashInfo *pawnScores;
-	ProbePawnHash(position, pawnScores);
-
-	opening += pawnScores->Opening;
-	endgame += pawnScores->Endgame;
-
-	// Exchange penalty
-	if (evalInfo.GamePhase[WHITE] > evalInfo.GamePhase[BLACK] &&
-		pawnScores->Count[BLACK] > pawnScores->Count[WHITE])
+	if (trace)
 	{
-		opening += ExchangePenalty;
-		endgame += ExchangePenalty;
+		tracePawnScores.Value = 0;
+		EvalPawns<WHITE, 1, true>(position, tracePawnScores);
+		EvalPawns<BLACK, -1, true>(position, tracePawnScores);
+		pawnScores = &tracePawnScores;
 	}
-	else if (evalInfo.GamePhase[BLACK] > evalInfo.GamePhase[WHITE] &&
-		pawnScores->Count[WHITE] > pawnScores->Count[BLACK])
+	else
 	{
-		opening -= ExchangePenalty;
-		endgame -= ExchangePenalty;
+		EVAL_PROFILE_BEGIN(EvalProfileProbePawnHash);
+		ProbePawnHash(position, pawnScores);
+		EVAL_PROFILE_END(EvalProfileProbePawnHash);
 	}
 
+	score += pawnScores->Value;
+
 	// Passed pawns, using king relative terms
-	EvalPassed<WHITE, 1>(position, pawnScores->Passed[WHITE], evalInfo.GamePhase[BLACK], endgame);
-	EvalPassed<BLACK, -1>(position, pawnScores->Passed[BLACK], evalInfo.GamePhase[WHITE], endgame);
+	EVAL_PROFILE_BEGIN(EvalProfileEvalPassed);
+	EvalPassed<WHITE, 1, trace>(position, pawnScores->Passed[WHITE], position.GamePhase[BLACK], score);
+	EvalPassed<BLACK, -1, trace>(position, pawnScores->Passed[BLACK], position.GamePhase[WHITE], score);
+	EVAL_PROFILE_END(EvalProfileEvalPassed);
 
 	// Score pawn shelter
+	EVAL_PROFILE_BEGIN(EvalProfileShelter);
 	for (Color color = WHITE; color <= BLACK; color++)
 	{
 		const int kingColumn = GetColumn(position.KingPos[color]);
@@ -632,14 +1428,183 @@ int Evaluate(const Position &position, EvalInfo &evalInfo)
 			castlePenalty = min(castlePenalty, pawnScores->Queenside[color]);
 		}
 
-		opening -= GetMultiplier(color) * ((penalty + castlePenalty) / 2) * EvalFeatureScale;
+		score -= ES(GetMultiplier(color) * ((penalty + castlePenalty) / 2) * EvalFeatureScale, 0);
+		TraceTerm<trace>(EvalTermShelter, color, ES(-((penalty + castlePenalty) / 2) * EvalFeatureScale, 0));
+#ifdef EVAL_TUNING
+		TraceFeature<trace>(GetEvalParameterCount(), color, float(-((penalty + castlePenalty) / 2) * EvalFeatureScale), 0);
+#endif
 	}
+	EVAL_PROFILE_END(EvalProfileShelter);
 
-	// Linear interpolation between opening and endgame
-	int result = ((opening * gamePhase) + (endgame * (gamePhaseMax - gamePhase))) / gamePhaseMax;
+	// Lazy evaluation, bail out if the piece terms are unlikely to bring the score back inside the window
+	const int lazyScore = GetFinalScore(position, materialInfo, score);
+	if (lazyScore - LazyEvalMargin >= beta || lazyScore + LazyEvalMargin <= alpha)
+	{
+		// We didn't look at king attacks, so assume the worst
+		evalInfo.KingDanger[WHITE] = true;
+		evalInfo.KingDanger[BLACK] = true;
 
-	// Back down to cp scoring
-	result /= EvalFeatureScale;
+		// Return the score with the margin applied, so callers still fail high/low
+		return lazyScore - LazyEvalMargin >= beta ? lazyScore - LazyEvalMargin : lazyScore + LazyEvalMargin;
+	}
 
-	return position.ToMove == WHITE ? result : -result;
-}
\ No newline at end of file
+	EVAL_PROFILE_BEGIN(EvalProfileEvalPieces);
+	EvalPieces<WHITE, 1, trace>(position, evalInfo, score);
+	EvalPieces<BLACK, -1, trace>(position, evalInfo, score);
+	EVAL_PROFILE_END(EvalProfileEvalPieces);
+
+	const int result = GetFinalScore(position, materialInfo, score);
+
+	if (trace)
+	{
+		// Every term has to be accounted for
+		EvalScore traced = 0;
+		for (int term = 0; term < EvalTermCount; term++)
+		{
+			traced += TraceScores[term][WHITE] - TraceScores[term][BLACK];
+		}
+		ASSERT(traced == score);
+		return result;
+	}
+
+	// Only complete evaluations are cached, lazy exits are just bounds
+	const u64 data = u64(u16(s16(result))) |
+		(evalInfo.KingDanger[WHITE] ? (1 << 16) : 0) |
+		(evalInfo.KingDanger[BLACK] ? (1 << 17) : 0);
+	cacheEntry.Lock = position.Hash ^ data;
+	cacheEntry.Data = data;
+
+	return result;
+}
+
+int Evaluate(const Position &position, EvalInfo &evalInfo, const int alpha, const int beta)
+{
+	EVAL_PROFILE_BEGIN(EvalProfileEvaluate);
+	const int result = EvaluateInternal<false>(position, evalInfo, alpha, beta);
+	EVAL_PROFILE_END(EvalProfileEvaluate);
+	return result;
+}
+
+static void PrintTraceScore(const EvalScore score)
+{
+	printf(" %7.2f %7.2f |", GetOpening(score) / (100.0 * EvalFeatureScale), GetEndgame(score) / (100.0 * EvalFeatureScale));
+}
+
+static void ClearTrace()
+{
+	memset(TraceScores, 0, sizeof(TraceScores));
+#ifdef EVAL_TUNING
+	memset(TraceFeatureCounts, 0, sizeof(TraceFeatureCounts));
+#endif
+}
+
+int TraceEvaluation(const Position &position)
+{
+	ClearTrace();
+
+	EvalInfo evalInfo;
+	const int result = EvaluateInternal<true>(position, evalInfo, MinEval, MaxEval);
+
+	printf("%-16s |      White      |      Black      |      Total      |\n", "Term");
+	printf("%-16s |   Open      End |   Open      End |   Open      End |\n", "");
+
+	EvalScore total[2] = { 0, 0 };
+	for (int term = 0; term < EvalTermCount; term++)
+	{
+		printf("%-16s |", EvalTermNames[term]);
+		PrintTraceScore(TraceScores[term][WHITE]);
+		PrintTraceScore(TraceScores[term][BLACK]);
+		PrintTraceScore(TraceScores[term][WHITE] - TraceScores[term][BLACK]);
+		printf("\n");
+
+		total[WHITE] += TraceScores[term][WHITE];
+		total[BLACK] += TraceScores[term][BLACK];
+	}
+
+	printf("%-16s |", "Total");
+	PrintTraceScore(total[WHITE]);
+	PrintTraceScore(total[BLACK]);
+	PrintTraceScore(total[WHITE] - total[BLACK]);
+	printf("\n\n");
+
+	MaterialHashInfo materialInfo;
+	EvalMaterial<false>(position, materialInfo);
+	printf("Game phase %d/%d, scale factors %d/%d (white/black, out of %d)%s\n",
+		materialInfo.GamePhase, int(gamePhaseMax), materialInfo.ScaleFactor[WHITE], materialInfo.ScaleFactor[BLACK], ScaleFactorNormal,
+		(materialInfo.Flags & MaterialFlagsDraw) ? ", drawn material" : "");
+	if (materialInfo.Endgame == EndgameKPK)
+	{
+		printf("King and pawn against king, %s by the bitbase\n", ProbeKpk(position) ? "won" : "drawn");
+	}
+	else if (materialInfo.Endgame != EndgameNone && materialInfo.Endgame != EndgameDraw)
+	{
+		printf("Known win for %s, scored by the mating evaluation\n", materialInfo.StrongSide == WHITE ? "white" : "black");
+	}
+	printf("Evaluation %+.2f (white), %+.2f (side to move)\n",
+		(position.ToMove == WHITE ? result : -result) / 100.0, result / 100.0);
+
+	if (NnueEnabled)
+	{
+		printf("Network evaluation %+.2f (side to move)\n", NnueEvaluate(position) / 100.0);
+	}
+
+	return result;
+}
+
+#ifdef EVAL_TUNING
+int GetEvalFeatureCount()
+{
+	return GetEvalParameterCount() + 1;
+}
+
+const char *GetEvalFeatureName(const int feature)
+{
+	return feature < GetEvalParameterCount() ? GetEvalParameter(feature).Name : "PawnShelter";
+}
+
+int GetEvalFeatureValue(const int feature)
+{
+	return feature < GetEvalParameterCount() ? *GetEvalParameter(feature).Value : 1;
+}
+
+int GetEvalFeatures(const Position &position, u16 *features, float *counts, int &eval)
+{
+	ClearTrace();
+
+	EvalInfo evalInfo;
+	const int result = EvaluateInternal<true>(position, evalInfo, MinEval, MaxEval);
+	eval = position.ToMove == WHITE ? result : -result;
+
+	MaterialHashInfo materialInfo;
+	EvalMaterial<false>(position, materialInfo);
+	if ((materialInfo.Flags & MaterialFlagsDraw) || materialInfo.Endgame != EndgameNone)
+	{
+		return -1;
+	}
+
+	EvalScore score = 0;
+	for (int term = 0; term < EvalTermCount; term++)
+	{
+		score += TraceScores[term][WHITE] - TraceScores[term][BLACK];
+	}
+
+	// Fold in the interpolation and scaling of GetFinalScore
+	const int scaleFactor = GetScaleFactor(position, &materialInfo, GetEndgame(score));
+	const float openingScale = float(materialInfo.GamePhase) / float(gamePhaseMax * EvalFeatureScale);
+	const float endgameScale = (float(gamePhaseMax - materialInfo.GamePhase) * scaleFactor) /
+		(float(gamePhaseMax * EvalFeatureScale) * ScaleFactorNormal);
+
+	int count = 0;
+	for (int feature = 0; feature < GetEvalFeatureCount(); feature++)
+	{
+		const float value = TraceFeatureCounts[feature][0] * openingScale + TraceFeatureCounts[feature][1] * endgameScale;
+		if (value != 0)
+		{
+			features[count] = u16(feature);
+			counts[count] = value;
+			count++;
+		}
+	}
+	return count;
+}
+#endif
@@ -1,21 +1,123 @@
-#define EVAL_FEATURE(featureName, value) const int (featureName) = (value);
-#define EVAL_CONST const
+// Evaluation parameters.  Normally these are constants that the compiler folds into the evaluation.  Building with
+// EVAL_TUNING turns them into registered variables the tuner can change at runtime, along with the values derived
+// from them (EVAL_DERIVED).
+#ifdef EVAL_TUNING
+
+struct EvalParameter
+{
+	const char *Name;
+	int *Value;
+	int Default;
+};
+
+int RegisterEvalFeature(const char *name, int *value, const int defaultValue);
+int RegisterEvalDerived(void (*update)());
+
+int GetEvalParameterCount();
+EvalParameter &GetEvalParameter(const int index);
+
+// Both return false for unknown parameters (or a missing file), call UpdateEvalParameters after making changes
+bool SetEvalParameter(const std::string &name, const int value);
+bool LoadEvalParameters(const std::string &filename);
+void ResetEvalParameters();
+
+// featureName##Index is the parameter's index, for feature extraction
+#define EVAL_FEATURE(featureName, value) static int featureName = RegisterEvalFeature(#featureName, &featureName, (value)); \
+	static const int featureName##Index = GetEvalParameterCount() - 1;
+#define EVAL_DERIVED(type, name, value) static type name = (value); \
+	static void Update##name() { name = (value); } \
+	static const int name##Registration = RegisterEvalDerived(Update##name);
+
+#else
+
+#define EVAL_FEATURE(featureName, value) const int (featureName) = (value); const int featureName##Index = -1;
+#define EVAL_DERIVED(type, name, value) const type name = (value);
+
+#endif
+
+// The pawn, material and evaluation caches are per thread, so threads searching different games don't share entries
+#define EVAL_CACHE_STORAGE THREAD_LOCAL
 
 const int MinEval = -32767;
 const int MaxEval = 32767;
 
-extern int PsqTableOpening[16][64];
-extern int PsqTableEndgame[16][64];
+extern Score PsqTable[16][64];
+
+// Game phase contribution of each piece type, maintained incrementally by Position
+extern int PiecePhase[8];
 
 void InitializeEvaluation();
 
+// Recomputes everything derived from the evaluation parameters after they have been changed (tuning builds only)
+void UpdateEvalParameters();
+
+// Empties the pawn, material and evaluation caches of the calling thread
+void ClearEvaluationCaches();
+
 struct EvalInfo
 {
 	int GamePhase[2];
 	bool KingDanger[2];
 };
 
-int Evaluate(const Position &position, EvalInfo &evalInfo);
+// Material that nobody can win (only minor pieces, see the endgame recognizers), or a king and pawn against king
+// position the bitbase says is drawn.  Cheap enough to test at every node.
+bool IsDrawnMaterial(const Position &position);
+bool IsDrawnKpk(const Position &position);
+inline bool IsDeadDraw(const Position &position)
+{
+	if ((position.Pieces[ROOK] | position.Pieces[QUEEN]) != 0)
+	{
+		return false;
+	}
+
+	const Bitboard pawns = position.Pieces[PAWN];
+	if (pawns == 0)
+	{
+		return IsDrawnMaterial(position);
+	}
+
+	// A single pawn and no pieces
+	return (pawns & (pawns - 1)) == 0 && (position.Pieces[KNIGHT] | position.Pieces[BISHOP]) == 0 && IsDrawnKpk(position);
+}
+
+// Scores outside (alpha, beta) may be returned early, as a bound on the full evaluation that holds as long as the piece
+// terms stay within LazyEvalMargin (see evaluation.cpp)
+int Evaluate(const Position &position, EvalInfo &evalInfo, const int alpha, const int beta);
+
+// Prints the contribution of every evaluation term (the eval command), returns the evaluation
+int TraceEvaluation(const Position &position);
+
+#ifdef EVAL_TUNING
+// Feature extraction, for training evaluations offline.  There is a feature for each parameter (GetEvalParameter),
+// followed by the pawn shelter, which has no parameter and a fixed value of 1.  The classical evaluation is the sum
+// of count * value over the features, give or take the integer rounding: the game phase and the endgame scale factor
+// are folded into the counts.  The phase and scale factor parameters aren't linear, so their counts are always zero.
+int GetEvalFeatureCount();
+const char *GetEvalFeatureName(const int feature);
+int GetEvalFeatureValue(const int feature);
+
+// Fills features and counts with the nonzero counts, from white's point of view, and returns how many there are.
+// Positions the features don't score (drawn material and the recognized endgames) return -1.  eval is set to the
+// classical evaluation from white's point of view either way.  Thread safe, and doesn't touch the caches.
+int GetEvalFeatures(const Position &position, u16 *features, float *counts, int &eval);
+
+// Used by the piece square tables to report their features
+void AddEvalFeatureCount(const int feature, const Color color, const float opening, const float endgame);
+#endif
+
+// Cycles spent in the parts of the evaluation, only counted in builds with EVAL_PROFILE
+void ClearEvalProfile();
+void PrintEvalProfile();
+
+// Evaluation cache statistics
+extern EVAL_CACHE_STORAGE u64 EvalCacheProbes;
+extern EVAL_CACHE_STORAGE u64 EvalCacheHits;
+
+inline int Evaluate(const Position &position, EvalInfo &evalInfo)
+{
+	return Evaluate(position, evalInfo, MinEval, MaxEval);
+}
 
 template<class T>
 inline const T& min(const T &a, const T &b) { return a < b ? a : b; }
@@ -4,13 +4,26 @@
 #include <intrin.h>
 #endif
 
+// SSE2 is part of the x64 baseline
+#if defined(X64) || defined(__SSE2__)
+#define USE_SSE2
+#include <emmintrin.h>
+#endif
+
+// AVX2 is not part of any baseline, it has to be enabled in the compiler (/arch:AVX2 or -mavx2)
+#if defined(__AVX2__)
+#define USE_AVX2
+#include <immintrin.h>
+#endif
+
 #if _DEBUG
 extern "C" {
 void __declspec(dllimport) __stdcall DebugBreak(void);
 }
 #define ASSERT(a) (!(a) ? DebugBreak() : 0)
 #else
-#define ASSERT(a)
+// Not evaluated, but values only kept for an ASSERT still count as used
+#define ASSERT(a) ((void)sizeof(a))
 #endif
 
 typedef signed char s8;
@@ -37,6 +50,45 @@ typedef int Piece;
 typedef int PieceType;
 typedef int Color;
 
+// Packed opening/endgame score for the tapered evaluation, opening in the low half and endgame in the high half.
+// Piece square values are plain centipawns, so Score uses 16-bit halves.
+// Packed scores can be added, subtracted and multiplied by an int, anything else needs them unpacked.
+typedef s32 Score;
+
+#define S(opening, endgame) (Score(u32(endgame) << 16) + Score(opening))
+
+inline int GetOpening(const Score score)
+{
+	return s16(u16(u32(score)));
+}
+
+inline int GetEndgame(const Score score)
+{
+	// Rounding takes care of the borrow from a negative opening half
+	return s16(u16((u32(score) + 0x8000) >> 16));
+}
+
+// The evaluation works in units of 1/EvalFeatureScale centipawns, where a single term can reach 25600
+// (UnstoppablePawnEndgame), so it accumulates an EvalScore with 32-bit halves instead.
+typedef s64 EvalScore;
+
+#define ES(opening, endgame) (EvalScore(u64(s64(endgame)) << 32) + EvalScore(opening))
+
+inline int GetOpening(const EvalScore score)
+{
+	return s32(u32(u64(score)));
+}
+
+inline int GetEndgame(const EvalScore score)
+{
+	return s32(u32((u64(score) + 0x80000000ULL) >> 32));
+}
+
+inline EvalScore WidenScore(const Score score)
+{
+	return ES(GetOpening(score), GetEndgame(score));
+}
+
 const Move PromotionTypeKnight = 0 << 12;
 const Move PromotionTypeBishop = 1 << 12;
 const Move PromotionTypeRook = 2 << 12;
@@ -329,6 +381,11 @@ inline Bitboard GetKingAttacks(const Square square)
 	return KingAttacks[square];
 }
 
+// Kogge-Stone slider attacks for up to four sliders at once, attacks[i] is set to the attacks from squares[i].
+// With USE_AVX2 each slider gets a lane and all four are filled together, otherwise the fills are scalar.
+void GetBishopAttacksX4(const Square *squares, const int count, const Bitboard blockers, Bitboard *attacks);
+void GetRookAttacksX4(const Square *squares, const int count, const Bitboard blockers, Bitboard *attacks);
+
 // Misc. attack functions
 extern Bitboard SquaresBetween[64][64];
 
@@ -341,4 +398,42 @@ inline Bitboard GetSquaresBetween(const Square from, const Square to)
 // Timer
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 u64 GetCurrentMilliseconds();
-bool CheckForPendingInput();
\ No newline at end of file
+bool CheckForPendingInput();
+
+// Time stamp counter, for profiling
+inline u64 GetCycleCount()
+{
+#ifdef _MSC_VER
+	return __rdtsc();
+#else
+	return __builtin_ia32_rdtsc();
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Threads
+////////////////////////////////////////////////////////////////////////////////////////////////////
+typedef void (*ThreadFunction)(void *argument);
+typedef void *ThreadHandle;
+
+ThreadHandle StartThread(ThreadFunction function, void *argument);
+void WaitForThread(ThreadHandle thread);
+int GetProcessorCount();
+
+// Returns the incremented value
+int AtomicIncrement(volatile int &value);
+
+// Storage class for per-thread globals (plain data only)
+#ifdef _MSC_VER
+#define THREAD_LOCAL __declspec(thread)
+#else
+#define THREAD_LOCAL __thread
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Files
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Maps a whole file read-only into memory.  Returns 0 if the file can't be opened or is empty.
+const void *MapFile(const char *filename, u64 &size);
+void UnmapFile(const void *data, const u64 size);
\ No newline at end of file
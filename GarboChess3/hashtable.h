@@ -10,6 +10,8 @@ struct HashEntry
 	u32 Lock;
 	s16 Score;
 	Move Move;
+	// Static evaluation of the position, MaxEval if it wasn't computed
+	s16 Eval;
 	u8 Depth;
 	u8 Extra;
 
@@ -30,25 +32,36 @@ struct HashEntry
 };
 #pragma pack(pop)
 
-extern HashEntry *HashTable;
+// Entries are grouped so that a probe touches a single cache line
+const int HashClusterEntries = 5;
+
+struct HashCluster
+{
+	HashEntry Entries[HashClusterEntries];
+	u8 Padding[64 - (HashClusterEntries * sizeof(HashEntry))];
+};
+
+extern HashCluster *HashTable;
 extern u64 HashMask;
 extern int HashDate;
 
 // Hash size in bytes
 void InitializeHash(int hashSize);
+// Empties the table, keeping its size
+void ClearHash();
 void IncrementHashDate();
 
 inline bool ProbeHash(const u64 hash, HashEntry *&result)
 {
-	const u64 base = hash & HashMask;
-	ASSERT(base <= HashMask);
+	ASSERT((hash & HashMask) <= HashMask);
+	HashEntry *entries = HashTable[hash & HashMask].Entries;
 
 	const u32 lock = hash >> 32;
-	for (u64 i = base; i < base + 4; i++)
+	for (int i = 0; i < HashClusterEntries; i++)
 	{
-		if (HashTable[i].Lock == lock)
+		if (entries[i].Lock == lock)
 		{
-			result = &(HashTable[i]);
+			result = entries + i;
 			return true;
 		}
 	}
@@ -56,43 +69,53 @@ inline bool ProbeHash(const u64 hash, HashEntry *&result)
 	return false;
 }
 
-inline void StoreHash(const u64 hash, const s16 score, const Move move, int depth, const int flags)
+inline void StoreHash(const u64 hash, const s16 score, s16 eval, const Move move, int depth, const int flags)
 {
-	const u64 base = hash & HashMask;
-	ASSERT(base <= HashMask);
+	ASSERT((hash & HashMask) <= HashMask);
+	HashEntry *entries = HashTable[hash & HashMask].Entries;
 
 	const u32 lock = hash >> 32;
 	int bestScore = 512;
-	u64 best;
+	int best;
 
 	depth /= OnePly;
 
-	for (u64 i = base; i < base + 4; i++)
+	for (int i = 0; i < HashClusterEntries; i++)
 	{
-		if (HashTable[i].Lock == lock)
+		if (entries[i].Lock == lock)
 		{
-			if (depth >= HashTable[i].Depth)
+			if (depth < entries[i].Depth)
 			{
-				best = i;
-				break;
+				if (entries[i].Move == 0)
+				{
+					entries[i].Move = move;
+				}
+				if (entries[i].Eval == MaxEval)
+				{
+					entries[i].Eval = eval;
+				}
+				return;
 			}
-			if (HashTable[i].Move == 0)
+
+			// Don't lose the static evaluation if we didn't compute it this time
+			if (eval == MaxEval)
 			{
-				HashTable[i].Move = move;
+				eval = entries[i].Eval;
 			}
-			return;
+			best = i;
+			break;
 		}
 		
 		int matchScore;
-		if (HashTable[i].GetHashDate() != HashDate)
+		if (entries[i].GetHashDate() != HashDate)
 		{
 			// We want to always allow overwriting of hash entries not from our hash date
-			matchScore = HashTable[i].Depth;
+			matchScore = entries[i].Depth;
 		}
 		else
 		{
 			// Otherwise, choose the hash entry with the lowest depth for overwriting
-			matchScore = 256 + HashTable[i].Depth;
+			matchScore = 256 + entries[i].Depth;
 		}
 
 		if (matchScore < bestScore)
@@ -102,13 +125,14 @@ inline void StoreHash(const u64 hash, const s16 score, const Move move, int dept
 		}
 	}
 
-	HashTable[best].Lock = lock;
-	HashTable[best].Move = move;
-	HashTable[best].Score = score;
-	HashTable[best].Depth = depth;
+	entries[best].Lock = lock;
+	entries[best].Move = move;
+	entries[best].Score = score;
+	entries[best].Eval = eval;
+	entries[best].Depth = depth;
 
 	ASSERT(flags <= 0xf);
 	ASSERT(HashDate <= 0xf);
 
-	HashTable[best].Extra = flags | (HashDate << 4);
+	entries[best].Extra = flags | (HashDate << 4);
 }
\ No newline at end of file
@@ -5,32 +5,53 @@
 #include "search.h"
 #include "hashtable.h"
 #include "utilities.h"
+#include "perft.h"
+#include "nnue.h"
+#include "tuner.h"
+#include "bitbase.h"
+#include "tablebase.h"
+#include "book.h"
+#include "pgn.h"
+#include "packed.h"
+#include "selfplay.h"
+#include "batch.h"
 
 #include <cstdlib>
 
 void RunTests();
+void RunBench(const int depth);
+void BenchmarkSliderAttacks(const std::string &filename, const int iterations);
 
 // Hashtable definitions
-HashEntry *HashTable = 0;
+HashCluster *HashTable = 0;
 u64 HashMask = 0;
 int HashDate = 0;
 
+static void *HashTableMemory = 0;
+
 void InitializeHash(int hashSize)
 {
-	for (HashMask = 1; HashMask < (hashSize / sizeof(HashEntry)); HashMask *= 2);
-	HashMask /= 2;
-	HashMask--;
+	ASSERT(sizeof(HashCluster) == 64);
+
+	u64 clusterCount;
+	for (clusterCount = 1; clusterCount * 2 <= hashSize / sizeof(HashCluster); clusterCount *= 2);
+	HashMask = clusterCount - 1;
 
-	if (HashTable)
+	if (HashTableMemory)
 	{
-		free(HashTable);
+		free(HashTableMemory);
 	}
-	size_t allocSize = (size_t)(HashMask * sizeof(HashEntry));
-	HashTable = (HashEntry*)malloc(allocSize);
+
+	// Align the clusters to cache lines
+	size_t allocSize = (size_t)(clusterCount * sizeof(HashCluster));
+	HashTableMemory = malloc(allocSize + 63);
+	HashTable = (HashCluster*)((u64(HashTableMemory) + 63) & ~u64(63));
 	memset(HashTable, 0, allocSize);
+}
 
-	// Minor speed optimization, so we don't need to mask this out when we access the hash-table
-	HashMask &= ~3;
+void ClearHash()
+{
+	memset(HashTable, 0, (size_t)((HashMask + 1) * sizeof(HashCluster)));
 }
 
 void IncrementHashDate()
@@ -48,6 +69,16 @@ std::string ReadLine()
 
 Position GamePosition;
 
+#ifdef EVAL_TUNING
+static void UpdateGamePositionEvaluation()
+{
+	UpdateEvalParameters();
+
+	// The position keeps incremental piece square and phase sums, rebuild them with the new values
+	GamePosition.RefreshEvaluation();
+}
+#endif
+
 void ReadCommand()
 {
 	const std::string line = ReadLine();
@@ -68,12 +99,112 @@ void ReadCommand()
 		printf("\n");
 #endif
 		printf("id author Gary Linscott\n");
+		printf("option name EvalFile type string default <empty>\n");
+		printf("option name TablebasePath type string default <empty>\n");
+		printf("option name BookFile type string default <empty>\n");
+#ifdef EVAL_TUNING
+		printf("option name EvalParameters type string default <empty>\n");
+		for (int i = 0; i < GetEvalParameterCount(); i++)
+		{
+			const EvalParameter &parameter = GetEvalParameter(i);
+			// Like the tuner, don't let bonuses turn into penalties or the other way around
+			const int range = max(1000, abs(parameter.Default) * 4);
+			const int minValue = parameter.Default > 0 ? 0 : parameter.Default - range;
+			const int maxValue = parameter.Default < 0 ? 0 : parameter.Default + range;
+			printf("option name %s type spin default %d min %d max %d\n", parameter.Name, parameter.Default, minValue, maxValue);
+		}
+#endif
 		printf("uciok\n");
 	}
 	else if (command == "isready")
 	{
 		printf("readyok\n");
 	}
+	else if (command == "setoption")
+	{
+		// setoption name <name> [value <value>], either can contain spaces
+		std::string name, value;
+		std::string *target = 0;
+		for (int i = 1; i < (int)tokens.size(); i++)
+		{
+			if (tokens[i] == "name")
+			{
+				target = &name;
+			}
+			else if (tokens[i] == "value")
+			{
+				target = &value;
+			}
+			else if (target != 0)
+			{
+				*target += (target->empty() ? "" : " ") + tokens[i];
+			}
+		}
+
+		if (name == "EvalFile")
+		{
+			// An empty file name goes back to the hand-crafted evaluation
+			if (value.empty() || value == "<empty>")
+			{
+				SetNnueNetwork(0);
+			}
+			else if (LoadNnue(value))
+			{
+				printf("info string loaded network %s\n", value.c_str());
+			}
+			else
+			{
+				printf("info string unable to load network %s\n", value.c_str());
+			}
+
+			// Static evaluations stored by the other evaluator must not be reused
+			ClearHash();
+			ClearEvaluationCaches();
+			GamePosition.RefreshNnueAccumulator();
+		}
+		else if (name == "TablebasePath")
+		{
+			if (value.empty() || value == "<empty>")
+			{
+				UnloadTablebases();
+			}
+			else
+			{
+				printf("info string loaded %d tablebases from %s\n", LoadTablebases(value), value.c_str());
+			}
+		}
+		else if (name == "BookFile")
+		{
+			if (value.empty() || value == "<empty>")
+			{
+				UnloadBook();
+			}
+			else if (!LoadBook(value))
+			{
+				printf("info string unable to load book %s\n", value.c_str());
+			}
+		}
+#ifdef EVAL_TUNING
+		else if (name == "EvalParameters")
+		{
+			// An empty file name goes back to the built in values
+			if (value.empty() || value == "<empty>")
+			{
+				ResetEvalParameters();
+			}
+			else if (!LoadEvalParameters(value))
+			{
+				printf("info string unable to load evaluation parameters %s\n", value.c_str());
+			}
+
+			UpdateGamePositionEvaluation();
+		}
+		else if (SetEvalParameter(name, atoi(value.c_str())))
+		{
+			UpdateGamePositionEvaluation();
+		}
+#endif
+	}
 	else if (command == "ucinewgame")
 	{
 		// TODO: clear hash
@@ -83,7 +214,10 @@ void ReadCommand()
 		std::string fen;
 		if (tokens[1] == "fen")
 		{
-			fen = tokens[2] + tokens[3] + tokens[4] + tokens[5] + tokens[6] + tokens[7];
+			for (int i = 2; i < (int)tokens.size() && tokens[i] != "moves"; i++)
+			{
+				fen += tokens[i] + " ";
+			}
 		}
 		else
 		{
@@ -171,15 +305,202 @@ void ReadCommand()
 			movetime = min(movetime, (time + inc) - 50);
 		}
 
-		// Begin the search
-		IncrementHashDate();
-		int score;
-		Move move = IterativeDeepening(GamePosition, MaxPly, score, movetime, true);
+		// Book moves are played straight away, leaving the clock for later.  An infinite search is for analysis, so it
+		// always searches.
+		Move move = infinite ? 0 : ProbeBook(GamePosition);
+		if (move != 0)
+		{
+			printf("info string book move\n");
+		}
+		else
+		{
+			// Begin the search
+			IncrementHashDate();
+			int score;
+			move = IterativeDeepening(GamePosition, MaxPly, score, movetime, true);
+		}
 
 		ASSERT(IsMovePseudoLegal(GamePosition, move));
 
 		printf("bestmove %s\n", GetMoveUci(move).c_str());
 	}
+	else if (command == "eval")
+	{
+		// eval [fen], defaults to the current position
+		if (tokens.size() > 1)
+		{
+			Position position;
+			position.Initialize(line.substr(line.find(tokens[1])));
+			TraceEvaluation(position);
+		}
+		else
+		{
+			TraceEvaluation(GamePosition);
+		}
+	}
+	else if (command == "bench")
+	{
+		// bench [depth]
+		RunBench(tokens.size() > 1 ? atoi(tokens[1].c_str()) : 9);
+	}
+	else if (command == "benchsliders")
+	{
+		// benchsliders <epd file> [iterations], times the magic lookups against the Kogge-Stone kernels
+		if (tokens.size() >= 2)
+		{
+			BenchmarkSliderAttacks(tokens[1], tokens.size() > 2 ? max(1, atoi(tokens[2].c_str())) : 10000);
+		}
+	}
+	else if (command == "perft" || command == "divide")
+	{
+		// perft <depth> [threads <n>] [hash <mb>]
+		int depth = tokens.size() > 1 ? atoi(tokens[1].c_str()) : 1;
+		int threads = GetProcessorCount();
+		int hashSize = 64;
+		for (int i = 2; i + 1 < (int)tokens.size(); i++)
+		{
+			if (tokens[i] == "threads")
+			{
+				threads = max(1, atoi(tokens[++i].c_str()));
+			}
+			else if (tokens[i] == "hash")
+			{
+				hashSize = atoi(tokens[++i].c_str());
+			}
+		}
+
+		InitializePerftHash(hashSize);
+		RunPerft(GamePosition, depth, threads, command == "divide");
+	}
+	else if (command == "nnuetrain")
+	{
+		// nnuetrain <epd file> <network file> [epochs]
+		if (tokens.size() >= 3)
+		{
+			TrainNnue(tokens[1], tokens[2], tokens.size() > 3 ? atoi(tokens[3].c_str()) : 20);
+		}
+	}
+	else if (command == "tune")
+	{
+		// tune <epd file> <parameter file> [threads]
+		if (tokens.size() >= 3)
+		{
+			RunTuner(tokens[1], tokens[2], tokens.size() > 3 ? max(1, atoi(tokens[3].c_str())) : GetProcessorCount());
+
+			// The tuned piece square and phase values are only in the incremental sums after a rebuild
+			GamePosition.RefreshEvaluation();
+			GamePosition.RefreshNnueAccumulator();
+		}
+	}
+	else if (command == "tbgen")
+	{
+		// tbgen <name> [path] [threads], generates the table (like KRPKR) and the ones it needs
+		if (tokens.size() >= 2)
+		{
+			const std::string path = tokens.size() > 2 ? tokens[2] : ".";
+			if (!GenerateTablebase(tokens[1], path, tokens.size() > 3 ? max(1, atoi(tokens[3].c_str())) : GetProcessorCount()))
+			{
+				printf("Not a tablebase: %s (up to %d pieces, like KRPKR)\n", tokens[1].c_str(), TablebaseMaxPieces);
+			}
+		}
+	}
+	else if (command == "pgn")
+	{
+		// pgn <file> <output> [epd|book|packed] [threads], see ConvertPgn
+		if (tokens.size() >= 3)
+		{
+			const std::string format = tokens.size() > 3 ? tokens[3] : "epd";
+			if (!ConvertPgn(tokens[1], tokens[2], format, tokens.size() > 4 ? max(1, atoi(tokens[4].c_str())) : GetProcessorCount()))
+			{
+				printf("Unable to convert %s to %s (%s)\n", tokens[1].c_str(), tokens[2].c_str(), format.c_str());
+			}
+		}
+	}
+	else if (command == "selfplay")
+	{
+		// selfplay <file> <positions> [depth <n>] [nodes <n>] [threads <n>], see GenerateSelfPlay
+		if (tokens.size() >= 3)
+		{
+			int depth = -1, threads = GetProcessorCount();
+			u64 nodes = ~0ULL;
+			for (int i = 3; i + 1 < (int)tokens.size(); i += 2)
+			{
+				if (tokens[i] == "depth")
+				{
+					depth = atoi(tokens[i + 1].c_str());
+				}
+				else if (tokens[i] == "nodes")
+				{
+					nodes = u64(atof(tokens[i + 1].c_str()));
+				}
+				else if (tokens[i] == "threads")
+				{
+					threads = max(1, atoi(tokens[i + 1].c_str()));
+				}
+			}
+
+			// Depth 8 unless there is a node limit
+			if (depth == -1)
+			{
+				depth = nodes == ~0ULL ? 8 : MaxPly;
+			}
+
+			if (!GenerateSelfPlay(tokens[1], u64(atof(tokens[2].c_str())), depth, nodes, threads))
+			{
+				printf("Unable to open %s\n", tokens[1].c_str());
+			}
+		}
+	}
+	else if (command == "evalbatch")
+	{
+		// evalbatch <file> <output> [qsearch] [threads <n>], see EvaluatePackedFile
+		if (tokens.size() >= 3)
+		{
+			bool qsearch = false;
+			int threads = GetProcessorCount();
+			for (int i = 3; i < (int)tokens.size(); i++)
+			{
+				if (tokens[i] == "qsearch")
+				{
+					qsearch = true;
+				}
+				else if (tokens[i] == "threads" && i + 1 < (int)tokens.size())
+				{
+					threads = max(1, atoi(tokens[++i].c_str()));
+				}
+			}
+
+			if (!EvaluatePackedFile(tokens[1], tokens[2], qsearch, threads))
+			{
+				printf("Unable to convert %s to %s\n", tokens[1].c_str(), tokens[2].c_str());
+			}
+		}
+	}
+	else if (command == "features")
+	{
+		// features <file> <output> [threads <n>], see ExtractPackedFeatures
+		if (tokens.size() >= 3)
+		{
+			int threads = GetProcessorCount();
+			if (tokens.size() >= 5 && tokens[3] == "threads")
+			{
+				threads = max(1, atoi(tokens[4].c_str()));
+			}
+
+			if (!ExtractPackedFeatures(tokens[1], tokens[2], threads))
+			{
+				printf("Unable to extract features from %s to %s\n", tokens[1].c_str(), tokens[2].c_str());
+			}
+		}
+	}
+	else if (command == "kpkgen")
+	{
+		// kpkgen <file>, writes the KPK bitbase source (see bitbase.h)
+		if (tokens.size() >= 2 && !WriteKpkBitbase(tokens[1]))
+		{
+			printf("Unable to write %s\n", tokens[1].c_str());
+		}
+	}
 	else if (command == "stop")
 	{
 		KillSearch = true;
@@ -153,6 +153,136 @@ void SetIfInBounds(int row, int col, int delta[2], Bitboard &b)
 	}
 }
 
+// Kogge-Stone occluded fills.  Positive shifts move bits to higher squares, and wrapMask removes the squares
+// a shift in that direction would wrap onto from the other edge of the board.
+const Bitboard NotFileABitboard = ~0x0101010101010101ULL;
+const Bitboard NotFileHBitboard = ~0x8080808080808080ULL;
+
+template<int shift>
+inline Bitboard KoggeStoneShift(const Bitboard b)
+{
+	return shift > 0 ? b << (shift > 0 ? shift : 0) : b >> (shift > 0 ? 0 : -shift);
+}
+
+template<int shift>
+inline Bitboard KoggeStoneAttacks(Bitboard generator, const Bitboard empty, const Bitboard wrapMask)
+{
+	Bitboard propagator = empty & wrapMask;
+	generator |= propagator & KoggeStoneShift<shift>(generator);
+	propagator &= KoggeStoneShift<shift>(propagator);
+	generator |= propagator & KoggeStoneShift<2 * shift>(generator);
+	propagator &= KoggeStoneShift<2 * shift>(propagator);
+	generator |= propagator & KoggeStoneShift<4 * shift>(generator);
+	return KoggeStoneShift<shift>(generator) & wrapMask;
+}
+
+#ifdef USE_AVX2
+template<int shift>
+inline __m256i KoggeStoneShiftX4(const __m256i b)
+{
+	return shift > 0 ? _mm256_slli_epi64(b, shift > 0 ? shift : 0) : _mm256_srli_epi64(b, shift > 0 ? 0 : -shift);
+}
+
+template<int shift>
+inline __m256i KoggeStoneAttacksX4(__m256i generator, const __m256i empty, const __m256i wrapMask)
+{
+	__m256i propagator = _mm256_and_si256(empty, wrapMask);
+	generator = _mm256_or_si256(generator, _mm256_and_si256(propagator, KoggeStoneShiftX4<shift>(generator)));
+	propagator = _mm256_and_si256(propagator, KoggeStoneShiftX4<shift>(propagator));
+	generator = _mm256_or_si256(generator, _mm256_and_si256(propagator, KoggeStoneShiftX4<2 * shift>(generator)));
+	propagator = _mm256_and_si256(propagator, KoggeStoneShiftX4<2 * shift>(propagator));
+	generator = _mm256_or_si256(generator, _mm256_and_si256(propagator, KoggeStoneShiftX4<4 * shift>(generator)));
+	return _mm256_and_si256(KoggeStoneShiftX4<shift>(generator), wrapMask);
+}
+
+inline __m256i LoadSlidersX4(const Square *squares, const int count)
+{
+	ASSERT(count >= 1 && count <= 4);
+
+	u64 sliders[4] = { 0, 0, 0, 0 };
+	for (int i = 0; i < count; i++)
+	{
+		SetBit(sliders[i], squares[i]);
+	}
+	return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(sliders));
+}
+
+inline void StoreAttacksX4(const __m256i result, const int count, Bitboard *attacks)
+{
+	u64 lanes[4];
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), result);
+	for (int i = 0; i < count; i++)
+	{
+		attacks[i] = lanes[i];
+	}
+}
+
+void GetBishopAttacksX4(const Square *squares, const int count, const Bitboard blockers, Bitboard *attacks)
+{
+	const __m256i sliders = LoadSlidersX4(squares, count);
+	const __m256i empty = _mm256_set1_epi64x(~blockers);
+	const __m256i notFileA = _mm256_set1_epi64x(NotFileABitboard);
+	const __m256i notFileH = _mm256_set1_epi64x(NotFileHBitboard);
+
+	__m256i result = KoggeStoneAttacksX4<9>(sliders, empty, notFileA);
+	result = _mm256_or_si256(result, KoggeStoneAttacksX4<7>(sliders, empty, notFileH));
+	result = _mm256_or_si256(result, KoggeStoneAttacksX4<-7>(sliders, empty, notFileA));
+	result = _mm256_or_si256(result, KoggeStoneAttacksX4<-9>(sliders, empty, notFileH));
+
+	StoreAttacksX4(result, count, attacks);
+}
+
+void GetRookAttacksX4(const Square *squares, const int count, const Bitboard blockers, Bitboard *attacks)
+{
+	const __m256i sliders = LoadSlidersX4(squares, count);
+	const __m256i empty = _mm256_set1_epi64x(~blockers);
+	const __m256i all = _mm256_set1_epi64x(~0ULL);
+	const __m256i notFileA = _mm256_set1_epi64x(NotFileABitboard);
+	const __m256i notFileH = _mm256_set1_epi64x(NotFileHBitboard);
+
+	__m256i result = KoggeStoneAttacksX4<8>(sliders, empty, all);
+	result = _mm256_or_si256(result, KoggeStoneAttacksX4<-8>(sliders, empty, all));
+	result = _mm256_or_si256(result, KoggeStoneAttacksX4<1>(sliders, empty, notFileA));
+	result = _mm256_or_si256(result, KoggeStoneAttacksX4<-1>(sliders, empty, notFileH));
+
+	StoreAttacksX4(result, count, attacks);
+}
+#else
+void GetBishopAttacksX4(const Square *squares, const int count, const Bitboard blockers, Bitboard *attacks)
+{
+	ASSERT(count >= 1 && count <= 4);
+
+	const Bitboard empty = ~blockers;
+	for (int i = 0; i < count; i++)
+	{
+		Bitboard slider = 0;
+		SetBit(slider, squares[i]);
+		attacks[i] =
+			KoggeStoneAttacks<9>(slider, empty, NotFileABitboard) |
+			KoggeStoneAttacks<7>(slider, empty, NotFileHBitboard) |
+			KoggeStoneAttacks<-7>(slider, empty, NotFileABitboard) |
+			KoggeStoneAttacks<-9>(slider, empty, NotFileHBitboard);
+	}
+}
+
+void GetRookAttacksX4(const Square *squares, const int count, const Bitboard blockers, Bitboard *attacks)
+{
+	ASSERT(count >= 1 && count <= 4);
+
+	const Bitboard empty = ~blockers;
+	for (int i = 0; i < count; i++)
+	{
+		Bitboard slider = 0;
+		SetBit(slider, squares[i]);
+		attacks[i] =
+			KoggeStoneAttacks<8>(slider, empty, ~0ULL) |
+			KoggeStoneAttacks<-8>(slider, empty, ~0ULL) |
+			KoggeStoneAttacks<1>(slider, empty, NotFileABitboard) |
+			KoggeStoneAttacks<-1>(slider, empty, NotFileHBitboard);
+	}
+}
+#endif
+
 void InitializeBitboards()
 {
 	for (int i = 0; i < 8; i++)
@@ -317,7 +447,7 @@ inline void GeneratePawnQuietMoves(Bitboard b, Move *moves, int &moveCount, cons
 }
 
 template<int promotionRow>
-inline void GeneratePawnCaptures(Bitboard b, Move *moves, s16 *moveScores, int &moveCount, const Color us, const Bitboard empty, const Bitboard them, const Position &position)
+inline void GeneratePawnCaptures(Bitboard b, Move *moves, int &moveCount, const Color us, const Bitboard empty, const Bitboard them, const Position &position)
 {
 	while (b)
 	{
@@ -332,7 +462,6 @@ inline void GeneratePawnCaptures(Bitboard b, Move *moves, s16 *moveScores, int &
 			while (attacks)
 			{
 				const Square to = PopFirstBit(attacks);
-				moveScores[moveCount] = ScoreCaptureMove(PAWN, GetPieceType(position.Board[to]));
 				moves[moveCount++] = GenerateMove(from, to);
 			}
 		}
@@ -343,7 +472,6 @@ inline void GeneratePawnCaptures(Bitboard b, Move *moves, s16 *moveScores, int &
 			while (attacks)
 			{
 				const Square to = PopFirstBit(attacks);
-				moveScores[moveCount] = QUEEN * 100;
 				moves[moveCount++] = GeneratePromotionMove(from, to, PromotionTypeQueen);
 			}
 		}
@@ -363,20 +491,6 @@ inline void GeneratePawnCaptures(Bitboard b, Move *moves, s16 *moveScores, int &
 		}															\
 	}
 
-#define MoveGenerationLoopAttacks(func, pieceBitboard, pieceType)	\
-	b = (pieceBitboard) & ourPieces;								\
-	while (b)														\
-	{																\
-		const Square from = PopFirstBit(b);							\
-		Bitboard attacks = (func) & targets;						\
-		while (attacks)												\
-		{															\
-			const Square to = PopFirstBit(attacks);					\
-			moveScores[moveCount] = ScoreCaptureMove((pieceType), GetPieceType(position.Board[to]));	\
-			moves[moveCount++] = GenerateMove(from, to);			\
-		}															\
-	}
-
 inline bool IsKingsideCastleLegal(const Position &position, const Bitboard allPieces, const Color us, const Color them)
 {
 	const int kingRow = GetRow(position.KingPos[us]);
@@ -475,7 +589,7 @@ int GenerateQuietMoves(const Position &position, Move *moves)
 	return moveCount;
 }
 
-int GenerateCaptureMoves(const Position &position, Move *moves, s16 *moveScores)
+int GenerateCaptureMoves(const Position &position, Move *moves)
 {
 	const Color us = position.ToMove;
 	const Color them = FlipColor(us);
@@ -489,11 +603,11 @@ int GenerateCaptureMoves(const Position &position, Move *moves, s16 *moveScores)
 	// Pawn attacks, pawn promotions (queen only)
 	if (us == WHITE)
 	{
-		GeneratePawnCaptures<RANK_7>(position.Pieces[PAWN] & ourPieces, moves, moveScores, moveCount, us, ~allPieces, targets, position);
+		GeneratePawnCaptures<RANK_7>(position.Pieces[PAWN] & ourPieces, moves, moveCount, us, ~allPieces, targets, position);
 	}
 	else
 	{
-		GeneratePawnCaptures<RANK_2>(position.Pieces[PAWN] & ourPieces, moves, moveScores, moveCount, us, ~allPieces, targets, position);
+		GeneratePawnCaptures<RANK_2>(position.Pieces[PAWN] & ourPieces, moves, moveCount, us, ~allPieces, targets, position);
 	}
 
 	// En Passent
@@ -503,24 +617,16 @@ int GenerateCaptureMoves(const Position &position, Move *moves, s16 *moveScores)
 		while (b)
 		{
 			Square from = PopFirstBit(b);
-			moveScores[moveCount] = ScoreCaptureMove(PAWN, PAWN);
 			moves[moveCount++] = GenerateEnPassentMove(from, position.EnPassent);
 		}
 	}
 
 	// Normal piece captures
-	MoveGenerationLoopAttacks(GetKnightAttacks(from), position.Pieces[KNIGHT], KNIGHT);
-	MoveGenerationLoopAttacks(GetBishopAttacks(from, allPieces), position.Pieces[BISHOP], BISHOP);
-	MoveGenerationLoopAttacks(GetRookAttacks(from, allPieces), position.Pieces[ROOK], ROOK);
-	MoveGenerationLoopAttacks(GetQueenAttacks(from, allPieces), position.Pieces[QUEEN], QUEEN);
-	MoveGenerationLoopAttacks(GetKingAttacks(from), position.Pieces[KING], KING);
-
-#if _DEBUG
-	for (int i = 0; i < moveCount; i++)
-	{
-		ASSERT(moveScores[i] == ScoreCaptureMove(moves[i], GetPieceType(position.Board[GetFrom(moves[i])]), GetPieceType(position.Board[GetTo(moves[i])])));
-	}
-#endif
+	MoveGenerationLoop(GetKnightAttacks(from), position.Pieces[KNIGHT]);
+	MoveGenerationLoop(GetBishopAttacks(from, allPieces), position.Pieces[BISHOP]);
+	MoveGenerationLoop(GetRookAttacks(from, allPieces), position.Pieces[ROOK]);
+	MoveGenerationLoop(GetQueenAttacks(from, allPieces), position.Pieces[QUEEN]);
+	MoveGenerationLoop(GetKingAttacks(from), position.Pieces[KING]);
 
 	return moveCount;
 }
@@ -941,10 +1047,44 @@ bool IsMovePseudoLegal(const Position &position, const Move move)
 	return false;
 }
 
+// Determines if a pseudo-legal move leaves our king in check, without having to make the move.
+// pinned must be position.GetPinnedPieces(position.KingPos[position.ToMove], position.ToMove).
+bool IsMoveLegal(const Position &position, const Move move, const Bitboard pinned)
+{
+	const Color us = position.ToMove;
+	const Color them = FlipColor(us);
+	const Square from = GetFrom(move);
+	const Square to = GetTo(move);
+	const Square kingPos = position.KingPos[us];
+
+	if (from == kingPos)
+	{
+		// King moves (and castles) just need a safe destination square
+		Bitboard allPieces = position.GetAllPieces();
+		XorClearBit(allPieces, from);
+		return !position.IsSquareAttacked(to, them, allPieces);
+	}
+
+	if (GetMoveType(move) == MoveTypeEnPassent)
+	{
+		// e.p. can reveal an attack along the row of both pawns, so just do it the slow way
+		Position &mutablePosition = const_cast<Position&>(position);
+		MoveUndo moveUndo;
+		mutablePosition.MakeMove(move, moveUndo);
+		const bool legal = !mutablePosition.CanCaptureKing();
+		mutablePosition.UnmakeMove(move, moveUndo);
+		return legal;
+	}
+
+	// Pinned pieces can only move along the line between the king and the pinning piece
+	return !IsBitSet(pinned, from) ||
+		IsBitSet(GetSquaresBetween(kingPos, to), from) ||
+		IsBitSet(GetSquaresBetween(kingPos, from), to);
+}
+
 int GenerateLegalMoves(Position &position, Move *legalMoves)
 {
 	Move moves[256];
-	s16 moveScores[256];
 	int moveCount;
 	if (position.IsInCheck())
 	{
@@ -953,7 +1093,7 @@ int GenerateLegalMoves(Position &position, Move *legalMoves)
 	else
 	{
 		moveCount = GenerateQuietMoves(position, moves);
-		moveCount += GenerateCaptureMoves(position, moves + moveCount, moveScores);
+		moveCount += GenerateCaptureMoves(position, moves + moveCount);
 	}
 
 	int legalCount = 0;
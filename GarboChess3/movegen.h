@@ -11,10 +11,11 @@ int ScoreCaptureMove(const Move move, const PieceType fromPiece, const PieceType
 
 int GenerateSliderMoves(const Position &position, Move *moves);
 int GenerateQuietMoves(const Position &position, Move *moves);
-int GenerateCaptureMoves(const Position &position, Move *moves, s16 *moveScores);
+int GenerateCaptureMoves(const Position &position, Move *moves);
 int GenerateCheckingMoves(const Position &position, Move *moves);
 int GenerateCheckEscapeMoves(const Position &position, Move *moves);
 bool IsMovePseudoLegal(const Position &position, const Move move);
+bool IsMoveLegal(const Position &position, const Move move, const Bitboard pinned);
 
 // Slow, and should not be used.
 int GenerateLegalMoves(Position &position, Move *legalMoves);
@@ -0,0 +1,569 @@
+#include "garbochess.h"
+#include "position.h"
+#include "movegen.h"
+#include "evaluation.h"
+#include "nnue.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+const u32 NnueVersion = 1;
+
+bool NnueEnabled = false;
+const NnueWeights *NnueNetwork = 0;
+
+// The mapped network file, kept around so it can be released when another one is loaded
+static const void *NnueMapping = 0;
+static u64 NnueMappingSize = 0;
+
+void SetNnueNetwork(const NnueWeights *network)
+{
+	NnueNetwork = network;
+	NnueEnabled = network != 0;
+}
+
+bool LoadNnue(const std::string &filename)
+{
+	u64 size;
+	const void *data = MapFile(filename.c_str(), size);
+	if (data == 0)
+	{
+		return false;
+	}
+
+	const NnueFileHeader *header = reinterpret_cast<const NnueFileHeader*>(data);
+	if (size != sizeof(NnueFileHeader) + sizeof(NnueWeights) ||
+		memcmp(header->Magic, "GCNN", 4) != 0 ||
+		header->Version != NnueVersion ||
+		header->InputSize != NnueInputSize ||
+		header->HiddenSize != NnueHiddenSize ||
+		header->Hidden2Size != NnueHidden2Size)
+	{
+		UnmapFile(data, size);
+		return false;
+	}
+
+	SetNnueNetwork(reinterpret_cast<const NnueWeights*>(reinterpret_cast<const char*>(data) + sizeof(NnueFileHeader)));
+
+	if (NnueMapping != 0)
+	{
+		UnmapFile(NnueMapping, NnueMappingSize);
+	}
+	NnueMapping = data;
+	NnueMappingSize = size;
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Accumulator updates
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void AddWeights(s16 *accumulator, const s16 *weights)
+{
+#if defined(USE_AVX2)
+	for (int i = 0; i < NnueHiddenSize; i += 16)
+	{
+		__m256i *a = reinterpret_cast<__m256i*>(accumulator + i);
+		_mm256_storeu_si256(a, _mm256_add_epi16(_mm256_loadu_si256(a), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(weights + i))));
+	}
+#elif defined(USE_SSE2)
+	for (int i = 0; i < NnueHiddenSize; i += 8)
+	{
+		__m128i *a = reinterpret_cast<__m128i*>(accumulator + i);
+		_mm_storeu_si128(a, _mm_add_epi16(_mm_loadu_si128(a), _mm_loadu_si128(reinterpret_cast<const __m128i*>(weights + i))));
+	}
+#else
+	for (int i = 0; i < NnueHiddenSize; i++)
+	{
+		accumulator[i] = s16(accumulator[i] + weights[i]);
+	}
+#endif
+}
+
+inline void SubtractWeights(s16 *accumulator, const s16 *weights)
+{
+#if defined(USE_AVX2)
+	for (int i = 0; i < NnueHiddenSize; i += 16)
+	{
+		__m256i *a = reinterpret_cast<__m256i*>(accumulator + i);
+		_mm256_storeu_si256(a, _mm256_sub_epi16(_mm256_loadu_si256(a), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(weights + i))));
+	}
+#elif defined(USE_SSE2)
+	for (int i = 0; i < NnueHiddenSize; i += 8)
+	{
+		__m128i *a = reinterpret_cast<__m128i*>(accumulator + i);
+		_mm_storeu_si128(a, _mm_sub_epi16(_mm_loadu_si128(a), _mm_loadu_si128(reinterpret_cast<const __m128i*>(weights + i))));
+	}
+#else
+	for (int i = 0; i < NnueHiddenSize; i++)
+	{
+		accumulator[i] = s16(accumulator[i] - weights[i]);
+	}
+#endif
+}
+
+// accumulator += added - removed, in one pass
+inline void AddSubtractWeights(s16 *accumulator, const s16 *added, const s16 *removed)
+{
+#if defined(USE_AVX2)
+	for (int i = 0; i < NnueHiddenSize; i += 16)
+	{
+		__m256i *a = reinterpret_cast<__m256i*>(accumulator + i);
+		const __m256i delta = _mm256_sub_epi16(
+			_mm256_loadu_si256(reinterpret_cast<const __m256i*>(added + i)),
+			_mm256_loadu_si256(reinterpret_cast<const __m256i*>(removed + i)));
+		_mm256_storeu_si256(a, _mm256_add_epi16(_mm256_loadu_si256(a), delta));
+	}
+#elif defined(USE_SSE2)
+	for (int i = 0; i < NnueHiddenSize; i += 8)
+	{
+		__m128i *a = reinterpret_cast<__m128i*>(accumulator + i);
+		const __m128i delta = _mm_sub_epi16(
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(added + i)),
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(removed + i)));
+		_mm_storeu_si128(a, _mm_add_epi16(_mm_loadu_si128(a), delta));
+	}
+#else
+	for (int i = 0; i < NnueHiddenSize; i++)
+	{
+		accumulator[i] = s16(accumulator[i] + added[i] - removed[i]);
+	}
+#endif
+}
+
+void NnueAddPiece(s16 accumulator[2][NnueHiddenSize], const Piece piece, const Square square)
+{
+	for (Color perspective = WHITE; perspective <= BLACK; perspective++)
+	{
+		AddWeights(accumulator[perspective], NnueNetwork->FeatureWeights[GetNnueFeature(perspective, piece, square)]);
+	}
+}
+
+void NnueRemovePiece(s16 accumulator[2][NnueHiddenSize], const Piece piece, const Square square)
+{
+	for (Color perspective = WHITE; perspective <= BLACK; perspective++)
+	{
+		SubtractWeights(accumulator[perspective], NnueNetwork->FeatureWeights[GetNnueFeature(perspective, piece, square)]);
+	}
+}
+
+void NnueMovePiece(s16 accumulator[2][NnueHiddenSize], const Piece piece, const Square from, const Square to)
+{
+	for (Color perspective = WHITE; perspective <= BLACK; perspective++)
+	{
+		AddSubtractWeights(accumulator[perspective],
+			NnueNetwork->FeatureWeights[GetNnueFeature(perspective, piece, to)],
+			NnueNetwork->FeatureWeights[GetNnueFeature(perspective, piece, from)]);
+	}
+}
+
+void NnueRefreshAccumulator(const Position &position, s16 accumulator[2][NnueHiddenSize])
+{
+	ASSERT(NnueNetwork != 0);
+
+	for (Color perspective = WHITE; perspective <= BLACK; perspective++)
+	{
+		memcpy(accumulator[perspective], NnueNetwork->FeatureBias, sizeof(NnueNetwork->FeatureBias));
+	}
+
+	Bitboard b = position.GetAllPieces();
+	while (b)
+	{
+		const Square square = PopFirstBit(b);
+		NnueAddPiece(accumulator, position.Board[square], square);
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Affine layers
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Clipped ReLU of one perspective's accumulator, packed down to bytes
+inline void ClipAccumulator(const s16 *accumulator, u8 *output)
+{
+#if defined(USE_SSE2)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i maximum = _mm_set1_epi16(NnueActivationScale);
+	for (int i = 0; i < NnueHiddenSize; i += 16)
+	{
+		const __m128i a = _mm_min_epi16(_mm_max_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(accumulator + i)), zero), maximum);
+		const __m128i b = _mm_min_epi16(_mm_max_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(accumulator + i + 8)), zero), maximum);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packus_epi16(a, b));
+	}
+#else
+	for (int i = 0; i < NnueHiddenSize; i++)
+	{
+		output[i] = u8(min(max(int(accumulator[i]), 0), NnueActivationScale));
+	}
+#endif
+}
+
+// Dot product of the 2 * NnueHiddenSize clipped inputs with one row of int8 weights
+inline s32 DotProduct(const u8 *input, const s8 *weights)
+{
+#if defined(USE_AVX2)
+	// Inputs are at most 127, so the pairwise sums of maddubs can't saturate
+	const __m256i ones = _mm256_set1_epi16(1);
+	__m256i sum = _mm256_setzero_si256();
+	for (int i = 0; i < 2 * NnueHiddenSize; i += 32)
+	{
+		const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+		const __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(weights + i));
+		sum = _mm256_add_epi32(sum, _mm256_madd_epi16(_mm256_maddubs_epi16(x, w), ones));
+	}
+	__m128i result = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+#elif defined(USE_SSE2)
+	// No maddubs before SSSE3, so widen both sides to 16 bits
+	const __m128i zero = _mm_setzero_si128();
+	__m128i result = zero;
+	for (int i = 0; i < 2 * NnueHiddenSize; i += 16)
+	{
+		const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+		const __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i*>(weights + i));
+		result = _mm_add_epi32(result, _mm_madd_epi16(_mm_unpacklo_epi8(x, zero), _mm_srai_epi16(_mm_unpacklo_epi8(w, w), 8)));
+		result = _mm_add_epi32(result, _mm_madd_epi16(_mm_unpackhi_epi8(x, zero), _mm_srai_epi16(_mm_unpackhi_epi8(w, w), 8)));
+	}
+#else
+	s32 result = 0;
+	for (int i = 0; i < 2 * NnueHiddenSize; i++)
+	{
+		result += s32(input[i]) * s32(weights[i]);
+	}
+	return result;
+#endif
+
+#if defined(USE_SSE2)
+	result = _mm_add_epi32(result, _mm_shuffle_epi32(result, 0x4E));
+	result = _mm_add_epi32(result, _mm_shuffle_epi32(result, 0xB1));
+	return _mm_cvtsi128_si32(result);
+#endif
+}
+
+int NnueEvaluate(const Position &position)
+{
+	ASSERT(NnueEnabled);
+
+	const NnueWeights &network = *NnueNetwork;
+
+	u8 input[2 * NnueHiddenSize];
+	ClipAccumulator(position.NnueAccumulator[position.ToMove], input);
+	ClipAccumulator(position.NnueAccumulator[FlipColor(position.ToMove)], input + NnueHiddenSize);
+
+	s32 output = network.OutputBias;
+	for (int i = 0; i < NnueHidden2Size; i++)
+	{
+		const s32 hidden = (network.HiddenBias[i] + DotProduct(input, network.HiddenWeights[i])) / NnueWeightScale;
+		output += min(max(hidden, 0), NnueActivationScale) * network.OutputWeights[i];
+	}
+
+	// The output is in pawns, scaled by both quantization factors
+	return (output * 100) / (NnueActivationScale * NnueWeightScale);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Training
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Largest int8 weight we can represent
+const float NnueMaxWeight = 127.0f / NnueWeightScale;
+
+struct NnueTrainingSample
+{
+	// Active features from the side to move's perspective, then the other side's
+	short Features[2][32];
+	int FeatureCount;
+	float Target;
+};
+
+struct NnueFloatNetwork
+{
+	std::vector<float> FeatureWeights, FeatureBias;
+	std::vector<float> HiddenWeights, HiddenBias;
+	std::vector<float> OutputWeights;
+	float OutputBias;
+};
+
+static u32 TrainingSeed = 12345;
+
+static float TrainingRandom(const float range)
+{
+	TrainingSeed = TrainingSeed * 1103515245 + 12345;
+	return range * ((float((TrainingSeed >> 8) & 0xffff) / 32768.0f) - 1.0f);
+}
+
+inline float Sigmoid(const float x)
+{
+	return 1.0f / (1.0f + expf(-x));
+}
+
+inline float Clip(const float x)
+{
+	return x < 0 ? 0 : (x > 1 ? 1 : x);
+}
+
+static void AddTrainingSample(const Position &position, std::vector<NnueTrainingSample> &samples)
+{
+	NnueTrainingSample sample;
+	sample.FeatureCount = 0;
+
+	Bitboard b = position.GetAllPieces();
+	while (b)
+	{
+		const Square square = PopFirstBit(b);
+		sample.Features[0][sample.FeatureCount] = short(GetNnueFeature(position.ToMove, position.Board[square], square));
+		sample.Features[1][sample.FeatureCount] = short(GetNnueFeature(FlipColor(position.ToMove), position.Board[square], square));
+		sample.FeatureCount++;
+	}
+
+	// Targets are win probabilities, the usual 400cp logistic scale
+	EvalInfo evalInfo;
+	sample.Target = Sigmoid(float(Evaluate(position, evalInfo)) / 400.0f);
+
+	samples.push_back(sample);
+}
+
+// One step of stochastic gradient descent, returns the squared error before the step
+static float TrainSample(NnueFloatNetwork &network, const NnueTrainingSample &sample, const float learningRate)
+{
+	float accumulator[2 * NnueHiddenSize], hidden[2 * NnueHiddenSize];
+	for (int perspective = 0; perspective < 2; perspective++)
+	{
+		float *a = accumulator + perspective * NnueHiddenSize;
+		for (int j = 0; j < NnueHiddenSize; j++)
+		{
+			a[j] = network.FeatureBias[j];
+		}
+		for (int f = 0; f < sample.FeatureCount; f++)
+		{
+			const float *w = &network.FeatureWeights[sample.Features[perspective][f] * NnueHiddenSize];
+			for (int j = 0; j < NnueHiddenSize; j++)
+			{
+				a[j] += w[j];
+			}
+		}
+	}
+	for (int i = 0; i < 2 * NnueHiddenSize; i++)
+	{
+		hidden[i] = Clip(accumulator[i]);
+	}
+
+	float hidden2Sum[NnueHidden2Size], hidden2[NnueHidden2Size];
+	float output = network.OutputBias;
+	for (int k = 0; k < NnueHidden2Size; k++)
+	{
+		const float *w = &network.HiddenWeights[k * 2 * NnueHiddenSize];
+		float sum = network.HiddenBias[k];
+		for (int i = 0; i < 2 * NnueHiddenSize; i++)
+		{
+			sum += w[i] * hidden[i];
+		}
+		hidden2Sum[k] = sum;
+		hidden2[k] = Clip(sum);
+		output += network.OutputWeights[k] * hidden2[k];
+	}
+
+	// The output is in pawns
+	const float predicted = Sigmoid(output * 100.0f / 400.0f);
+	const float error = predicted - sample.Target;
+	const float outputGradient = 2.0f * error * predicted * (1.0f - predicted) * (100.0f / 400.0f);
+
+	float hiddenGradient[2 * NnueHiddenSize];
+	for (int i = 0; i < 2 * NnueHiddenSize; i++)
+	{
+		hiddenGradient[i] = 0;
+	}
+
+	for (int k = 0; k < NnueHidden2Size; k++)
+	{
+		const float hidden2Gradient = (hidden2Sum[k] > 0 && hidden2Sum[k] < 1) ? outputGradient * network.OutputWeights[k] : 0;
+
+		network.OutputWeights[k] = min(max(network.OutputWeights[k] - learningRate * outputGradient * hidden2[k], -NnueMaxWeight), NnueMaxWeight);
+
+		if (hidden2Gradient != 0)
+		{
+			float *w = &network.HiddenWeights[k * 2 * NnueHiddenSize];
+			for (int i = 0; i < 2 * NnueHiddenSize; i++)
+			{
+				hiddenGradient[i] += hidden2Gradient * w[i];
+				w[i] = min(max(w[i] - learningRate * hidden2Gradient * hidden[i], -NnueMaxWeight), NnueMaxWeight);
+			}
+			network.HiddenBias[k] -= learningRate * hidden2Gradient;
+		}
+	}
+	network.OutputBias -= learningRate * outputGradient;
+
+	for (int i = 0; i < 2 * NnueHiddenSize; i++)
+	{
+		if (accumulator[i] <= 0 || accumulator[i] >= 1)
+		{
+			hiddenGradient[i] = 0;
+		}
+	}
+
+	for (int perspective = 0; perspective < 2; perspective++)
+	{
+		const float *g = hiddenGradient + perspective * NnueHiddenSize;
+		for (int f = 0; f < sample.FeatureCount; f++)
+		{
+			float *w = &network.FeatureWeights[sample.Features[perspective][f] * NnueHiddenSize];
+			for (int j = 0; j < NnueHiddenSize; j++)
+			{
+				w[j] -= learningRate * g[j];
+			}
+		}
+		for (int j = 0; j < NnueHiddenSize; j++)
+		{
+			network.FeatureBias[j] -= learningRate * g[j];
+		}
+	}
+
+	return error * error;
+}
+
+inline s32 Quantize(const float value, const float scale, const s32 limit)
+{
+	const s32 result = s32(floorf(value * scale + 0.5f));
+	return min(max(result, -limit), limit);
+}
+
+static bool WriteNnue(const NnueFloatNetwork &network, const std::string &filename)
+{
+	NnueFileHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.Magic, "GCNN", 4);
+	header.Version = NnueVersion;
+	header.InputSize = NnueInputSize;
+	header.HiddenSize = NnueHiddenSize;
+	header.Hidden2Size = NnueHidden2Size;
+
+	NnueWeights *weights = new NnueWeights;
+	memset(weights, 0, sizeof(NnueWeights));
+
+	const float biasScale = float(NnueActivationScale) * NnueWeightScale;
+	for (int f = 0; f < NnueInputSize; f++)
+	{
+		for (int j = 0; j < NnueHiddenSize; j++)
+		{
+			weights->FeatureWeights[f][j] = s16(Quantize(network.FeatureWeights[f * NnueHiddenSize + j], NnueActivationScale, 32767));
+		}
+	}
+	for (int j = 0; j < NnueHiddenSize; j++)
+	{
+		weights->FeatureBias[j] = s16(Quantize(network.FeatureBias[j], NnueActivationScale, 32767));
+	}
+	for (int k = 0; k < NnueHidden2Size; k++)
+	{
+		for (int i = 0; i < 2 * NnueHiddenSize; i++)
+		{
+			weights->HiddenWeights[k][i] = s8(Quantize(network.HiddenWeights[k * 2 * NnueHiddenSize + i], NnueWeightScale, 127));
+		}
+		weights->HiddenBias[k] = Quantize(network.HiddenBias[k], biasScale, 0x7fffffff);
+		weights->OutputWeights[k] = s8(Quantize(network.OutputWeights[k], NnueWeightScale, 127));
+	}
+	weights->OutputBias = Quantize(network.OutputBias, biasScale, 0x7fffffff);
+
+	std::FILE *file = std::fopen(filename.c_str(), "wb");
+	bool result = false;
+	if (file != NULL)
+	{
+		result = std::fwrite(&header, sizeof(header), 1, file) == 1 && std::fwrite(weights, sizeof(NnueWeights), 1, file) == 1;
+		std::fclose(file);
+	}
+
+	delete weights;
+	return result;
+}
+
+void TrainNnue(const std::string &epdFilename, const std::string &netFilename, const int epochs)
+{
+	std::FILE *file = std::fopen(epdFilename.c_str(), "rt");
+	if (file == NULL)
+	{
+		printf("Unable to open %s\n", epdFilename.c_str());
+		return;
+	}
+
+	// Targets come from the hand-crafted evaluation
+	const NnueWeights *previousNetwork = NnueNetwork;
+	SetNnueNetwork(0);
+
+	std::vector<NnueTrainingSample> samples;
+	char line[500];
+	while (std::fgets(line, 500, file) != NULL)
+	{
+		Position position;
+		position.Initialize(line);
+		AddTrainingSample(position, samples);
+
+		Move moves[256];
+		const int moveCount = GenerateLegalMoves(position, moves);
+		for (int i = 0; i < moveCount; i++)
+		{
+			MoveUndo moveUndo;
+			position.MakeMove(moves[i], moveUndo);
+			AddTrainingSample(position, samples);
+			position.UnmakeMove(moves[i], moveUndo);
+		}
+	}
+	std::fclose(file);
+
+	SetNnueNetwork(previousNetwork);
+
+	printf("Training on %d positions\n", int(samples.size()));
+
+	NnueFloatNetwork network;
+	network.FeatureWeights.resize(NnueInputSize * NnueHiddenSize);
+	network.FeatureBias.resize(NnueHiddenSize);
+	network.HiddenWeights.resize(NnueHidden2Size * 2 * NnueHiddenSize);
+	network.HiddenBias.resize(NnueHidden2Size);
+	network.OutputWeights.resize(NnueHidden2Size);
+	network.OutputBias = 0;
+
+	for (size_t i = 0; i < network.FeatureWeights.size(); i++) network.FeatureWeights[i] = TrainingRandom(0.1f);
+	for (size_t i = 0; i < network.FeatureBias.size(); i++) network.FeatureBias[i] = 0.25f;
+	for (size_t i = 0; i < network.HiddenWeights.size(); i++) network.HiddenWeights[i] = TrainingRandom(0.1f);
+	for (size_t i = 0; i < network.HiddenBias.size(); i++) network.HiddenBias[i] = 0.1f;
+	for (size_t i = 0; i < network.OutputWeights.size(); i++) network.OutputWeights[i] = TrainingRandom(0.5f);
+
+	std::vector<int> order(samples.size());
+	for (size_t i = 0; i < order.size(); i++)
+	{
+		order[i] = int(i);
+	}
+
+	float learningRate = 0.01f;
+	for (int epoch = 0; epoch < epochs; epoch++)
+	{
+		const u64 startTime = GetCurrentMilliseconds();
+
+		for (size_t i = order.size() - 1; i > 0; i--)
+		{
+			TrainingSeed = TrainingSeed * 1103515245 + 12345;
+			const size_t j = size_t(TrainingSeed >> 1) % (i + 1);
+			const int tmp = order[i];
+			order[i] = order[j];
+			order[j] = tmp;
+		}
+
+		double error = 0;
+		for (size_t i = 0; i < order.size(); i++)
+		{
+			error += TrainSample(network, samples[order[i]], learningRate);
+		}
+
+		printf("Epoch %d: error %.6lf (%d ms)\n", epoch + 1, error / max(size_t(1), samples.size()), int(GetCurrentMilliseconds() - startTime));
+
+		if ((epoch + 1) % 10 == 0)
+		{
+			learningRate *= 0.5f;
+		}
+	}
+
+	if (!WriteNnue(network, netFilename))
+	{
+		printf("Unable to write %s\n", netFilename.c_str());
+	}
+}
@@ -0,0 +1,64 @@
+// Efficiently updatable neural network evaluation, an alternative to the hand-crafted Evaluate.
+//
+// Each side sees the board from its own perspective through 768 piece-square inputs (6 piece types x 2 colors x 64
+// squares, flipped for black).  The inputs feed NnueHiddenSize int16 accumulators per side, which Position keeps
+// up to date in MakeMove/UnmakeMove.  Both clipped accumulators (side to move first) go through an int8 affine layer
+// of NnueHidden2Size outputs, and a final int8 affine layer gives the score.
+const int NnueInputSize = 768;
+const int NnueHidden2Size = 32;
+
+// Quantization: activations are clipped to [0, NnueActivationScale], int8 weights are scaled by NnueWeightScale
+const int NnueActivationScale = 127;
+const int NnueWeightScale = 64;
+
+struct NnueWeights
+{
+	s16 FeatureWeights[NnueInputSize][NnueHiddenSize];
+	s16 FeatureBias[NnueHiddenSize];
+	s8 HiddenWeights[NnueHidden2Size][2 * NnueHiddenSize];
+	s32 HiddenBias[NnueHidden2Size];
+	s8 OutputWeights[NnueHidden2Size];
+	s32 OutputBias;
+};
+
+// Network files are a NnueFileHeader followed by the raw NnueWeights (little endian)
+struct NnueFileHeader
+{
+	char Magic[4];
+	u32 Version;
+	u32 InputSize;
+	u32 HiddenSize;
+	u32 Hidden2Size;
+	u32 Reserved[3];
+};
+
+// Set when the network is evaluating, Position only maintains the accumulators while it is
+extern bool NnueEnabled;
+extern const NnueWeights *NnueNetwork;
+
+// Maps a network file, returns false (leaving the current network alone) if it is missing or malformed
+bool LoadNnue(const std::string &filename);
+
+// Uses network (which must stay valid), 0 disables the network evaluation
+void SetNnueNetwork(const NnueWeights *network);
+
+// Score from the side to move's point of view, in centipawns
+int NnueEvaluate(const Position &position);
+
+void NnueRefreshAccumulator(const Position &position, s16 accumulator[2][NnueHiddenSize]);
+
+inline int GetNnueFeature(const Color perspective, const Piece piece, const Square square)
+{
+	const Square relativeSquare = perspective == WHITE ? square : FlipSquare(square);
+	const int relativeColor = GetPieceColor(piece) == perspective ? 0 : 1;
+	return ((relativeColor * 6) + GetPieceType(piece) - PAWN) * 64 + relativeSquare;
+}
+
+// Incremental accumulator updates, for both perspectives
+void NnueAddPiece(s16 accumulator[2][NnueHiddenSize], const Piece piece, const Square square);
+void NnueRemovePiece(s16 accumulator[2][NnueHiddenSize], const Piece piece, const Square square);
+void NnueMovePiece(s16 accumulator[2][NnueHiddenSize], const Piece piece, const Square from, const Square to);
+
+// Trains a network on the positions in an EPD file (and their children) to reproduce the hand-crafted evaluation,
+// then quantizes and writes it to netFilename.  Single threaded, float math.
+void TrainNnue(const std::string &epdFilename, const std::string &netFilename, const int epochs);
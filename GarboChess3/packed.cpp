@@ -0,0 +1,106 @@
+#include "garbochess.h"
+#include "position.h"
+#include "evaluation.h"
+#include "packed.h"
+
+#include <cstdio>
+
+bool PackPosition(const Position &position, PackedPosition &packed)
+{
+	const Bitboard allPieces = position.GetAllPieces();
+	if (CountBitsSet(allPieces) > 32)
+	{
+		return false;
+	}
+
+	packed.Occupied = allPieces;
+	for (int i = 0; i < 16; i++)
+	{
+		packed.Pieces[i] = 0;
+	}
+
+	Bitboard pieces = allPieces;
+	for (int i = 0; pieces; i++)
+	{
+		const Square square = PopFirstBit(pieces);
+		packed.Pieces[i >> 1] |= u8(position.Board[square] << ((i & 1) * 4));
+	}
+
+	packed.Flags = u8(position.CastleFlags | (position.ToMove == BLACK ? PackedFlagBlackToMove : 0));
+	packed.EnPassent = u8(position.EnPassent == -1 ? 0 : position.EnPassent);
+	packed.Fifty = u8(min(position.Fifty, 255));
+	packed.Result = PackedResultUnknown;
+	packed.Score = 0;
+	packed.BestMove = 0;
+	return true;
+}
+
+void UnpackPosition(const PackedPosition &packed, Position &position)
+{
+	Piece board[64];
+	for (Square square = 0; square < 64; square++)
+	{
+		board[square] = PIECE_NONE;
+	}
+
+	Bitboard pieces = packed.Occupied;
+	for (int i = 0; pieces; i++)
+	{
+		const Square square = PopFirstBit(pieces);
+		board[square] = (packed.Pieces[i >> 1] >> ((i & 1) * 4)) & 15;
+	}
+
+	position.Initialize(
+		board,
+		(packed.Flags & PackedFlagBlackToMove) ? BLACK : WHITE,
+		packed.Flags & CastleFlagMask,
+		packed.EnPassent == 0 ? -1 : packed.EnPassent,
+		packed.Fifty);
+}
+
+bool IsPackedFilename(const std::string &filename)
+{
+	const std::string extension = ".packed";
+	return filename.size() > extension.size() &&
+		filename.compare(filename.size() - extension.size(), extension.size(), extension) == 0;
+}
+
+const PackedPosition *MapPackedPositions(const std::string &filename, u64 &count)
+{
+	u64 size;
+	const void *data = MapFile(filename.c_str(), size);
+	if (data == 0)
+	{
+		return 0;
+	}
+
+	if (size % sizeof(PackedPosition) != 0)
+	{
+		UnmapFile(data, size);
+		return 0;
+	}
+
+	count = size / sizeof(PackedPosition);
+	return reinterpret_cast<const PackedPosition*>(data);
+}
+
+void UnmapPackedPositions(const PackedPosition *positions, const u64 count)
+{
+	UnmapFile(positions, count * sizeof(PackedPosition));
+}
+
+std::FILE *OpenPackedPositions(const std::string &filename, const bool append)
+{
+	std::FILE *file = std::fopen(filename.c_str(), append ? "ab" : "wb");
+	if (file != NULL)
+	{
+		// Positions are written a few at a time, a big buffer keeps that from being a system call each
+		std::setvbuf(file, NULL, _IOFBF, 1 << 20);
+	}
+	return file;
+}
+
+bool WritePackedPositions(std::FILE *file, const PackedPosition *positions, const int count)
+{
+	return int(std::fwrite(positions, sizeof(PackedPosition), count, file)) == count;
+}
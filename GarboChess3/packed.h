@@ -0,0 +1,42 @@
+#include <cstdio>
+
+// Positions packed into 32 bytes, for data sets too big to keep as EPD (training data, self-play games, batch
+// analysis).
+//
+// The occupied squares are a bitboard, followed by the Piece on each of them in square order, 4 bits each, so
+// decoding is a walk over the set bits.  The remaining bytes hold the rest of a FEN and the labels a data set usually
+// carries: the game result, a search score and the best move.  Files are the raw records in native byte order with no
+// header, so they can be concatenated and mapped as an array.
+struct PackedPosition
+{
+	Bitboard Occupied;
+	u8 Pieces[16];		// two per byte, the lower square in the low nibble
+	u8 Flags;			// castle flags, and PackedFlagBlackToMove
+	u8 EnPassent;		// 0 for none (a8 can never be an en passant square)
+	u8 Fifty;
+	u8 Result;			// PackedResult*, from white's point of view
+	s16 Score;			// for the side to move
+	Move BestMove;
+};
+
+const int PackedFlagBlackToMove = 16;
+
+const int PackedResultBlackWin = 0;
+const int PackedResultDraw = 1;
+const int PackedResultWhiteWin = 2;
+const int PackedResultUnknown = 3;
+
+// Returns false if the position has more than 32 pieces.  The result is left unknown, with no score or move.
+bool PackPosition(const Position &position, PackedPosition &packed);
+void UnpackPosition(const PackedPosition &packed, Position &position);
+
+// Files of packed positions are recognized by their extension
+bool IsPackedFilename(const std::string &filename);
+
+// Maps a whole file read only, returns 0 if it can't be opened or isn't a whole number of positions
+const PackedPosition *MapPackedPositions(const std::string &filename, u64 &count);
+void UnmapPackedPositions(const PackedPosition *positions, const u64 count);
+
+// Writing goes through stdio (close with fclose), appending lets several runs build one file
+std::FILE *OpenPackedPositions(const std::string &filename, const bool append);
+bool WritePackedPositions(std::FILE *file, const PackedPosition *positions, const int count);
@@ -0,0 +1,241 @@
+#include "garbochess.h"
+#include "position.h"
+#include "movegen.h"
+#include "evaluation.h"
+#include "perft.h"
+#include "utilities.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+struct PerftHashEntry
+{
+	// The lock is the key xor'd with the count.  A torn write from another thread will fail the lock check
+	// instead of returning a bogus count, so the table can be shared without any locking.
+	u64 Lock;
+	u64 Count;
+};
+
+static PerftHashEntry *PerftHash = 0;
+static u64 PerftHashMask = 0;
+
+void InitializePerftHash(const int hashSize)
+{
+	if (PerftHash)
+	{
+		free(PerftHash);
+		PerftHash = 0;
+		PerftHashMask = 0;
+	}
+
+	if (hashSize <= 0)
+	{
+		return;
+	}
+
+	const u64 maxEntries = (u64(hashSize) * 1024 * 1024) / sizeof(PerftHashEntry);
+	u64 entries;
+	for (entries = 1; entries * 2 <= maxEntries; entries *= 2);
+
+	const size_t allocSize = (size_t)(entries * sizeof(PerftHashEntry));
+	PerftHash = (PerftHashEntry*)malloc(allocSize);
+	memset(PerftHash, 0, allocSize);
+	PerftHashMask = entries - 1;
+}
+
+inline u64 GetPerftKey(const u64 hash, const int depth)
+{
+	return hash ^ (u64(depth) * 0x9E3779B97F4A7C15ULL);
+}
+
+static u64 PerftInternal(Position &position, const int depth)
+{
+	ASSERT(depth >= 1);
+
+	Move moves[256];
+
+	if (position.IsInCheck())
+	{
+		// Check escapes are fully legal, so the last ply can be counted without making the moves
+		const int moveCount = GenerateCheckEscapeMoves(position, moves);
+		if (depth == 1)
+		{
+			return moveCount;
+		}
+
+		u64 result = 0;
+		for (int i = 0; i < moveCount; i++)
+		{
+			MoveUndo moveUndo;
+			position.MakeMove(moves[i], moveUndo);
+			result += PerftInternal(position, depth - 1);
+			position.UnmakeMove(moves[i], moveUndo);
+		}
+		return result;
+	}
+
+	int moveCount = GenerateQuietMoves(position, moves);
+	moveCount += GenerateCaptureMoves(position, moves + moveCount);
+
+	if (depth == 1)
+	{
+		// Bulk counting
+		const Bitboard pinned = position.GetPinnedPieces(position.KingPos[position.ToMove], position.ToMove);
+		u64 result = 0;
+		for (int i = 0; i < moveCount; i++)
+		{
+			if (IsMoveLegal(position, moves[i], pinned))
+			{
+				result++;
+			}
+		}
+		return result;
+	}
+
+	const u64 key = GetPerftKey(position.Hash, depth);
+	PerftHashEntry *hashEntry = PerftHash ? PerftHash + (key & PerftHashMask) : 0;
+	if (hashEntry)
+	{
+		const u64 count = hashEntry->Count;
+		if ((hashEntry->Lock ^ count) == key)
+		{
+			return count;
+		}
+	}
+
+	u64 result = 0;
+	for (int i = 0; i < moveCount; i++)
+	{
+		MoveUndo moveUndo;
+		position.MakeMove(moves[i], moveUndo);
+		if (!position.CanCaptureKing())
+		{
+			result += PerftInternal(position, depth - 1);
+		}
+		position.UnmakeMove(moves[i], moveUndo);
+	}
+
+	if (hashEntry)
+	{
+		hashEntry->Lock = key ^ result;
+		hashEntry->Count = result;
+	}
+
+	return result;
+}
+
+u64 Perft(Position &position, const int depth)
+{
+	if (depth <= 0)
+	{
+		return 1;
+	}
+	return PerftInternal(position, depth);
+}
+
+struct PerftWork
+{
+	const Position *Root;
+	const Move *Moves;
+	u64 *Counts;
+	int MoveCount;
+	int Depth;
+	volatile int NextMove;
+};
+
+static void PerftThread(void *argument)
+{
+	PerftWork &work = *(PerftWork*)argument;
+
+	Position position;
+	work.Root->Clone(position);
+
+	for (;;)
+	{
+		const int i = AtomicIncrement(work.NextMove) - 1;
+		if (i >= work.MoveCount)
+		{
+			break;
+		}
+
+		MoveUndo moveUndo;
+		position.MakeMove(work.Moves[i], moveUndo);
+		work.Counts[i] = Perft(position, work.Depth - 1);
+		position.UnmakeMove(work.Moves[i], moveUndo);
+	}
+}
+
+u64 PerftDivide(const Position &position, const int depth, const int threadCount, Move *moves, u64 *counts, int &moveCount)
+{
+	ASSERT(depth >= 1);
+
+	Position root;
+	position.Clone(root);
+	moveCount = GenerateLegalMoves(root, moves);
+
+	PerftWork work;
+	work.Root = &root;
+	work.Moves = moves;
+	work.Counts = counts;
+	work.MoveCount = moveCount;
+	work.Depth = depth;
+	work.NextMove = 0;
+
+	const int helperCount = min(threadCount, moveCount) - 1;
+	ThreadHandle threads[256];
+	for (int i = 0; i < helperCount; i++)
+	{
+		threads[i] = StartThread(PerftThread, &work);
+	}
+
+	// The calling thread does its share of the work as well
+	PerftThread(&work);
+
+	for (int i = 0; i < helperCount; i++)
+	{
+		WaitForThread(threads[i]);
+	}
+
+	u64 result = 0;
+	for (int i = 0; i < moveCount; i++)
+	{
+		result += counts[i];
+	}
+	return result;
+}
+
+void RunPerft(const Position &position, const int depth, const int threadCount, const bool divide)
+{
+	const u64 startTime = GetCurrentMilliseconds();
+
+	Move moves[256];
+	u64 counts[256];
+	int moveCount;
+	u64 total;
+
+	if (depth <= 0)
+	{
+		moveCount = 0;
+		total = 1;
+	}
+	else
+	{
+		total = PerftDivide(position, depth, threadCount, moves, counts, moveCount);
+	}
+
+	const u64 msTaken = GetCurrentMilliseconds() - startTime;
+
+	if (divide)
+	{
+		for (int i = 0; i < moveCount; i++)
+		{
+			printf("%s: %lld\n", GetMoveUci(moves[i]).c_str(), counts[i]);
+		}
+		printf("Moves: %d\n", moveCount);
+	}
+
+	printf("Nodes: %lld\n", total);
+	printf("Time: %lld ms\n", msTaken);
+	printf("NPS: %lld\n", (total * 1000) / max(1ULL, msTaken));
+}
\ No newline at end of file
@@ -0,0 +1,10 @@
+// Hash size in megabytes, 0 disables the perft hash
+void InitializePerftHash(const int hashSize);
+
+// Counts the leaf nodes of the legal move tree to the given depth, using bulk counting at the last ply.
+u64 Perft(Position &position, const int depth);
+
+// Splits the root moves across threads.  The per-move counts are returned in moves/counts (used by divide).
+u64 PerftDivide(const Position &position, const int depth, const int threadCount, Move *moves, u64 *counts, int &moveCount);
+
+void RunPerft(const Position &position, const int depth, const int threadCount, const bool divide);
\ No newline at end of file
@@ -0,0 +1,574 @@
+#include "garbochess.h"
+#include "position.h"
+#include "movegen.h"
+#include "evaluation.h"
+#include "utilities.h"
+#include "book.h"
+#include "packed.h"
+#include "pgn.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// The threads take about this much of the file at a time
+const int PgnChunkSize = 1 << 20;
+
+// Chunks parsed (per thread) before their output is written, which keeps the output in file order
+const int PgnChunksPerThread = 4;
+
+static const char *PgnStartFen = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+static const char *PgnResultStrings[] = { "1-0", "1/2-1/2", "0-1", "*" };
+
+static int ParsePgnResult(const char *text, const int length)
+{
+	for (int i = PgnResultWhiteWin; i <= PgnResultUnknown; i++)
+	{
+		if (length == (int)strlen(PgnResultStrings[i]) && memcmp(text, PgnResultStrings[i], length) == 0)
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+inline bool IsPgnSpace(const char c)
+{
+	return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+static const char *SkipPgnLine(const char *text, const char *end)
+{
+	const char *newline = (const char*)memchr(text, '\n', end - text);
+	return newline == NULL ? end : newline + 1;
+}
+
+// One tag pair like [Result "1-0"], the rest of the line is skipped
+static void ReadPgnTag(const char *&text, const char *end, PgnGame &game)
+{
+	const char *name = ++text;
+	while (text < end && !IsPgnSpace(*text) && *text != ']')
+	{
+		text++;
+	}
+	const int nameLength = int(text - name);
+
+	std::string value;
+	while (text < end && *text != '"' && *text != '\n')
+	{
+		text++;
+	}
+	if (text < end && *text == '"')
+	{
+		for (text++; text < end && *text != '"' && *text != '\n'; text++)
+		{
+			if (*text == '\\' && text + 1 < end)
+			{
+				text++;
+			}
+			value += *text;
+		}
+	}
+	text = SkipPgnLine(text, end);
+
+	if (nameLength == 3 && memcmp(name, "FEN", 3) == 0)
+	{
+		game.StartFen = value;
+	}
+	else if (nameLength == 6 && memcmp(name, "Result", 6) == 0)
+	{
+		const int result = ParsePgnResult(value.c_str(), (int)value.size());
+		if (result != -1)
+		{
+			game.Result = result;
+		}
+	}
+}
+
+bool ReadPgnGame(const char *&text, const char *end, PgnGame &game)
+{
+	game.StartFen.clear();
+	game.Result = PgnResultUnknown;
+	game.Moves.clear();
+	game.Error = false;
+
+	const char *first = text;
+	while (text < end && IsPgnSpace(*text))
+	{
+		text++;
+	}
+	if (text == end)
+	{
+		return false;
+	}
+
+	while (text < end && *text == '[')
+	{
+		ReadPgnTag(text, end, game);
+		while (text < end && IsPgnSpace(*text))
+		{
+			text++;
+		}
+	}
+
+	Position position;
+	position.Initialize(game.StartFen.empty() ? PgnStartFen : game.StartFen);
+
+	int variationDepth = 0;
+	while (text < end)
+	{
+		const char c = *text;
+		if (IsPgnSpace(c))
+		{
+			text++;
+		}
+		else if (c == '[' && (text == first || text[-1] == '\n'))
+		{
+			// Tags of the next game, this one had no result
+			break;
+		}
+		else if (c == '{')
+		{
+			const char *close = (const char*)memchr(text, '}', end - text);
+			text = close == NULL ? end : close + 1;
+		}
+		else if (c == ';' || (c == '%' && (text == first || text[-1] == '\n')))
+		{
+			text = SkipPgnLine(text, end);
+		}
+		else if (c == '(')
+		{
+			variationDepth++;
+			text++;
+		}
+		else if (c == ')')
+		{
+			variationDepth = max(0, variationDepth - 1);
+			text++;
+		}
+		else
+		{
+			const char *token = text;
+			while (text < end && !IsPgnSpace(*text) && strchr("{}();[", *text) == NULL)
+			{
+				text++;
+			}
+			if (text == token)
+			{
+				// A stray ']' or '}'
+				text++;
+				continue;
+			}
+
+			if (variationDepth > 0 || *token == '$')
+			{
+				continue;
+			}
+
+			const int result = ParsePgnResult(token, int(text - token));
+			if (result != -1)
+			{
+				if (game.Result == PgnResultUnknown)
+				{
+					game.Result = result;
+				}
+				break;
+			}
+
+			// Move numbers, possibly stuck to the move ("12.e4", "12...Nf6")
+			if (*token >= '1' && *token <= '9')
+			{
+				while (token < text && *token >= '0' && *token <= '9')
+				{
+					token++;
+				}
+				while (token < text && *token == '.')
+				{
+					token++;
+				}
+			}
+
+			if (token == text || game.Error || (text - token == 4 && memcmp(token, "e.p.", 4) == 0))
+			{
+				continue;
+			}
+
+			const Move move = MakeMoveFromSanString(position, std::string(token, text));
+			if (move == 0)
+			{
+				game.Error = true;
+				continue;
+			}
+
+			game.Moves.push_back(move);
+
+			MoveUndo moveUndo;
+			position.MakeMove(move, moveUndo);
+			if (position.Fifty == 0)
+			{
+				position.ResetMoveDepth();
+			}
+		}
+	}
+
+	return true;
+}
+
+// The first game starting at or after text: a tag line that doesn't follow another tag line
+static const char *FindPgnGameStart(const char *begin, const char *text, const char *end)
+{
+	if (text > begin && text[-1] != '\n')
+	{
+		text = SkipPgnLine(text, end);
+	}
+
+	for (; text < end; text = SkipPgnLine(text, end))
+	{
+		if (*text != '[')
+		{
+			continue;
+		}
+
+		const char *previous = text;
+		while (previous > begin && IsPgnSpace(previous[-1]))
+		{
+			previous--;
+		}
+		if (previous == begin)
+		{
+			return text;
+		}
+
+		while (previous > begin && previous[-1] != '\n')
+		{
+			previous--;
+		}
+		if (*previous != '[')
+		{
+			return text;
+		}
+	}
+
+	return end;
+}
+
+struct PgnBookMove
+{
+	u64 Key;
+	u32 Weight;
+	u16 Move;
+};
+
+static bool ComparePgnBookMoves(const PgnBookMove &a, const PgnBookMove &b)
+{
+	if (a.Key != b.Key)
+	{
+		return a.Key < b.Key;
+	}
+	return a.Move < b.Move;
+}
+
+// Sorts and adds up the weights of repeated moves
+static void MergePgnBookMoves(std::vector<PgnBookMove> &moves)
+{
+	std::sort(moves.begin(), moves.end(), ComparePgnBookMoves);
+
+	int count = 0;
+	for (int i = 0; i < (int)moves.size(); i++)
+	{
+		if (count > 0 && moves[count - 1].Key == moves[i].Key && moves[count - 1].Move == moves[i].Move)
+		{
+			moves[count - 1].Weight += moves[i].Weight;
+		}
+		else
+		{
+			moves[count++] = moves[i];
+		}
+	}
+	moves.resize(count);
+}
+
+const int PgnFormatEpd = 0;
+const int PgnFormatBook = 1;
+const int PgnFormatPacked = 2;
+
+struct PgnChunkResult
+{
+	std::string Text;
+	std::vector<PgnBookMove> BookMoves;
+	std::vector<PackedPosition> PackedPositions;
+	int GameCount;
+	int PositionCount;
+	int ErrorCount;
+};
+
+struct PgnWork
+{
+	const char **ChunkStarts;		// ChunkCount + 1 of them
+	PgnChunkResult *Results;		// for the chunks of the current round
+	int Format;
+	int FirstChunk;
+	int LastChunk;
+	volatile int NextChunk;
+};
+
+static void ConvertPgnGame(const PgnGame &game, const int format, PgnChunkResult &result)
+{
+	Position position;
+	position.Initialize(game.StartFen.empty() ? PgnStartFen : game.StartFen);
+
+	for (int i = 0; i < (int)game.Moves.size(); i++)
+	{
+		const Move move = game.Moves[i];
+		if (format == PgnFormatBook)
+		{
+			if (i >= PgnBookPlies)
+			{
+				break;
+			}
+
+			// A win counts double, a loss not at all
+			const int weight = game.Result == PgnResultUnknown ? 0 :
+				game.Result == PgnResultDraw ? 1 :
+				(game.Result == PgnResultWhiteWin) == (position.ToMove == WHITE) ? 2 : 0;
+			if (weight > 0)
+			{
+				PgnBookMove bookMove;
+				bookMove.Key = GetBookKey(position);
+				bookMove.Weight = weight;
+				bookMove.Move = GetBookMove(move);
+				result.BookMoves.push_back(bookMove);
+			}
+		}
+		else if (format == PgnFormatPacked)
+		{
+			PackedPosition packed;
+			if (PackPosition(position, packed))
+			{
+				const int packedResults[] = { PackedResultWhiteWin, PackedResultDraw, PackedResultBlackWin, PackedResultUnknown };
+				packed.Result = u8(packedResults[game.Result]);
+				packed.BestMove = move;
+				result.PackedPositions.push_back(packed);
+			}
+		}
+		else
+		{
+			// EPD has no move counters
+			std::string fen = position.GetFen();
+			fen.resize(fen.rfind(' ', fen.rfind(' ') - 1));
+
+			result.Text += fen;
+			result.Text += " bm ";
+			result.Text += GetMoveSAN(position, move);
+			result.Text += "; c9 \"";
+			result.Text += PgnResultStrings[game.Result];
+			result.Text += "\";\n";
+		}
+		result.PositionCount++;
+
+		MoveUndo moveUndo;
+		position.MakeMove(move, moveUndo);
+		if (position.Fifty == 0)
+		{
+			position.ResetMoveDepth();
+		}
+	}
+}
+
+static void PgnThread(void *argument)
+{
+	PgnWork &work = *(PgnWork*)argument;
+
+	PgnGame game;
+	for (;;)
+	{
+		const int chunk = work.FirstChunk + AtomicIncrement(work.NextChunk) - 1;
+		if (chunk >= work.LastChunk)
+		{
+			break;
+		}
+
+		PgnChunkResult &result = work.Results[chunk - work.FirstChunk];
+		const char *text = work.ChunkStarts[chunk];
+		const char *end = work.ChunkStarts[chunk + 1];
+		while (ReadPgnGame(text, end, game))
+		{
+			result.GameCount++;
+			if (game.Error)
+			{
+				result.ErrorCount++;
+			}
+			ConvertPgnGame(game, work.Format, result);
+		}
+	}
+}
+
+bool ConvertPgn(const std::string &pgnFilename, const std::string &outputFilename, const std::string &format, const int threadCount)
+{
+	int pgnFormat;
+	if (format == "epd")
+	{
+		pgnFormat = PgnFormatEpd;
+	}
+	else if (format == "book")
+	{
+		pgnFormat = PgnFormatBook;
+	}
+	else if (format == "packed")
+	{
+		pgnFormat = PgnFormatPacked;
+	}
+	else
+	{
+		return false;
+	}
+	const bool book = pgnFormat == PgnFormatBook;
+
+	u64 size;
+	const void *data = MapFile(pgnFilename.c_str(), size);
+	if (data == 0)
+	{
+		return false;
+	}
+
+	FILE *output = book ? NULL :
+		pgnFormat == PgnFormatPacked ? OpenPackedPositions(outputFilename, false) :
+		fopen(outputFilename.c_str(), "wt");
+	if (!book && output == NULL)
+	{
+		UnmapFile(data, size);
+		return false;
+	}
+
+	const u64 startTime = GetCurrentMilliseconds();
+
+	// Chunk boundaries moved forward to the next game
+	const char *begin = reinterpret_cast<const char*>(data);
+	const char *end = begin + size;
+	std::vector<const char*> chunkStarts;
+	chunkStarts.push_back(begin);
+	for (u64 offset = PgnChunkSize; offset < size; offset += PgnChunkSize)
+	{
+		const char *start = FindPgnGameStart(begin, max(begin + offset, chunkStarts.back()), end);
+		if (start == end)
+		{
+			break;
+		}
+		chunkStarts.push_back(start);
+	}
+	chunkStarts.push_back(end);
+	const int chunkCount = int(chunkStarts.size()) - 1;
+
+	PgnWork work;
+	work.ChunkStarts = &chunkStarts[0];
+	work.Format = pgnFormat;
+
+	std::vector<PgnBookMove> bookMoves;
+	size_t mergedSize = 0;
+	int gameCount = 0, positionCount = 0, errorCount = 0;
+
+	const int roundSize = threadCount * PgnChunksPerThread;
+	for (int first = 0; first < chunkCount; first += roundSize)
+	{
+		std::vector<PgnChunkResult> results(min(roundSize, chunkCount - first));
+		for (int i = 0; i < (int)results.size(); i++)
+		{
+			results[i].GameCount = results[i].PositionCount = results[i].ErrorCount = 0;
+		}
+
+		work.Results = &results[0];
+		work.FirstChunk = first;
+		work.LastChunk = first + (int)results.size();
+		work.NextChunk = 0;
+
+		const int helperCount = min(threadCount, (int)results.size()) - 1;
+		ThreadHandle threads[256];
+		for (int i = 0; i < helperCount; i++)
+		{
+			threads[i] = StartThread(PgnThread, &work);
+		}
+
+		// The calling thread does its share of the work as well
+		PgnThread(&work);
+
+		for (int i = 0; i < helperCount; i++)
+		{
+			WaitForThread(threads[i]);
+		}
+
+		for (int i = 0; i < (int)results.size(); i++)
+		{
+			gameCount += results[i].GameCount;
+			positionCount += results[i].PositionCount;
+			errorCount += results[i].ErrorCount;
+
+			if (book)
+			{
+				bookMoves.insert(bookMoves.end(), results[i].BookMoves.begin(), results[i].BookMoves.end());
+			}
+			else if (pgnFormat == PgnFormatPacked)
+			{
+				if (!results[i].PackedPositions.empty())
+				{
+					WritePackedPositions(output, &results[i].PackedPositions[0], (int)results[i].PackedPositions.size());
+				}
+			}
+			else
+			{
+				fwrite(results[i].Text.data(), 1, results[i].Text.size(), output);
+			}
+		}
+
+		// Openings repeat a lot, merging as we go keeps the memory down
+		if (book && bookMoves.size() > mergedSize * 2 + 1000000)
+		{
+			MergePgnBookMoves(bookMoves);
+			mergedSize = bookMoves.size();
+		}
+	}
+
+	UnmapFile(data, size);
+
+	bool success = true;
+	if (book)
+	{
+		MergePgnBookMoves(bookMoves);
+
+		// Weights are 16 bits, scale down the moves of positions that don't fit
+		std::vector<BookEntry> entries;
+		entries.reserve(bookMoves.size());
+		for (int i = 0; i < (int)bookMoves.size();)
+		{
+			int last = i;
+			u32 maxWeight = 0;
+			for (; last < (int)bookMoves.size() && bookMoves[last].Key == bookMoves[i].Key; last++)
+			{
+				maxWeight = max(maxWeight, bookMoves[last].Weight);
+			}
+
+			const u32 divisor = (maxWeight + 65534) / 65535;
+			for (; i < last; i++)
+			{
+				BookEntry entry;
+				entry.Key = bookMoves[i].Key;
+				entry.Move = bookMoves[i].Move;
+				entry.Weight = u16(max(1u, bookMoves[i].Weight / divisor));
+				entry.Learn = 0;
+				entries.push_back(entry);
+			}
+		}
+
+		success = WriteBook(outputFilename, entries);
+	}
+	else
+	{
+		fclose(output);
+	}
+
+	const u64 elapsed = max(u64(1), GetCurrentMilliseconds() - startTime);
+	printf("%d games (%d with errors), %d positions, %d ms, %.0f games per minute\n",
+		gameCount, errorCount, positionCount, int(elapsed), gameCount * 60000.0 / elapsed);
+
+	return success;
+}
@@ -0,0 +1,34 @@
+#include <vector>
+
+// Reading games from PGN files, to build books, extract test positions and label training data.
+//
+// The file is mapped and split into chunks at game boundaries, which the threads parse independently.  Comments,
+// variations, NAGs and move numbers are skipped, moves are SAN (see MakeMoveFromSanString).  A game with a move that
+// doesn't parse keeps the moves before it.
+const int PgnResultWhiteWin = 0;
+const int PgnResultDraw = 1;
+const int PgnResultBlackWin = 2;
+const int PgnResultUnknown = 3;
+
+// Plies of each game that go in a book
+const int PgnBookPlies = 30;
+
+struct PgnGame
+{
+	std::string StartFen;		// empty for the standard start position
+	int Result;
+	std::vector<Move> Moves;
+	bool Error;					// a move didn't parse, Moves ends before it
+};
+
+// Reads the game starting at text (skipping anything before its tags) and advances text past it.  Returns false if
+// there are no more games before end.
+bool ReadPgnGame(const char *&text, const char *end, PgnGame &game);
+
+// Converts every game in pgnFilename, returns false if a file can't be opened or the format is unknown.
+//   epd:  each position before a move, with the move (bm) and the game result (c9), in game order.  The tuner reads
+//         the results, and the bm operations make it a test suite.
+//   book: the first PgnBookPlies plies of each game as a book (see book.h), weighted 2 for a win and 1 for a draw
+//         for the side that played the move.
+//   packed: each position before a move as a PackedPosition (see packed.h) with the move and the game result.
+bool ConvertPgn(const std::string &pgnFilename, const std::string &outputFilename, const std::string &format, const int threadCount);
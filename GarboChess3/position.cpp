@@ -3,6 +3,7 @@
 #include "movegen.h"
 #include "mersenne.h"
 #include "evaluation.h"
+#include "nnue.h"
 
 static MTRand Random;
 static u64 GetRand64()
@@ -40,6 +41,48 @@ void Position::StaticInitialize()
 	Position::ZobristToMove = GetRand64();
 }
 
+u64 Position::GetMaterialSignature(const std::string &pieces)
+{
+	ASSERT(pieces.size() >= 2 && pieces[0] == 'K');
+
+	u64 signature = 0;
+	int counts[2][8] = { { 0 } };
+	Color color = WHITE;
+	for (int i = 0; i < (int)pieces.size(); i++)
+	{
+		PieceType piece;
+		switch (pieces[i])
+		{
+		case 'P': piece = PAWN; break;
+		case 'N': piece = KNIGHT; break;
+		case 'B': piece = BISHOP; break;
+		case 'R': piece = ROOK; break;
+		case 'Q': piece = QUEEN; break;
+		case 'K': piece = KING; break;
+		}
+
+		if (piece == KING && i > 0)
+		{
+			color = BLACK;
+		}
+		signature ^= Position::Zobrist[color][piece][counts[color][piece]++];
+	}
+	return signature;
+}
+
+// The material hash xors in Zobrist[color][piece][n] for the n'th piece of each kind, so it only depends on the piece counts
+inline void Position::AddMaterial(const Color color, const PieceType piece)
+{
+	MaterialHash ^= Position::Zobrist[color][piece][PieceCount[color][piece]++];
+	GamePhase[color] += PiecePhase[piece];
+}
+
+inline void Position::RemoveMaterial(const Color color, const PieceType piece)
+{
+	MaterialHash ^= Position::Zobrist[color][piece][--PieceCount[color][piece]];
+	GamePhase[color] -= PiecePhase[piece];
+}
+
 void Position::Initialize(const std::string &fen)
 {
 	Hash = PawnHash = 0;
@@ -138,9 +181,51 @@ void Position::Initialize(const std::string &fen)
 
 	Hash = GetHash();
 	PawnHash = GetPawnHash();
+	InitializeMaterial();
 
-	PsqEvalOpening = GetPsqEval(0);
-	PsqEvalEndgame = GetPsqEval(1);
+	PsqEval = GetPsqEval();
+	RefreshNnueAccumulator();
+}
+
+void Position::Initialize(const Piece board[64], const Color toMove, const int castleFlags, const Square enPassent, const int fifty)
+{
+	for (int i = 0; i < 8; i++) Pieces[i] = 0;
+	for (int i = 0; i < 2; i++) Colors[i] = 0;
+
+	for (Square square = 0; square < 64; square++)
+	{
+		Board[square] = board[square];
+		if (board[square] != PIECE_NONE)
+		{
+			const Color color = GetPieceColor(board[square]);
+			const PieceType piece = GetPieceType(board[square]);
+			SetBit(Pieces[piece], square);
+			SetBit(Colors[color], square);
+
+			if (piece == KING)
+			{
+				KingPos[color] = square;
+			}
+		}
+	}
+
+	ToMove = toMove;
+	CastleFlags = castleFlags;
+	EnPassent = enPassent;
+	Fifty = fifty;
+	MoveDepth = 0;
+
+	for (int i = 0; i < Fifty; i++)
+	{
+		DrawKeys[i] = 0;
+	}
+
+	Hash = GetHash();
+	PawnHash = GetPawnHash();
+	InitializeMaterial();
+
+	PsqEval = GetPsqEval();
+	RefreshNnueAccumulator();
 }
 
 std::string Position::GetFen() const
@@ -197,8 +282,34 @@ std::string Position::GetFen() const
 	// ToMove
 	if (ToMove == WHITE) result += " w"; else result += " b";
 	
-	// TODO: castle flags, e.p.
-	result += " - - 0 0";
+	result += ' ';
+	if (CastleFlags == 0)
+	{
+		result += '-';
+	}
+	else
+	{
+		if (CastleFlags & CastleFlagWhiteKing) result += 'K';
+		if (CastleFlags & CastleFlagWhiteQueen) result += 'Q';
+		if (CastleFlags & CastleFlagBlackKing) result += 'k';
+		if (CastleFlags & CastleFlagBlackQueen) result += 'q';
+	}
+
+	result += ' ';
+	if (EnPassent == -1)
+	{
+		result += '-';
+	}
+	else
+	{
+		result += char('a' + GetColumn(EnPassent));
+		result += char('1' + (RANK_1 - GetRow(EnPassent)));
+	}
+
+	// The move number isn't tracked
+	char counters[32];
+	sprintf(counters, " %d 1", Fifty);
+	result += counters;
 
 	return result;
 }
@@ -262,15 +373,30 @@ void Position::Flip()
 
 	Hash = GetHash();
 	PawnHash = GetPawnHash();
+	InitializeMaterial();
 
-	PsqEvalOpening = GetPsqEval(0);
-	PsqEvalEndgame = GetPsqEval(1);
+	PsqEval = GetPsqEval();
+	RefreshNnueAccumulator();
 
 #if _DEBUG
 	VerifyBoard();
 #endif
 }
 
+void Position::RefreshEvaluation()
+{
+	InitializeMaterial();
+	PsqEval = GetPsqEval();
+}
+
+void Position::RefreshNnueAccumulator()
+{
+	if (NnueEnabled)
+	{
+		NnueRefreshAccumulator(*this, NnueAccumulator);
+	}
+}
+
 void Position::MakeMove(const Move move, MoveUndo &moveUndo)
 {
 	ASSERT(IsMovePseudoLegal((const Position&)*this, move));
@@ -321,8 +447,10 @@ void Position::MakeMove(const Move move, MoveUndo &moveUndo)
 
 		Hash ^= Position::Zobrist[them][target][to];
 
-		PsqEvalOpening -= PsqTableOpening[boardTo][to];
-		PsqEvalEndgame -= PsqTableEndgame[boardTo][to];
+		PsqEval -= PsqTable[boardTo][to];
+		if (NnueEnabled) NnueRemovePiece(NnueAccumulator, boardTo, to);
+
+		RemoveMaterial(them, target);
 
 		if (target == PAWN)
 		{
@@ -347,8 +475,8 @@ void Position::MakeMove(const Move move, MoveUndo &moveUndo)
 	SetBit(Pieces[piece], to);
 	SetBit(Colors[us], to);
 
-	PsqEvalOpening += PsqTableOpening[boardFrom][to] - PsqTableOpening[boardFrom][from];
-	PsqEvalEndgame += PsqTableEndgame[boardFrom][to] - PsqTableEndgame[boardFrom][from];
+	PsqEval += PsqTable[boardFrom][to] - PsqTable[boardFrom][from];
+	if (NnueEnabled) NnueMovePiece(NnueAccumulator, boardFrom, from, to);
 
 	Board[to] = Board[from];
 	Board[from] = PIECE_NONE;
@@ -384,11 +512,18 @@ void Position::MakeMove(const Move move, MoveUndo &moveUndo)
 
 			const Piece promotedPiece = MakePiece(us, promotionType);
 
-			PsqEvalOpening += PsqTableOpening[promotedPiece][to] - PsqTableOpening[Board[to]][to];
-			PsqEvalEndgame += PsqTableEndgame[promotedPiece][to] - PsqTableEndgame[Board[to]][to];
+			PsqEval += PsqTable[promotedPiece][to] - PsqTable[Board[to]][to];
+			if (NnueEnabled)
+			{
+				NnueRemovePiece(NnueAccumulator, Board[to], to);
+				NnueAddPiece(NnueAccumulator, promotedPiece, to);
+			}
 
 			Board[to] = promotedPiece;
 
+			RemoveMaterial(us, PAWN);
+			AddMaterial(us, promotionType);
+
 			PawnHash ^= Position::Zobrist[us][PAWN][from];
 			Hash ^= Position::Zobrist[us][PAWN][to] ^ Position::Zobrist[us][promotionType][to];
 		}
@@ -402,11 +537,13 @@ void Position::MakeMove(const Move move, MoveUndo &moveUndo)
 			XorClearBit(Pieces[PAWN], epSquare);
 			XorClearBit(Colors[them], epSquare);
 
-			PsqEvalOpening -= PsqTableOpening[Board[epSquare]][epSquare];
-			PsqEvalEndgame -= PsqTableEndgame[Board[epSquare]][epSquare];
+			PsqEval -= PsqTable[Board[epSquare]][epSquare];
+			if (NnueEnabled) NnueRemovePiece(NnueAccumulator, Board[epSquare], epSquare);
 
 			Board[epSquare] = PIECE_NONE;
 
+			RemoveMaterial(them, PAWN);
+
 			PawnHash ^= Position::Zobrist[us][PAWN][from] ^ Position::Zobrist[us][PAWN][to] ^ Position::Zobrist[them][PAWN][epSquare];
 			Hash ^= Position::Zobrist[them][PAWN][epSquare];
 		}
@@ -452,8 +589,8 @@ void Position::MakeMove(const Move move, MoveUndo &moveUndo)
 
 				Hash ^= Position::Zobrist[us][ROOK][rookFrom] ^ Position::Zobrist[us][ROOK][rookTo];
 
-				PsqEvalOpening += PsqTableOpening[Board[rookTo]][rookTo] - PsqTableOpening[Board[rookTo]][rookFrom];
-				PsqEvalEndgame += PsqTableEndgame[Board[rookTo]][rookTo] - PsqTableEndgame[Board[rookTo]][rookFrom];
+				PsqEval += PsqTable[Board[rookTo]][rookTo] - PsqTable[Board[rookTo]][rookFrom];
+				if (NnueEnabled) NnueMovePiece(NnueAccumulator, Board[rookTo], rookFrom, rookTo);
 			}
 		}
 	}
@@ -537,8 +674,8 @@ void Position::UnmakeMove(const Move move, const MoveUndo &moveUndo)
 			Board[rookFrom] = Board[rookTo];
 			Board[rookTo] = PIECE_NONE;
 
-			PsqEvalOpening += PsqTableOpening[Board[rookFrom]][rookFrom] - PsqTableOpening[Board[rookFrom]][rookTo];
-			PsqEvalEndgame += PsqTableEndgame[Board[rookFrom]][rookFrom] - PsqTableEndgame[Board[rookFrom]][rookTo];
+			PsqEval += PsqTable[Board[rookFrom]][rookFrom] - PsqTable[Board[rookFrom]][rookTo];
+			if (NnueEnabled) NnueMovePiece(NnueAccumulator, Board[rookFrom], rookTo, rookFrom);
 		}
 	}
 	else if (moveFlags != MoveTypeNone)
@@ -553,8 +690,15 @@ void Position::UnmakeMove(const Move move, const MoveUndo &moveUndo)
 			const Piece unpromotedPawn = MakePiece(us, PAWN);
 			Board[from] = unpromotedPawn;
 
-			PsqEvalOpening += PsqTableOpening[unpromotedPawn][to] - PsqTableOpening[Board[to]][to];
-			PsqEvalEndgame += PsqTableEndgame[unpromotedPawn][to] - PsqTableEndgame[Board[to]][to];
+			PsqEval += PsqTable[unpromotedPawn][to] - PsqTable[Board[to]][to];
+			if (NnueEnabled)
+			{
+				NnueRemovePiece(NnueAccumulator, Board[to], to);
+				NnueAddPiece(NnueAccumulator, unpromotedPawn, to);
+			}
+
+			RemoveMaterial(us, promotionType);
+			AddMaterial(us, PAWN);
 		}
 		else if (moveFlags == MoveTypeEnPassent)
 		{
@@ -564,8 +708,10 @@ void Position::UnmakeMove(const Move move, const MoveUndo &moveUndo)
 			SetBit(Colors[them], epSquare);
 			Board[epSquare] = MakePiece(them, PAWN);
 
-			PsqEvalOpening += PsqTableOpening[Board[epSquare]][epSquare];
-			PsqEvalEndgame += PsqTableEndgame[Board[epSquare]][epSquare];
+			PsqEval += PsqTable[Board[epSquare]][epSquare];
+			if (NnueEnabled) NnueAddPiece(NnueAccumulator, Board[epSquare], epSquare);
+
+			AddMaterial(them, PAWN);
 		}
 	}
 
@@ -578,8 +724,10 @@ void Position::UnmakeMove(const Move move, const MoveUndo &moveUndo)
 		const Piece restoredPiece = MakePiece(them, moveUndo.Captured);
 		Board[to] = restoredPiece;
 
-		PsqEvalOpening += PsqTableOpening[restoredPiece][to];
-		PsqEvalEndgame += PsqTableEndgame[restoredPiece][to];
+		PsqEval += PsqTable[restoredPiece][to];
+		if (NnueEnabled) NnueAddPiece(NnueAccumulator, restoredPiece, to);
+
+		AddMaterial(them, moveUndo.Captured);
 	}
 	else
 	{
@@ -588,8 +736,8 @@ void Position::UnmakeMove(const Move move, const MoveUndo &moveUndo)
 
 	const Piece boardFrom = Board[from];
 
-	PsqEvalOpening += PsqTableOpening[boardFrom][from] - PsqTableOpening[boardFrom][to];
-	PsqEvalEndgame += PsqTableEndgame[boardFrom][from] - PsqTableEndgame[boardFrom][to];
+	PsqEval += PsqTable[boardFrom][from] - PsqTable[boardFrom][to];
+	if (NnueEnabled) NnueMovePiece(NnueAccumulator, boardFrom, to, from);
 
 #if _DEBUG
 	VerifyBoard();
@@ -732,14 +880,36 @@ u64 Position::GetPawnHash() const
 	return result;
 }
 
-int Position::GetPsqEval(int gameStage) const
+void Position::InitializeMaterial()
+{
+	MaterialHash = 0;
+	for (Color color = WHITE; color <= BLACK; color++)
+	{
+		GamePhase[color] = 0;
+		for (PieceType piece = PIECE_NONE; piece <= 7; piece++)
+		{
+			PieceCount[color][piece] = 0;
+		}
+
+		for (PieceType piece = PAWN; piece <= KING; piece++)
+		{
+			const int count = CountBitsSet(Pieces[piece] & Colors[color]);
+			for (int i = 0; i < count; i++)
+			{
+				AddMaterial(color, piece);
+			}
+		}
+	}
+}
+
+Score Position::GetPsqEval() const
 {
-	int result = 0;
+	Score result = 0;
 	for (Square square = 0; square < 64; square++)
 	{
 		if (Board[square] != PIECE_NONE)
 		{
-			result += gameStage == 0 ? PsqTableOpening[Board[square]][square] : PsqTableEndgame[Board[square]][square];
+			result += PsqTable[Board[square]][square];
 		}
 	}
 
@@ -751,6 +921,8 @@ void Position::VerifyBoard() const
 	const bool verifyBoard = false;
 	const bool verifyHash = false;
 	const bool verifyPsqEval = false;
+	const bool verifyMaterial = false;
+	const bool verifyNnue = false;
 
 	if (verifyBoard)
 	{
@@ -796,7 +968,30 @@ void Position::VerifyBoard() const
 
 	if (verifyPsqEval)
 	{
-		ASSERT(PsqEvalOpening == GetPsqEval(0));
-		ASSERT(PsqEvalEndgame == GetPsqEval(1));
+		ASSERT(PsqEval == GetPsqEval());
+	}
+
+	if (verifyMaterial)
+	{
+		Position other;
+		memcpy(&other, this, sizeof(Position));
+		other.InitializeMaterial();
+
+		ASSERT(MaterialHash == other.MaterialHash);
+		for (Color color = WHITE; color <= BLACK; color++)
+		{
+			ASSERT(GamePhase[color] == other.GamePhase[color]);
+			for (PieceType piece = PAWN; piece <= KING; piece++)
+			{
+				ASSERT(PieceCount[color][piece] == CountBitsSet(Pieces[piece] & Colors[color]));
+			}
+		}
+	}
+
+	if (verifyNnue && NnueEnabled)
+	{
+		s16 accumulator[2][NnueHiddenSize];
+		NnueRefreshAccumulator(*this, accumulator);
+		ASSERT(memcmp(accumulator, NnueAccumulator, sizeof(accumulator)) == 0);
 	}
 }
\ No newline at end of file
@@ -1,5 +1,8 @@
 #include <string>
 
+// Size of the network evaluation's first layer, per perspective (see nnue.h)
+const int NnueHiddenSize = 128;
+
 struct MoveUndo
 {
 	u64 Hash;
@@ -20,8 +23,15 @@ public:
 	Bitboard Colors[2];
 	Square KingPos[2];
 
-	int PsqEvalOpening;
-	int PsqEvalEndgame;
+	Score PsqEval;
+
+	// Material signature, also maintained incrementally
+	u64 MaterialHash;
+	int GamePhase[2];
+	u8 PieceCount[2][8];
+
+	// First layer of the network evaluation, only maintained while NnueEnabled
+	s16 NnueAccumulator[2][NnueHiddenSize];
 
 	int CastleFlags;
 	int Fifty;
@@ -32,10 +42,20 @@ public:
 	inline Bitboard GetAllPieces() const { return Colors[WHITE] | Colors[BLACK]; }
 	
 	static void StaticInitialize();
+
+	// MaterialHash of the pieces in a string like "KBNK", white's pieces first (each side starts with its king)
+	static u64 GetMaterialSignature(const std::string &pieces);
 	void Initialize(const std::string &fen);
+	// The tablebase generator leaves out the castling rights, en passant square and fifty move count
+	void Initialize(const Piece board[64], const Color toMove, const int castleFlags = 0, const Square enPassent = -1, const int fifty = 0);
 	std::string GetFen() const;
 	void Clone(Position &other) const;
 
+	// Recomputes the network accumulators from scratch, needed when the network changes
+	void RefreshNnueAccumulator();
+	// Recomputes the piece square and game phase sums, needed when the evaluation tables change.  Keeps the move history.
+	void RefreshEvaluation();
+
 	// Debug only!
 	void Flip();
 
@@ -116,7 +136,11 @@ private:
 	void VerifyBoard() const;
 	u64 GetHash() const;
 	u64 GetPawnHash() const;
-	int GetPsqEval(int gameStage) const;
+	Score GetPsqEval() const;
+	void InitializeMaterial();
+
+	inline void AddMaterial(const Color color, const PieceType piece);
+	inline void RemoveMaterial(const Color color, const PieceType piece);
 
 	static int RookCastleFlagMask[64];
 	static u64 Zobrist[2][8][64];
@@ -2,8 +2,11 @@
 #include "position.h"
 #include "evaluation.h"
 
-int PsqTableOpening[16][64];
-int PsqTableEndgame[16][64];
+Score PsqTable[16][64];
+
+// Built separately in millipawns, then packed into PsqTable
+static int psqTableOpening[16][64];
+static int psqTableEndgame[16][64];
 
 // Material weights (in centipawns, which are directly used by the evaluation value)
 EVAL_FEATURE(PawnOpening,   77);
@@ -17,9 +20,6 @@ EVAL_FEATURE(RookEndgame,   500);
 EVAL_FEATURE(QueenOpening,  975);
 EVAL_FEATURE(QueenEndgame,  990);
 
-EVAL_FEATURE(BishopPairOpening, 50);
-EVAL_FEATURE(BishopPairEndgame, 70);
-
 // Psq weights (in millipawns, all are divided by 10 before being used in the psq-table)
 EVAL_FEATURE(PawnColumnOpening, 54);
 EVAL_FEATURE(PawnColumnEndgame, 0);
@@ -56,6 +56,93 @@ const int KingLine[8] = { -3, -1, +0, +1, +1, +0, -1, -3 };
 const int KingColumn[8] = { +3, +4, +2, +0, +0, +2, +4, +3 };
 const int KingRow[8] = { -7, -6, -5, -4, -3, -2, +0, +1 };
 
+#ifdef EVAL_TUNING
+// The features each piece's table is built from by InitializePsqTable, as feature indices (-1 for none)
+struct PsqFeatures
+{
+	int WeightOpening, WeightEndgame;
+	const int *Center;
+	int CenterOpening, CenterEndgame;
+	const int *Row;
+	int RowOpening, RowEndgame;
+	const int *Column;
+	int ColumnOpening, ColumnEndgame;
+	int BackRowOpeningPenalty;
+};
+
+static const PsqFeatures PsqPieceFeatures[KING + 1] =
+{
+	{ -1, -1, EmptyFeature, -1, -1, EmptyFeature, -1, -1, EmptyFeature, -1, -1, -1 },
+	{ PawnOpeningIndex, PawnEndgameIndex,
+		EmptyFeature, -1, -1,
+		EmptyFeature, -1, -1,
+		PawnColumn, PawnColumnOpeningIndex, PawnColumnEndgameIndex,
+		-1 },
+	{ KnightOpeningIndex, KnightEndgameIndex,
+		KnightLine, KnightCenterOpeningIndex, KnightCenterEndgameIndex,
+		KnightRow, KnightRowOpeningIndex, KnightRowEndgameIndex,
+		EmptyFeature, -1, -1,
+		KnightBackRowOpeningPenaltyIndex },
+	{ BishopOpeningIndex, BishopEndgameIndex,
+		BishopLine, BishopCenterOpeningIndex, BishopCenterEndgameIndex,
+		EmptyFeature, -1, -1,
+		EmptyFeature, -1, -1,
+		BishopBackRowOpeningPenaltyIndex },
+	{ RookOpeningIndex, RookEndgameIndex,
+		EmptyFeature, -1, -1,
+		EmptyFeature, -1, -1,
+		RookColumn, RookColumnOpeningIndex, RookColumnEndgameIndex,
+		-1 },
+	{ QueenOpeningIndex, QueenEndgameIndex,
+		QueenLine, QueenCenterOpeningIndex, QueenCenterEndgameIndex,
+		EmptyFeature, -1, -1,
+		EmptyFeature, -1, -1,
+		QueenBackRowOpeningPenaltyIndex },
+	{ -1, -1,
+		KingLine, KingCenterOpeningIndex, KingCenterEndgameIndex,
+		KingRow, KingRowOpeningIndex, KingRowEndgameIndex,
+		KingColumn, KingColumnOpeningIndex, KingColumnEndgameIndex,
+		-1 },
+};
+
+static void TracePsqFeature(const int feature, const Color color, const float opening, const float endgame, const int scale)
+{
+	if (feature != -1 && (opening != 0 || endgame != 0))
+	{
+		AddEvalFeatureCount(feature, color, opening * scale, endgame * scale);
+	}
+}
+
+// Counts the features behind PsqTable[piece][square], times scale, for the evaluation's feature extraction.  The psq
+// weights are in millipawns, so they count a tenth per unit of their multipliers.
+void TracePsqFeatures(const Piece piece, const Square square, const int scale)
+{
+	const Color color = GetPieceColor(piece);
+	const PsqFeatures &features = PsqPieceFeatures[GetPieceType(piece)];
+
+	// Black's tables are white's, flipped
+	const Square whiteSquare = color == WHITE ? square : FlipSquare(square);
+	const int row = GetRow(whiteSquare);
+	const int column = GetColumn(whiteSquare);
+
+	TracePsqFeature(features.WeightOpening, color, 1, 0, scale);
+	TracePsqFeature(features.WeightEndgame, color, 0, 1, scale);
+
+	const float center = (features.Center[row] + features.Center[column]) / 10.0f;
+	TracePsqFeature(features.CenterOpening, color, center, 0, scale);
+	TracePsqFeature(features.CenterEndgame, color, 0, center, scale);
+	TracePsqFeature(features.RowOpening, color, features.Row[row] / 10.0f, 0, scale);
+	TracePsqFeature(features.RowEndgame, color, 0, features.Row[row] / 10.0f, scale);
+	TracePsqFeature(features.ColumnOpening, color, features.Column[column] / 10.0f, 0, scale);
+	TracePsqFeature(features.ColumnEndgame, color, 0, features.Column[column] / 10.0f, scale);
+
+	if (row == RANK_1)
+	{
+		TracePsqFeature(features.BackRowOpeningPenalty, color, -0.1f, 0, scale);
+	}
+}
+#endif
+
 void InitPiece(Piece piece,
 			   int weightOpening, int weightEndgame,
 			   const int center[8], int centerWeightOpening, int centerWeightEndgame,
@@ -66,17 +153,17 @@ void InitPiece(Piece piece,
 
 	for (Square square = 0; square < 64; square++)
 	{
-		PsqTableOpening[piece][square] = weightOpening * 10; // Will be divided by 10 at the end
+		psqTableOpening[piece][square] = weightOpening * 10; // Will be divided by 10 at the end
 
-		PsqTableOpening[piece][square] +=
+		psqTableOpening[piece][square] +=
 			(row[GetRow(square)] * rowWeightOpening) +
 			(column[GetColumn(square)] * columnWeightOpening) +
 			(center[GetRow(square)] * centerWeightOpening) +
 			(center[GetColumn(square)] * centerWeightOpening);
 
-		PsqTableEndgame[piece][square] = weightEndgame * 10; // Will be divided by 10 at the end
+		psqTableEndgame[piece][square] = weightEndgame * 10; // Will be divided by 10 at the end
 
-		PsqTableEndgame[piece][square] +=
+		psqTableEndgame[piece][square] +=
 			(row[GetRow(square)] * rowWeightEndgame) +
 			(column[GetColumn(square)] * columnWeightEndgame) +
 			(center[GetRow(square)] * centerWeightEndgame) +
@@ -90,8 +177,8 @@ void InitializePsqTable()
 	{
 		for (Square square = 0; square < 64; square++)
 		{
-			PsqTableOpening[piece][square] = 0;
-			PsqTableEndgame[piece][square] = 0;
+			psqTableOpening[piece][square] = 0;
+			psqTableEndgame[piece][square] = 0;
 		}
 	}
 
@@ -111,7 +198,7 @@ void InitializePsqTable()
 	// Knight bank rank penalty
 	for (Square square = MakeSquare(RANK_1, FILE_A); square <= MakeSquare(RANK_1, FILE_H); square++)
 	{
-		PsqTableOpening[MakePiece(WHITE, KNIGHT)][square] -= KnightBackRowOpeningPenalty;
+		psqTableOpening[MakePiece(WHITE, KNIGHT)][square] -= KnightBackRowOpeningPenalty;
 	}
 
 	InitPiece(MakePiece(WHITE, BISHOP), 
@@ -123,7 +210,7 @@ void InitializePsqTable()
 	// Bishop bank rank penalty
 	for (Square square = MakeSquare(RANK_1, FILE_A); square <= MakeSquare(RANK_1, FILE_H); square++)
 	{
-		PsqTableOpening[MakePiece(WHITE, BISHOP)][square] -= BishopBackRowOpeningPenalty;
+		psqTableOpening[MakePiece(WHITE, BISHOP)][square] -= BishopBackRowOpeningPenalty;
 	}
 
 	InitPiece(MakePiece(WHITE, ROOK), 
@@ -141,7 +228,7 @@ void InitializePsqTable()
 	// Queen bank rank penalty
 	for (Square square = MakeSquare(RANK_1, FILE_A); square <= MakeSquare(RANK_1, FILE_H); square++)
 	{
-		PsqTableOpening[MakePiece(WHITE, QUEEN)][square] -= QueenBackRowOpeningPenalty;
+		psqTableOpening[MakePiece(WHITE, QUEEN)][square] -= QueenBackRowOpeningPenalty;
 	}
 
 	InitPiece(MakePiece(WHITE, KING), 
@@ -155,17 +242,25 @@ void InitializePsqTable()
 	{
 		for (Square square = 0; square < 64; square++)
 		{
-			PsqTableOpening[MakePiece(WHITE, pieceType)][square] /= 10;
-			PsqTableEndgame[MakePiece(WHITE, pieceType)][square] /= 10;
+			psqTableOpening[MakePiece(WHITE, pieceType)][square] /= 10;
+			psqTableEndgame[MakePiece(WHITE, pieceType)][square] /= 10;
 		}
 
 		for (Square square = 0; square < 64; square++)
 		{
-			PsqTableOpening[MakePiece(BLACK, pieceType)][FlipSquare(square)] = 
-				-PsqTableOpening[MakePiece(WHITE, pieceType)][square];
+			psqTableOpening[MakePiece(BLACK, pieceType)][FlipSquare(square)] = 
+				-psqTableOpening[MakePiece(WHITE, pieceType)][square];
 
-			PsqTableEndgame[MakePiece(BLACK, pieceType)][FlipSquare(square)] = 
-				-PsqTableEndgame[MakePiece(WHITE, pieceType)][square];
+			psqTableEndgame[MakePiece(BLACK, pieceType)][FlipSquare(square)] = 
+				-psqTableEndgame[MakePiece(WHITE, pieceType)][square];
+		}
+	}
+
+	for (Piece piece = 0; piece < 16; piece++)
+	{
+		for (Square square = 0; square < 64; square++)
+		{
+			PsqTable[piece][square] = S(psqTableOpening[piece][square], psqTableEndgame[piece][square]);
 		}
 	}
 }
\ No newline at end of file
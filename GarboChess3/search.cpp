@@ -5,6 +5,7 @@
 #include "evaluation.h"
 #include "hashtable.h"
 #include "movesorter.h"
+#include "tablebase.h"
 
 #include <cstdlib>
 #include <csetjmp>
@@ -23,181 +24,195 @@ const int MoveSentinelScore = MinEval - 1;
 const int DrawScore = 0;
 
 // TODO: Use PSQ tables in SEE?
-static const int seePieceValues[8] = { 0, 1, 3, 3, 5, 10, 10000, 0 };
+static const int seePieceValues[8] = { 0, 100, 325, 325, 500, 975, 20000, 0 };
 
-// This version of SEE does not calculate the exact material imbalance, it just returns true = winning or equal, false = losing
-bool FastSee(const Position &position, const Move move, const Color us)
+// Returns all pieces of either color attacking the square, given an occupancy
+inline Bitboard GetSeeAttackers(const Position &position, const Square square, const Bitboard allPieces)
 {
-	const Square from = GetFrom(move);
-	const Square to = GetTo(move);
+	return
+		(((GetPawnAttacks(square, WHITE) & position.Colors[BLACK]) | (GetPawnAttacks(square, BLACK) & position.Colors[WHITE])) & position.Pieces[PAWN]) |
+		(GetKnightAttacks(square) & position.Pieces[KNIGHT]) |
+		(GetBishopAttacks(square, allPieces) & (position.Pieces[BISHOP] | position.Pieces[QUEEN])) |
+		(GetRookAttacks(square, allPieces) & (position.Pieces[ROOK] | position.Pieces[QUEEN])) |
+		(GetKingAttacks(square) & position.Pieces[KING]);
+}
 
-	const Color them = FlipColor(us);
+// Removes the least valuable attacker of the given color from the attackers and the occupancy, and adds any sliders
+// that were x-raying through it.  Returns PIECE_NONE if the color has no attackers left.
+inline PieceType PopLeastValuableAttacker(const Position &position, const Square to, const Color color, Bitboard &attackingPieces, Bitboard &allPieces)
+{
+	for (PieceType capturingPiece = PAWN; capturingPiece <= KING; capturingPiece++)
+	{
+		const Bitboard attacks = position.Pieces[capturingPiece] & attackingPieces & position.Colors[color];
+		if (attacks)
+		{
+			const Square attackingSquare = GetFirstBitIndex(attacks);
+			XorClearBit(allPieces, attackingSquare);
 
-	ASSERT(position.Board[from] != PIECE_NONE);
-	ASSERT(GetPieceColor(position.Board[from]) == us);
-	ASSERT(position.Board[to] == PIECE_NONE || GetPieceColor(position.Board[from]) != GetPieceColor(position.Board[to]));
+			// Add any x-ray attackers
+			if (capturingPiece == PAWN || capturingPiece == BISHOP || capturingPiece == QUEEN)
+			{
+				attackingPieces |= GetBishopAttacks(to, allPieces) & (position.Pieces[BISHOP] | position.Pieces[QUEEN]);
+			}
+			if (capturingPiece == ROOK || capturingPiece == QUEEN)
+			{
+				attackingPieces |= GetRookAttacks(to, allPieces) & (position.Pieces[ROOK] | position.Pieces[QUEEN]);
+			}
+			attackingPieces &= allPieces;
 
-	const int fromValue = seePieceValues[GetPieceType(position.Board[from])];
-	const int toValue = seePieceValues[GetPieceType(position.Board[to])];
+			return capturingPiece;
+		}
+	}
 
-	if (fromValue <= toValue)
+	return PIECE_NONE;
+}
+
+// Material won by the move itself, before any recaptures
+inline int GetSeeCaptureValue(const Position &position, const Move move)
+{
+	const Move moveType = GetMoveType(move);
+	if (moveType == MoveTypeEnPassent)
 	{
-		return true;
+		return seePieceValues[PAWN];
 	}
 
-	if (GetMoveType(move) == MoveTypeEnPassent)
+	int value = seePieceValues[GetPieceType(position.Board[GetTo(move)])];
+	if (moveType == MoveTypePromotion)
 	{
-		// e.p. captures are always pxp which is winning or equal.
-		return true;
+		value += seePieceValues[GetPromotionMoveType(move)] - seePieceValues[PAWN];
 	}
+	return value;
+}
 
-	// We should only be making initially losing captures here
-	ASSERT(fromValue > seePieceValues[PAWN] || GetMoveType(move) == MoveTypePromotion || toValue == 0);
-
-	const Bitboard enemyPieces = position.Colors[them];
+// Value of the piece left standing on the destination square after the move
+inline int GetSeeMovedValue(const Position &position, const Move move)
+{
+	return GetMoveType(move) == MoveTypePromotion ?
+		seePieceValues[GetPromotionMoveType(move)] :
+		seePieceValues[GetPieceType(position.Board[GetFrom(move)])];
+}
 
-	// Pawn attacks
-	// If any opponent pawns can capture back, this capture is not worthwhile.
-	// This is because any pawn captures will return true above, so we must be using a knight or above.
-	if (GetPawnAttacks(to, us) & position.Pieces[PAWN] & enemyPieces)
-	{
-		return false;
-	}
+// Static exchange evaluation using a swap list.  Returns the material balance in centipawns from us' point of view
+// after the best sequence of recaptures on the destination square, including x-ray attackers.  Pins are ignored.
+int See(const Position &position, const Move move, const Color us)
+{
+	const Square from = GetFrom(move);
+	const Square to = GetTo(move);
 
-	// Knight attacks
-	Bitboard attackingPieces = GetKnightAttacks(to) & position.Pieces[KNIGHT];
-	const int captureDeficit = fromValue - toValue;
-	// If any opponent knights can capture back, and the deficit we have to make up is greater than the knights value,
-	// it's not worth it.  We can capture on this square again, and the opponent doesn't have to capture back.
-	if (captureDeficit > seePieceValues[KNIGHT] && (attackingPieces & enemyPieces))
-	{
-		return false;
-	}
+	ASSERT(position.Board[from] != PIECE_NONE);
+	ASSERT(GetPieceColor(position.Board[from]) == us);
+	ASSERT(position.Board[to] == PIECE_NONE || GetPieceColor(position.Board[from]) != GetPieceColor(position.Board[to]));
 
-	// Bishop attacks
-	Bitboard allPieces = position.Colors[us] | enemyPieces;
+	Bitboard allPieces = position.GetAllPieces();
 	XorClearBit(allPieces, from);
+	Bitboard attackingPieces = GetSeeAttackers(position, to, allPieces) & allPieces;
+
+	// gain[d] is the score of the exchange from the point of view of the side making the d'th capture,
+	// assuming the other side can recapture.
+	int gain[32];
+	int d = 0;
+	gain[0] = GetSeeCaptureValue(position, move);
+	int onSquareValue = GetSeeMovedValue(position, move);
 
-	attackingPieces |= GetBishopAttacks(to, allPieces) & (position.Pieces[BISHOP] | position.Pieces[QUEEN]);
-	if (captureDeficit > seePieceValues[BISHOP] && (attackingPieces & position.Pieces[BISHOP] & enemyPieces))
+	Color toMove = FlipColor(us);
+	for (;;)
 	{
-		return false;
+		const Bitboard previousAttackers = attackingPieces;
+		const PieceType capturingPiece = PopLeastValuableAttacker(position, to, toMove, attackingPieces, allPieces);
+		if (capturingPiece == PIECE_NONE)
+		{
+			break;
+		}
+
+		// The king can only capture if the square is no longer defended
+		if (capturingPiece == KING && (previousAttackers & position.Colors[FlipColor(toMove)]))
+		{
+			break;
+		}
+
+		d++;
+		gain[d] = onSquareValue - gain[d - 1];
+		onSquareValue = seePieceValues[capturingPiece];
+		toMove = FlipColor(toMove);
+
+		// Neither side can improve its result by continuing the exchange
+		if (max(-gain[d - 1], gain[d]) < 0 || d == 31)
+		{
+			break;
+		}
 	}
 
-	// Pawn defenses
-	// At this point, we are sure we are making a "losing" capture.  The opponent can not capture back with a
-	// pawn.  They cannot capture back with a bishop/knight and stand pat either.  So, if we can capture with
-	// a pawn, it's got to be a winning or equal capture.
-	if (GetPawnAttacks(to, them) & position.Pieces[PAWN] & position.Colors[us])
+	// Either side can stand pat instead of recapturing
+	while (d > 0)
 	{
-		return true;
+		gain[d - 1] = -max(-gain[d - 1], gain[d]);
+		d--;
 	}
 
-	// Rook attacks
-	attackingPieces |= GetRookAttacks(to, allPieces) & (position.Pieces[ROOK] | position.Pieces[QUEEN]);
-	if (captureDeficit > seePieceValues[ROOK] && (attackingPieces & position.Pieces[ROOK] & enemyPieces))
+	return gain[0];
+}
+
+// Returns true if See(position, move, us) >= threshold.  This is cheaper than computing the exact value, as it
+// exits as soon as one side can stand pat on the right side of the threshold.
+bool SeeAtLeast(const Position &position, const Move move, const Color us, const int threshold)
+{
+	const Square from = GetFrom(move);
+	const Square to = GetTo(move);
+
+	ASSERT(position.Board[from] != PIECE_NONE);
+	ASSERT(GetPieceColor(position.Board[from]) == us);
+	ASSERT(position.Board[to] == PIECE_NONE || GetPieceColor(position.Board[from]) != GetPieceColor(position.Board[to]));
+
+	// Even if nobody recaptures, we don't make the threshold
+	int swap = GetSeeCaptureValue(position, move) - threshold;
+	if (swap < 0)
 	{
 		return false;
 	}
 
-	// King attacks
-	attackingPieces |= GetKingAttacks(to) & position.Pieces[KING];
-
-	// Make sure our original attacking piece is not included in the set of attacking pieces
-	attackingPieces &= allPieces;
-
-	if (!attackingPieces)
+	// Even if our piece is lost for nothing, we still make the threshold
+	swap = GetSeeMovedValue(position, move) - swap;
+	if (swap <= 0)
 	{
-		// No pieces attacking us, we have won
 		return true;
 	}
 
-	// At this point, we have built a bitboard of all the pieces attacking the "to" square.  This includes
-	// potential x-ray attacks from removing the "from" square piece, which we used to do the capture.
-
-	// We are currently winning the amount of material of the captured piece, time to see if the opponent
-	// can get it back somehow.  We assume the opponent can capture our current piece in this score, which
-	// simplifies the later code considerably.
-	int seeValue = toValue - fromValue;
+	Bitboard allPieces = position.GetAllPieces();
+	XorClearBit(allPieces, from);
+	Bitboard attackingPieces = GetSeeAttackers(position, to, allPieces) & allPieces;
 
+	// result is whether the side that made the last capture makes the threshold
+	bool result = true;
+	Color toMove = us;
 	for (;;)
 	{
-		int capturingPieceValue = -1;
+		toMove = FlipColor(toMove);
 
-		// Find the least valuable piece of the opponent that can attack the square
-		for (PieceType capturingPiece = KNIGHT; capturingPiece <= KING; capturingPiece++)
+		const Bitboard previousAttackers = attackingPieces;
+		const PieceType capturingPiece = PopLeastValuableAttacker(position, to, toMove, attackingPieces, allPieces);
+		if (capturingPiece == PIECE_NONE)
 		{
-			const Bitboard attacks = position.Pieces[capturingPiece] & attackingPieces & position.Colors[them];
-			if (attacks)
-			{
-				// They can capture with a piece
-				capturingPieceValue = seePieceValues[capturingPiece];
-				
-				const Square attackingSquare = GetFirstBitIndex(attacks);
-				XorClearBit(attackingPieces, attackingSquare);
-				XorClearBit(allPieces, attackingSquare);
-				break;
-			}
-		}
-
-		if (capturingPieceValue == -1)
-		{
-			// The opponent can't capture back - we win
-			return true;
-		}
-
-		// Now, if seeValue < 0, the opponent is winning.  If even after we take their piece,
-		// we can't bring it back to 0, then we have lost this battle.
-		seeValue += capturingPieceValue;
-		if (seeValue < 0)
-		{
-			return false;
+			break;
 		}
 
-		// Add any x-ray attackers
-		attackingPieces |= 
-			((GetBishopAttacks(to, allPieces) & (position.Pieces[BISHOP] | position.Pieces[QUEEN])) |
-			(GetRookAttacks(to, allPieces) & (position.Pieces[ROOK] | position.Pieces[QUEEN]))) & allPieces;
-
-		// Our turn to capture
-		capturingPieceValue = -1;
-
-		// Find the least valuable piece of the opponent that can attack the square
-		for (PieceType capturingPiece = KNIGHT; capturingPiece <= KING; capturingPiece++)
-		{
-			const Bitboard attacks = position.Pieces[capturingPiece] & attackingPieces & position.Colors[us];
-			if (attacks)
-			{
-				// We can capture with a piece
-				capturingPieceValue = seePieceValues[capturingPiece];
-				
-				const Square attackingSquare = GetFirstBitIndex(attacks);
-				XorClearBit(attackingPieces, attackingSquare);
-				XorClearBit(allPieces, attackingSquare);
-				break;
-			}
-		}
+		result = !result;
 
-		if (capturingPieceValue == -1)
+		if (capturingPiece == KING)
 		{
-			// We can't capture back, we lose :(
-			return false;
+			// The king capture only stands if the square is no longer defended
+			return (previousAttackers & position.Colors[FlipColor(toMove)]) ? !result : result;
 		}
 
-		// Assume our opponent can capture us back, and if we are still winning, we can stand-pat
-		// here, and assume we've won.
-		seeValue -= capturingPieceValue;
-		if (seeValue >= 0)
+		// swap is what the side to capture needs to gain back.  If capturing this piece still leaves them short,
+		// they stand pat instead.
+		swap = seePieceValues[capturingPiece] - swap;
+		if (swap < (result ? 1 : 0))
 		{
-			return true;
+			break;
 		}
-
-		// Add any x-ray attackers
-		attackingPieces |= 
-			((GetBishopAttacks(to, allPieces) & (position.Pieces[BISHOP] | position.Pieces[QUEEN])) |
-			(GetRookAttacks(to, allPieces) & (position.Pieces[ROOK] | position.Pieces[QUEEN]))) & allPieces;
-
 	}
+
+	return result;
 }
 
 void StableSortMoves(Move *moves, int *moveScores, int moveCount)
@@ -233,13 +248,14 @@ inline bool SafePruneFromHash(const HashEntry *hashEntry, const int ply, const i
 }
 
 // The time the search was begun at
-u64 SearchStartTime;
-u64 SearchTimeLimit;
+THREAD_LOCAL u64 SearchStartTime;
+THREAD_LOCAL u64 SearchTimeLimit;
 
-bool KillSearch;
-std::jmp_buf KillSearchJump;
+THREAD_LOCAL bool KillSearch;
+THREAD_LOCAL std::jmp_buf KillSearchJump;
+THREAD_LOCAL int SearchThread;
 
-const int SearchInfoPageSize = 4096;
+const int SearchInfoPageSize = 8192;
 u64 searchInfoThreads;
 
 SearchInfo &GetSearchInfo(int thread)
@@ -247,6 +263,12 @@ SearchInfo &GetSearchInfo(int thread)
 	return (SearchInfo&)*((SearchInfo*)(searchInfoThreads + (SearchInfoPageSize * thread)));
 }
 
+void SetSearchThread(const int thread)
+{
+	ASSERT(thread >= 0 && thread <= MaxThreads);
+	SearchThread = thread;
+}
+
 bool IsPassedPawnPush(const Position &position, const Move move)
 {
 	const Square from = GetFrom(move);
@@ -271,7 +293,7 @@ int QSearch(Position &position, SearchInfo &searchInfo, int alpha, const int bet
 
 	searchInfo.QNodeCount++;
 
-	if (position.IsDraw())
+	if (position.IsDraw() || IsDeadDraw(position))
 	{
 		return DrawScore;
 	}
@@ -294,14 +316,15 @@ int QSearch(Position &position, SearchInfo &searchInfo, int alpha, const int bet
 
 	// What do we want from our evaluation? - this needs to be decided (mobility/threat information?)
 	EvalInfo evalInfo;
-	int eval = Evaluate(position, evalInfo);
+	int eval = Evaluate(position, evalInfo, alpha, beta);
 
 	if (eval > alpha)
 	{
 		alpha = eval;
 		if (alpha >= beta)
         {
-            StoreHash(position.Hash, eval, 0, 0, HashFlagsBeta);
+            // Lazy evaluations are only bounds, so they can't go in the hash as the static evaluation
+            StoreHash(position.Hash, eval, MaxEval, 0, 0, HashFlagsBeta);
 			return eval;
         }
 	}
@@ -314,7 +337,7 @@ int QSearch(Position &position, SearchInfo &searchInfo, int alpha, const int bet
 	Move move;
 	while ((move = moves.NextQMove()) != 0)
 	{
-        const bool seePrune = !FastSee(position, move, position.ToMove);
+        const bool seePrune = !SeeAtLeast(position, move, position.ToMove, 0);
 
 		const int pruneValue = optimisticValue + qPruningWeight[GetPieceType(position.Board[GetTo(move)])];
         const bool isPassedPawnPush = IsPassedPawnPush(position, move);
@@ -388,7 +411,7 @@ int QSearch(Position &position, SearchInfo &searchInfo, int alpha, const int bet
 
 	while ((move = moves.NextQMove()) != 0)
 	{
-		if (depth <= 0 && !FastSee(position, move, position.ToMove) && move != hashMove)
+		if (depth <= 0 && !SeeAtLeast(position, move, position.ToMove, 0) && move != hashMove)
 		{
 			continue;
 		}
@@ -432,7 +455,7 @@ int QSearchCheck(Position &position, SearchInfo &searchInfo, int alpha, const in
 
 	searchInfo.QNodeCount++;
 
-	if (position.IsDraw())
+	if (position.IsDraw() || IsDeadDraw(position))
 	{
 		return DrawScore;
 	}
@@ -501,16 +524,16 @@ bool CheckElapsedTime()
 	return false;
 }
 
-void CheckKillSearch()
+void CheckKillSearch(const SearchInfo &searchInfo)
 {
 	void ReadCommand();
 
-	while (!KillSearch && CheckForPendingInput())
+	while (SearchThread == 0 && !KillSearch && CheckForPendingInput())
 	{
 		ReadCommand();
 	}
 
-	if (CheckElapsedTime())
+	if (CheckElapsedTime() || searchInfo.NodeCount + searchInfo.QNodeCount >= searchInfo.NodeLimit)
 	{
 		KillSearch = true;
 	}
@@ -528,11 +551,25 @@ int Search(Position &position, SearchInfo &searchInfo, const int beta, const int
 
 	searchInfo.NodeCount++;
 
-	if (position.IsDraw())
+	if (position.IsDraw() || IsDeadDraw(position))
 	{
 		return DrawScore;
 	}
 
+	if (CanProbeTablebase(position))
+	{
+		int wdl, pliesToMate;
+		if (ProbeTablebase(position, wdl, pliesToMate))
+		{
+			searchInfo.TbHits++;
+			return wdl == 0 ? DrawScore : GetTablebaseScore(wdl, pliesToMate);
+		}
+	}
+
+	// The static evaluation is MaxEval until we know it
+	int evaluation = MaxEval;
+	EvalInfo evalInfo;
+
 	HashEntry *hashEntry;
 	Move hashMove;
 	if (ProbeHash(position.Hash, hashEntry))
@@ -541,18 +578,19 @@ int Search(Position &position, SearchInfo &searchInfo, const int beta, const int
             return hashEntry->Score;
 
 		hashMove = hashEntry->Move;
+		evaluation = hashEntry->Eval;
 	}
 	else
 	{
 		hashMove = 0;
 	}
 
-	int evaluation = MaxEval;
-	EvalInfo evalInfo;
-
 	if (!inCheck)
 	{
-        evaluation = Evaluate(position, evalInfo);
+		if (evaluation == MaxEval)
+		{
+			evaluation = Evaluate(position, evalInfo);
+		}
 
         // Try razoring
         if (ply <= OnePly * 4 &&
@@ -568,7 +606,7 @@ int Search(Position &position, SearchInfo &searchInfo, const int beta, const int
 			!(flags & 1) &&
 			evaluation >= beta &&
 			// Make sure we don't null move if we don't have any heavy pieces left
-			evalInfo.GamePhase[position.ToMove] > 0)
+			position.GamePhase[position.ToMove] > 0)
 		{
 			// Attempt to null-move
 			MoveUndo moveUndo;
@@ -590,7 +628,7 @@ int Search(Position &position, SearchInfo &searchInfo, const int beta, const int
 
 			if (score >= beta)
 			{
-				StoreHash(position.Hash, score, 0, newPly, HashFlagsBeta);
+				StoreHash(position.Hash, score, evaluation, 0, newPly, HashFlagsBeta);
 				return score;
 			}
 		}
@@ -616,6 +654,7 @@ int Search(Position &position, SearchInfo &searchInfo, const int beta, const int
 	}
 
 	const int futilityPruningDepth = OnePly * 3;
+	const int seePruningDepth = OnePly * 3;
 
 	int moveCount = 0;
 	int bestScore = MoveSentinelScore;
@@ -631,6 +670,20 @@ int Search(Position &position, SearchInfo &searchInfo, const int beta, const int
 
 		const bool isPassedPawnPush = IsPassedPawnPush(position, move);
 
+		// Moving a piece out of a pawn attack is never futile
+		const bool isThreatEscape =
+			GetPieceType(position.Board[GetFrom(move)]) != PAWN &&
+			(GetPawnAttacks(GetFrom(move), position.ToMove) & position.Pieces[PAWN] & position.Colors[FlipColor(position.ToMove)]) != 0;
+
+		// Quiet moves that hang material near the leaves are pruned, the margin grows with depth
+		const bool isLosingQuietMove =
+			!inCheck &&
+			!isPassedPawnPush &&
+			ply <= seePruningDepth &&
+			bestScore != MoveSentinelScore &&
+			moves.GetMoveGenerationState() == MoveGenerationState_QuietMoves &&
+			!SeeAtLeast(position, move, position.ToMove, -(60 * ply) / OnePly);
+
 		MoveUndo moveUndo;
 		position.MakeMove(move, moveUndo);
 
@@ -654,6 +707,7 @@ int Search(Position &position, SearchInfo &searchInfo, const int beta, const int
 				// Try futility pruning
 				if (!inCheck &&
 					!isPassedPawnPush &&
+					!isThreatEscape &&
 					moves.GetMoveGenerationState() == MoveGenerationState_QuietMoves &&
 					ply <= futilityPruningDepth)
 				{
@@ -685,9 +739,17 @@ int Search(Position &position, SearchInfo &searchInfo, const int beta, const int
 					}
 				}
 
+				// Try SEE pruning
+				if (isLosingQuietMove)
+				{
+					position.UnmakeMove(move, moveUndo);
+					continue;
+				}
+
 				// Apply late move reductions if the conditions are met.
 				if (!inCheck &&
 					!isPassedPawnPush &&
+					!isThreatEscape &&
 					moveCount >= 3 &&
 					ply > 3 * OnePly &&
 					moves.GetMoveGenerationState() == MoveGenerationState_QuietMoves)
@@ -740,7 +802,7 @@ int Search(Position &position, SearchInfo &searchInfo, const int beta, const int
 
 				if (value >= beta)
 				{
-					StoreHash(position.Hash, value, move, ply, HashFlagsBeta);
+					StoreHash(position.Hash, value, evaluation, move, ply, HashFlagsBeta);
 
 					// Update killers and history (only for non-captures)
 					const Square to = GetTo(move);
@@ -783,12 +845,12 @@ int Search(Position &position, SearchInfo &searchInfo, const int beta, const int
 
 	// TODO: some sort of history update here?
 
-	StoreHash(position.Hash, bestScore, hashMove, ply, HashFlagsAlpha);
+	StoreHash(position.Hash, bestScore, evaluation, hashMove, ply, HashFlagsAlpha);
 
 	if (searchInfo.NodeCount + searchInfo.QNodeCount > searchInfo.Timeout)
 	{
-		searchInfo.Timeout = searchInfo.NodeCount + searchInfo.QNodeCount + 30000;
-		CheckKillSearch();
+		searchInfo.Timeout = min(searchInfo.NodeCount + searchInfo.QNodeCount + 30000, searchInfo.NodeLimit);
+		CheckKillSearch(searchInfo);
 	}
 
 	return bestScore;
@@ -807,11 +869,21 @@ int SearchPV(Position &position, SearchInfo &searchInfo, int alpha, const int be
 
 	searchInfo.NodeCount++;
 
-	if (position.IsDraw())
+	if (position.IsDraw() || IsDeadDraw(position))
 	{
 		return DrawScore;
 	}
 
+	if (CanProbeTablebase(position))
+	{
+		int wdl, pliesToMate;
+		if (ProbeTablebase(position, wdl, pliesToMate))
+		{
+			searchInfo.TbHits++;
+			return wdl == 0 ? DrawScore : GetTablebaseScore(wdl, pliesToMate);
+		}
+	}
+
 	HashEntry *hashEntry;
 	Move hashMove;
 	if (ProbeHash(position.Hash, hashEntry))
@@ -949,7 +1021,7 @@ int SearchPV(Position &position, SearchInfo &searchInfo, int alpha, const int be
 
 					if (value >= beta)
 					{
-						StoreHash(position.Hash, value, move, ply, HashFlagsBeta);
+						StoreHash(position.Hash, value, MaxEval, move, ply, HashFlagsBeta);
 
 						// Update killers (only for non-captures/promotions)
 						const Square to = GetTo(move);
@@ -988,7 +1060,7 @@ int SearchPV(Position &position, SearchInfo &searchInfo, int alpha, const int be
 		return DrawScore;
 	}
 
-	StoreHash(position.Hash, bestScore, hashMove, ply, bestScore > originalAlpha ? HashFlagsExact : HashFlagsAlpha);
+	StoreHash(position.Hash, bestScore, MaxEval, hashMove, ply, bestScore > originalAlpha ? HashFlagsExact : HashFlagsAlpha);
 
 	return bestScore;
 }
@@ -1093,7 +1165,7 @@ void PrintPV(Position &position, const Move move, int depth)
 	position.UnmakeMove(move, moveUndo);
 }
 
-Move IterativeDeepening(Position &rootPosition, const int maxDepth, int &score, s64 searchTime, bool printSearchInfo)
+Move IterativeDeepening(Position &rootPosition, const int maxDepth, int &score, s64 searchTime, bool printSearchInfo, const u64 nodeLimit)
 {
 	KillSearch = false;
 
@@ -1110,10 +1182,14 @@ Move IterativeDeepening(Position &rootPosition, const int maxDepth, int &score,
 	Position position;
 	rootPosition.Clone(position);
 
-	SearchInfo &searchInfo = GetSearchInfo(0);
+	SearchInfo &searchInfo = GetSearchInfo(SearchThread);
 	searchInfo.NodeCount = 0;
 	searchInfo.QNodeCount = 0;
+	searchInfo.TbHits = 0;
 	searchInfo.Timeout = 0;
+	searchInfo.NodeLimit = nodeLimit;
+	EvalCacheProbes = 0;
+	EvalCacheHits = 0;
 	// TODO: try tricks with killers? - like moving them down two ply
 
 	Move moves[256];
@@ -1139,8 +1215,10 @@ Move IterativeDeepening(Position &rootPosition, const int maxDepth, int &score,
 	StableSortMoves(moves, moveScores, moveCount);
 
 	int alpha = MinEval, beta = MaxEval;
-	Move bestMove;
-	int bestScore;
+
+	// In case the first iteration doesn't finish
+	Move bestMove = moves[0];
+	int bestScore = moveScores[0];
 
 	// Iterative deepening loop
 	for (int depth = 1; depth <= min(maxDepth, 65); depth++)
@@ -1193,7 +1271,7 @@ Move IterativeDeepening(Position &rootPosition, const int maxDepth, int &score,
 			const u64 nodeCount = searchInfo.NodeCount + searchInfo.QNodeCount;
 			const u64 msTaken = GetCurrentMilliseconds() - SearchStartTime;
 			const u64 nps = (nodeCount * 1000) / max(1ULL, msTaken);
-			printf("info depth %d score cp %d nodes %lld time %lld nps %lld pv ", depth, (int)value, nodeCount, msTaken, nps);
+			printf("info depth %d score cp %d nodes %lld tbhits %lld time %lld nps %lld pv ", depth, (int)value, nodeCount, searchInfo.TbHits, msTaken, nps);
 			PrintPV(position, moves[0], depth * 3);
 			printf("\n");
 		}
@@ -1205,6 +1283,13 @@ Move IterativeDeepening(Position &rootPosition, const int maxDepth, int &score,
 		}
 	}
 
+#ifdef EVAL_PROFILE
+	if (printSearchInfo)
+	{
+		printf("info string eval cache hits %.1f%%\n", (EvalCacheHits * 100.0) / max(1ULL, EvalCacheProbes));
+	}
+#endif
+
 	score = bestScore;
 	return bestMove;
 }
@@ -7,19 +7,27 @@ struct SearchInfo
 {
 	u64 NodeCount;
 	u64 QNodeCount;
+	u64 TbHits;
 	u64 Timeout;
+	u64 NodeLimit;
 
 	Move Killers[MaxPly][2];
     int History[16][64];
 };
 
-// Set to true to stop the search as soon as possible
-extern bool KillSearch;
+// Set to true to stop the search as soon as possible (each thread has its own)
+extern THREAD_LOCAL bool KillSearch;
 
 SearchInfo &GetSearchInfo(int thread);
-bool FastSee(const Position &position, const Move move, const Color us);
+
+// Which SearchInfo the calling thread searches with.  Thread 0 is the one reading commands, the others never check
+// for input while searching.
+void SetSearchThread(const int thread);
+
+int See(const Position &position, const Move move, const Color us);
+bool SeeAtLeast(const Position &position, const Move move, const Color us, const int threshold);
 int QSearch(Position &position, SearchInfo &searchInfo, int alpha, const int beta, const int depth);
 int QSearchCheck(Position &position, SearchInfo &searchInfo, int alpha, const int beta, const int depth);
-Move IterativeDeepening(Position &position, const int maxDepth, int &score, s64 searchTime, bool printSearchInfo);
+Move IterativeDeepening(Position &position, const int maxDepth, int &score, s64 searchTime, bool printSearchInfo, const u64 nodeLimit = ~0ULL);
 
 void InitializeSearch();
\ No newline at end of file
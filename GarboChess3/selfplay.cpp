@@ -0,0 +1,235 @@
+#include "garbochess.h"
+#include "position.h"
+#include "movegen.h"
+#include "evaluation.h"
+#include "search.h"
+#include "hashtable.h"
+#include "mersenne.h"
+#include "packed.h"
+#include "selfplay.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+static const char *SelfPlayStartFen = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+const u64 SelfPlayReportInterval = 10000;
+
+struct SelfPlayWork
+{
+	std::FILE *Output;
+	int Depth;
+	u64 NodeLimit;
+	u64 PositionTarget;
+	u32 Seed;
+	int ThreadCount;
+	u64 StartTime;
+	volatile int GameCounts[MaxThreads];
+	volatile int PositionCounts[MaxThreads];
+	volatile bool Stop;
+};
+
+struct SelfPlayThreadInfo
+{
+	SelfPlayWork *Work;
+	int Thread;
+};
+
+static void GetSelfPlayCounts(const SelfPlayWork &work, u64 &games, u64 &positions)
+{
+	games = positions = 0;
+	for (int i = 0; i < work.ThreadCount; i++)
+	{
+		games += work.GameCounts[i];
+		positions += work.PositionCounts[i];
+	}
+}
+
+static void PrintSelfPlayProgress(const SelfPlayWork &work)
+{
+	u64 games, positions;
+	GetSelfPlayCounts(work, games, positions);
+
+	const u64 elapsed = max(u64(1), GetCurrentMilliseconds() - work.StartTime);
+	printf("%lld games, %lld positions, %lld ms, %.0f positions per hour\n",
+		games, positions, elapsed, (double(positions) * 3600000.0) / double(elapsed));
+}
+
+// Plays one game into positions (left empty if the opening was thrown away), returns false if it was stopped
+static bool PlaySelfPlayGame(SelfPlayWork &work, MTRand &random, std::vector<PackedPosition> &positions)
+{
+	positions.clear();
+
+	// Entries from earlier games age out of the shared table like they do between UCI searches.  The threads race on
+	// the date, a lost increment only delays the aging.
+	IncrementHashDate();
+
+	Position position;
+	position.Initialize(SelfPlayStartFen);
+
+	Move moves[256];
+	for (int i = 0; i < SelfPlayRandomPlies; i++)
+	{
+		const int moveCount = GenerateLegalMoves(position, moves);
+		if (moveCount == 0)
+		{
+			return true;
+		}
+
+		MoveUndo moveUndo;
+		position.MakeMove(moves[random.randInt(moveCount - 1)], moveUndo);
+		if (position.Fifty == 0)
+		{
+			position.ResetMoveDepth();
+		}
+	}
+
+	int result = PackedResultDraw;
+	for (int ply = 0; ; ply++)
+	{
+		if (work.Stop)
+		{
+			return false;
+		}
+
+		const int moveCount = GenerateLegalMoves(position, moves);
+		if (moveCount == 0)
+		{
+			if (position.IsInCheck())
+			{
+				result = position.ToMove == WHITE ? PackedResultBlackWin : PackedResultWhiteWin;
+			}
+			break;
+		}
+
+		if (ply >= SelfPlayMaxPlies || position.IsDraw() || IsDrawnMaterial(position))
+		{
+			break;
+		}
+
+		int score;
+		const Move move = IterativeDeepening(position, work.Depth, score, -1, false, work.NodeLimit);
+
+		if (ply == 0 && abs(score) > SelfPlayMaxOpeningScore)
+		{
+			positions.clear();
+			return true;
+		}
+
+		PackedPosition packed;
+		if (PackPosition(position, packed))
+		{
+			packed.Score = s16(score);
+			packed.BestMove = move;
+			positions.push_back(packed);
+		}
+
+		if (abs(score) >= SelfPlayWinScore)
+		{
+			result = (score > 0) == (position.ToMove == WHITE) ? PackedResultWhiteWin : PackedResultBlackWin;
+			break;
+		}
+
+		MoveUndo moveUndo;
+		position.MakeMove(move, moveUndo);
+		if (position.Fifty == 0)
+		{
+			position.ResetMoveDepth();
+		}
+	}
+
+	for (int i = 0; i < (int)positions.size(); i++)
+	{
+		positions[i].Result = u8(result);
+	}
+	return true;
+}
+
+static void SelfPlayThread(void *argument)
+{
+	SelfPlayThreadInfo &info = *(SelfPlayThreadInfo*)argument;
+	SelfPlayWork &work = *info.Work;
+
+	// SearchInfo 0 belongs to the thread reading commands
+	SetSearchThread(info.Thread + 1);
+	ClearEvaluationCaches();
+
+	MTRand random(MTRand::uint32(work.Seed + info.Thread * 7919));
+	std::vector<PackedPosition> positions;
+	u64 lastReport = GetCurrentMilliseconds();
+	while (!work.Stop && PlaySelfPlayGame(work, random, positions))
+	{
+		if (positions.empty())
+		{
+			continue;
+		}
+
+		// stdio locks the file for each call, so the positions of a game stay together
+		WritePackedPositions(work.Output, &positions[0], (int)positions.size());
+		work.GameCounts[info.Thread]++;
+		work.PositionCounts[info.Thread] += (int)positions.size();
+
+		u64 games, total;
+		GetSelfPlayCounts(work, games, total);
+		if (total >= work.PositionTarget)
+		{
+			work.Stop = true;
+		}
+
+		if (info.Thread == 0 && GetCurrentMilliseconds() - lastReport >= SelfPlayReportInterval)
+		{
+			PrintSelfPlayProgress(work);
+			lastReport = GetCurrentMilliseconds();
+		}
+	}
+}
+
+bool GenerateSelfPlay(const std::string &filename, const u64 positionCount, const int depth, const u64 nodeLimit, const int threadCount)
+{
+	std::FILE *output = OpenPackedPositions(filename, true);
+	if (output == NULL)
+	{
+		return false;
+	}
+
+	SelfPlayWork work;
+	work.Output = output;
+	work.Depth = depth;
+	work.NodeLimit = nodeLimit;
+	work.PositionTarget = positionCount;
+	work.StartTime = GetCurrentMilliseconds();
+	work.Seed = u32(work.StartTime);
+	work.ThreadCount = max(1, min(threadCount, MaxThreads));
+	work.Stop = false;
+	for (int i = 0; i < work.ThreadCount; i++)
+	{
+		work.GameCounts[i] = work.PositionCounts[i] = 0;
+	}
+
+	SelfPlayThreadInfo infos[MaxThreads];
+	ThreadHandle threads[MaxThreads];
+	for (int i = 0; i < work.ThreadCount; i++)
+	{
+		infos[i].Work = &work;
+		infos[i].Thread = i;
+		if (i > 0)
+		{
+			threads[i] = StartThread(SelfPlayThread, &infos[i]);
+		}
+	}
+
+	// The calling thread plays as well, and reports the progress
+	SelfPlayThread(&infos[0]);
+
+	for (int i = 1; i < work.ThreadCount; i++)
+	{
+		WaitForThread(threads[i]);
+	}
+	SetSearchThread(0);
+
+	std::fclose(output);
+
+	PrintSelfPlayProgress(work);
+	return true;
+}
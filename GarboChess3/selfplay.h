@@ -0,0 +1,17 @@
+// Self-play games for training and tuning data (the gensfen of other engines).
+//
+// Each thread plays its own games with its own search state (the transposition table is shared, as in a parallel
+// search).  A game starts with SelfPlayRandomPlies random moves, openings that come out too unbalanced are thrown
+// away, then every move is a search limited by depth and/or nodes.  Each searched position is written as a
+// PackedPosition (see packed.h) with its search score and best move, and the game result once the game is over.
+//
+// Games end at mate or a draw by the rules or material, and are adjudicated once a search scores SelfPlayWinScore or
+// the game reaches SelfPlayMaxPlies.
+const int SelfPlayRandomPlies = 8;
+const int SelfPlayMaxOpeningScore = 300;
+const int SelfPlayWinScore = 2000;
+const int SelfPlayMaxPlies = 400;
+
+// Appends games to filename until it has added positionCount positions, returns false if the file can't be opened.
+// Progress (positions per hour) is printed as it goes.  Threads are limited to MaxThreads.
+bool GenerateSelfPlay(const std::string &filename, const u64 positionCount, const int depth, const u64 nodeLimit, const int threadCount);
@@ -0,0 +1,994 @@
+#include "garbochess.h"
+#include "position.h"
+#include "movegen.h"
+#include "evaluation.h"
+#include "tablebase.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+const u32 TablebaseVersion = 1;
+
+// Entry values: 0 is a draw, 1 to 126 a win in that many moves, TablebaseLoss + n a loss in n moves (0 is checkmate)
+const u8 TablebaseDraw = 0;
+const u8 TablebaseLoss = 128;
+const u8 TablebaseIllegal = 254;		// only while generating
+const u8 TablebaseUnknown = 255;
+
+inline bool IsTablebaseWin(const u8 value)
+{
+	return value != TablebaseDraw && value < TablebaseLoss;
+}
+
+inline bool IsTablebaseLoss(const u8 value)
+{
+	return value >= TablebaseLoss && value < TablebaseIllegal;
+}
+
+inline int GetTablebasePlies(const u8 value)
+{
+	if (IsTablebaseWin(value))
+	{
+		return value * 2 - 1;
+	}
+	return IsTablebaseLoss(value) ? (value - TablebaseLoss) * 2 : 0;
+}
+
+inline u8 MakeTablebaseWin(const int plies)
+{
+	ASSERT((plies & 1) == 1 && plies < 2 * TablebaseLoss - 2);
+	return u8((plies + 1) / 2);
+}
+
+inline u8 MakeTablebaseLoss(const int plies)
+{
+	ASSERT((plies & 1) == 0 && plies / 2 < TablebaseIllegal - TablebaseLoss);
+	return u8(TablebaseLoss + plies / 2);
+}
+
+struct Tablebase
+{
+	std::string Name;
+	int PieceCount;
+	Piece Pieces[TablebaseMaxPieces];		// white king, black king, then the others, alike pieces next to each other
+	bool HasPawns;
+	u64 EntryCount;
+
+	// Either the mapped file, or uncompressed values (while generating, or when there is no file)
+	const void *Mapping;
+	u64 MappingSize;
+	const u64 *BlockOffsets;
+	const u8 *Blocks;
+	const u8 *Values;
+	std::vector<u8> Generated;
+};
+
+const int MaxTablebases = 512;
+static Tablebase *Tablebases[MaxTablebases];
+static int TablebaseCount = 0;
+int TablebasePieceCount = 0;
+
+// Every table under the material signature of both colorings, a flipped table has the colors swapped
+struct TablebaseLookupEntry
+{
+	u64 Signature;
+	Tablebase *Table;
+	bool Flipped;
+};
+
+const int TablebaseLookupMask = 2047;
+static TablebaseLookupEntry TablebaseLookup[TablebaseLookupMask + 1];
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Names
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static const char TablebasePieceLetters[] = " PNBRQK";
+
+static PieceType GetTablebasePieceType(const char letter)
+{
+	const char *found = strchr(TablebasePieceLetters + 1, letter);
+	return found == NULL || letter == 0 ? PIECE_NONE : PieceType(found - TablebasePieceLetters);
+}
+
+static bool CompareTablebaseLetters(const char a, const char b)
+{
+	return GetTablebasePieceType(a) > GetTablebasePieceType(b);
+}
+
+static int GetTablebaseSideValue(const std::string &side)
+{
+	static const int values[] = { 0, 1, 3, 3, 5, 9, 0 };
+	int value = 0;
+	for (int i = 0; i < (int)side.size(); i++)
+	{
+		value += values[GetTablebasePieceType(side[i])];
+	}
+	return value;
+}
+
+// The king first then the others from the most valuable, and the stronger side first
+static std::string GetTablebaseName(std::string white, std::string black)
+{
+	std::sort(white.begin(), white.end(), CompareTablebaseLetters);
+	std::sort(black.begin(), black.end(), CompareTablebaseLetters);
+
+	const int whiteValue = GetTablebaseSideValue(white);
+	const int blackValue = GetTablebaseSideValue(black);
+	if (whiteValue > blackValue ||
+		(whiteValue == blackValue && (white.size() > black.size() || (white.size() == black.size() && white >= black))))
+	{
+		return white + black;
+	}
+	return black + white;
+}
+
+// Splits a name into its sides, returns false if it isn't a valid signature
+static bool ParseTablebaseName(const std::string &name, std::string &white, std::string &black)
+{
+	const size_t blackKing = name.find('K', 1);
+	if (name.empty() || name[0] != 'K' || blackKing == std::string::npos || name.size() > TablebaseMaxPieces)
+	{
+		return false;
+	}
+
+	white = name.substr(0, blackKing);
+	black = name.substr(blackKing);
+	for (int i = 1; i < (int)name.size(); i++)
+	{
+		const PieceType piece = GetTablebasePieceType(name[i]);
+		if (piece == PIECE_NONE || (piece == KING && i != (int)blackKing))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// Tables a capture or a promotion can lead to
+static void GetTablebaseChildren(const std::string &name, std::vector<std::string> &children)
+{
+	std::string sides[2];
+	ParseTablebaseName(name, sides[WHITE], sides[BLACK]);
+
+	std::vector<std::string> result;
+	for (Color us = WHITE; us <= BLACK; us++)
+	{
+		const std::string &ours = sides[us], &theirs = sides[FlipColor(us)];
+		for (int i = 1; i < (int)theirs.size(); i++)
+		{
+			const std::string captured = theirs.substr(0, i) + theirs.substr(i + 1);
+			result.push_back(GetTablebaseName(ours, captured));
+		}
+
+		for (int i = 1; i < (int)ours.size(); i++)
+		{
+			if (ours[i] != 'P')
+			{
+				continue;
+			}
+
+			for (const char *promotion = "QRBN"; *promotion; promotion++)
+			{
+				std::string promoted = ours;
+				promoted[i] = *promotion;
+				result.push_back(GetTablebaseName(promoted, theirs));
+
+				for (int j = 1; j < (int)theirs.size(); j++)
+				{
+					const std::string captured = theirs.substr(0, j) + theirs.substr(j + 1);
+					result.push_back(GetTablebaseName(promoted, captured));
+				}
+			}
+		}
+	}
+
+	for (int i = 0; i < (int)result.size(); i++)
+	{
+		// Bare kings don't need a table
+		if (result[i] != "KK" && std::find(children.begin(), children.end(), result[i]) == children.end())
+		{
+			children.push_back(result[i]);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Indexing
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// White king squares, the a1-d1-d4 triangle without pawns and files a-d with them
+static int KingIndex[2][64];
+static Square KingSquares[2][32];
+
+static void InitializeKingIndices()
+{
+	static bool initialized = false;
+	if (initialized)
+	{
+		return;
+	}
+	initialized = true;
+
+	int count[2] = { 0, 0 };
+	for (Square square = 0; square < 64; square++)
+	{
+		KingIndex[false][square] = KingIndex[true][square] = -1;
+		if (GetColumn(square) <= FILE_D)
+		{
+			KingSquares[true][count[true]] = square;
+			KingIndex[true][square] = count[true]++;
+		}
+	}
+
+	for (int rank = 0; rank < 4; rank++)
+	{
+		for (int file = rank; file <= FILE_D; file++)
+		{
+			const Square square = MakeSquare(RANK_1 - rank, file);
+			KingSquares[false][count[false]] = square;
+			KingIndex[false][square] = count[false]++;
+		}
+	}
+	ASSERT(count[false] == 10 && count[true] == 32);
+}
+
+inline int GetKingIndexCount(const Tablebase &table)
+{
+	return table.HasPawns ? 32 : 10;
+}
+
+inline Square MirrorFile(const Square square)
+{
+	return MakeSquare(GetRow(square), FILE_H - GetColumn(square));
+}
+
+inline Square MirrorRank(const Square square)
+{
+	return MakeSquare(RANK_1 - GetRow(square), GetColumn(square));
+}
+
+// Reflects in the a1-h8 diagonal
+inline Square Transpose(const Square square)
+{
+	return MakeSquare(RANK_1 - GetColumn(square), FILE_H - GetRow(square));
+}
+
+inline bool IsOnDiagonal(const Square square)
+{
+	return RANK_1 - GetRow(square) == GetColumn(square);
+}
+
+// Moves the white king into its indexed squares, by symmetry
+static void NormalizeTablebaseSquares(const Tablebase &table, Square *squares)
+{
+	if (GetColumn(squares[0]) > FILE_D)
+	{
+		for (int i = 0; i < table.PieceCount; i++) squares[i] = MirrorFile(squares[i]);
+	}
+
+	if (!table.HasPawns)
+	{
+		if (GetRow(squares[0]) < RANK_4)
+		{
+			for (int i = 0; i < table.PieceCount; i++) squares[i] = MirrorRank(squares[i]);
+		}
+		if (RANK_1 - GetRow(squares[0]) > GetColumn(squares[0]))
+		{
+			for (int i = 0; i < table.PieceCount; i++) squares[i] = Transpose(squares[i]);
+		}
+	}
+}
+
+// Squares must be normalized
+static u64 GetTablebaseIndex(const Tablebase &table, const Square *squares, const Color toMove)
+{
+	ASSERT(KingIndex[table.HasPawns][squares[0]] >= 0);
+
+	u64 index = u64(toMove) * GetKingIndexCount(table) + KingIndex[table.HasPawns][squares[0]];
+	for (int i = 1; i < table.PieceCount; i++)
+	{
+		index = index * 64 + squares[i];
+	}
+	return index;
+}
+
+static void DecodeTablebaseIndex(const Tablebase &table, u64 index, Square *squares, Color &toMove)
+{
+	for (int i = table.PieceCount - 1; i >= 1; i--)
+	{
+		squares[i] = Square(index & 63);
+		index >>= 6;
+	}
+	squares[0] = KingSquares[table.HasPawns][index % GetKingIndexCount(table)];
+	toMove = Color(index / GetKingIndexCount(table));
+}
+
+// The squares of the table's pieces in position, colors swapped (and the board flipped) if flipped
+static void GetTablebaseSquares(const Tablebase &table, const Position &position, const bool flipped, Square *squares)
+{
+	Bitboard pieces = 0;
+	for (int i = 0; i < table.PieceCount; i++)
+	{
+		const Piece piece = table.Pieces[i];
+		if (i == 0 || piece != table.Pieces[i - 1])
+		{
+			const Color color = flipped ? FlipColor(GetPieceColor(piece)) : GetPieceColor(piece);
+			pieces = position.Pieces[GetPieceType(piece)] & position.Colors[color];
+		}
+
+		const Square square = PopFirstBit(pieces);
+		squares[i] = flipped ? FlipSquare(square) : square;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tables
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void SetupTablebase(Tablebase &table, const std::string &name)
+{
+	InitializeKingIndices();
+
+	table.Name = name;
+	table.PieceCount = int(name.size());
+	table.HasPawns = name.find('P') != std::string::npos;
+	table.Mapping = 0;
+	table.MappingSize = 0;
+	table.BlockOffsets = 0;
+	table.Blocks = 0;
+	table.Values = 0;
+
+	const size_t blackKing = name.find('K', 1);
+	table.Pieces[0] = MakePiece(WHITE, KING);
+	table.Pieces[1] = MakePiece(BLACK, KING);
+	int count = 2;
+	for (int i = 1; i < (int)name.size(); i++)
+	{
+		if (i != (int)blackKing)
+		{
+			table.Pieces[count++] = MakePiece(i < (int)blackKing ? WHITE : BLACK, GetTablebasePieceType(name[i]));
+		}
+	}
+
+	table.EntryCount = 2 * GetKingIndexCount(table);
+	for (int i = 1; i < table.PieceCount; i++)
+	{
+		table.EntryCount *= 64;
+	}
+}
+
+static u8 GetTablebaseValue(const Tablebase &table, const u64 index)
+{
+	ASSERT(index < table.EntryCount);
+
+	if (table.Values != 0)
+	{
+		return table.Values[index];
+	}
+
+	// Runs are (length - 1, value) pairs
+	int offset = int(index % TablebaseBlockSize);
+	const u8 *data = table.Blocks + table.BlockOffsets[index / TablebaseBlockSize];
+	while (offset > data[0])
+	{
+		offset -= data[0] + 1;
+		data += 2;
+	}
+	return data[1];
+}
+
+static const TablebaseLookupEntry *FindTablebase(const u64 signature)
+{
+	for (int i = int(signature & TablebaseLookupMask); ; i = (i + 1) & TablebaseLookupMask)
+	{
+		if (TablebaseLookup[i].Table == 0 || TablebaseLookup[i].Signature == signature)
+		{
+			return TablebaseLookup[i].Table != 0 ? TablebaseLookup + i : 0;
+		}
+	}
+}
+
+static Tablebase *FindTablebase(const std::string &name)
+{
+	const TablebaseLookupEntry *entry = FindTablebase(Position::GetMaterialSignature(name));
+	return entry != 0 ? entry->Table : 0;
+}
+
+static void AddTablebaseLookup(const u64 signature, Tablebase *table, const bool flipped)
+{
+	int i = int(signature & TablebaseLookupMask);
+	while (TablebaseLookup[i].Table != 0)
+	{
+		if (TablebaseLookup[i].Signature == signature)
+		{
+			return;
+		}
+		i = (i + 1) & TablebaseLookupMask;
+	}
+
+	TablebaseLookup[i].Signature = signature;
+	TablebaseLookup[i].Table = table;
+	TablebaseLookup[i].Flipped = flipped;
+}
+
+static void AddTablebase(Tablebase *table)
+{
+	ASSERT(TablebaseCount < MaxTablebases);
+	Tablebases[TablebaseCount++] = table;
+
+	std::string white, black;
+	ParseTablebaseName(table->Name, white, black);
+	AddTablebaseLookup(Position::GetMaterialSignature(white + black), table, false);
+	AddTablebaseLookup(Position::GetMaterialSignature(black + white), table, true);
+
+	TablebasePieceCount = max(TablebasePieceCount, table->PieceCount);
+}
+
+static std::string GetTablebaseFilename(const std::string &path, const std::string &name)
+{
+	if (path.empty() || path[path.size() - 1] == '/' || path[path.size() - 1] == '\\')
+	{
+		return path + name + ".gtb";
+	}
+	return path + "/" + name + ".gtb";
+}
+
+static bool MapTablebase(Tablebase &table, const std::string &filename)
+{
+	u64 size;
+	const void *data = MapFile(filename.c_str(), size);
+	if (data == 0)
+	{
+		return false;
+	}
+
+	const TablebaseFileHeader *header = reinterpret_cast<const TablebaseFileHeader*>(data);
+	const u32 blockCount = u32((table.EntryCount + TablebaseBlockSize - 1) / TablebaseBlockSize);
+	if (size < sizeof(TablebaseFileHeader) + (blockCount + 1) * sizeof(u64) ||
+		memcmp(header->Magic, "GCTB", 4) != 0 ||
+		header->Version != TablebaseVersion ||
+		header->BlockSize != TablebaseBlockSize ||
+		header->BlockCount != blockCount ||
+		header->EntryCount != table.EntryCount)
+	{
+		UnmapFile(data, size);
+		return false;
+	}
+
+	table.Mapping = data;
+	table.MappingSize = size;
+	table.BlockOffsets = reinterpret_cast<const u64*>(header + 1);
+	table.Blocks = reinterpret_cast<const u8*>(table.BlockOffsets + blockCount + 1);
+	table.Values = 0;
+	return true;
+}
+
+void UnloadTablebases()
+{
+	for (int i = 0; i < TablebaseCount; i++)
+	{
+		if (Tablebases[i]->Mapping != 0)
+		{
+			UnmapFile(Tablebases[i]->Mapping, Tablebases[i]->MappingSize);
+		}
+		delete Tablebases[i];
+	}
+
+	TablebaseCount = 0;
+	TablebasePieceCount = 0;
+	memset(TablebaseLookup, 0, sizeof(TablebaseLookup));
+}
+
+// Every sorted set of up to count pieces
+static void GetTablebasePieceSets(const std::string &prefix, const int first, const int count, std::vector<std::string> &sets)
+{
+	sets.push_back(prefix);
+	if (count == 0)
+	{
+		return;
+	}
+
+	for (int piece = first; piece >= PAWN; piece--)
+	{
+		GetTablebasePieceSets(prefix + TablebasePieceLetters[piece], piece, count - 1, sets);
+	}
+}
+
+int LoadTablebases(const std::string &path)
+{
+	UnloadTablebases();
+
+	std::vector<std::string> sets;
+	GetTablebasePieceSets("K", QUEEN, TablebaseMaxPieces - 2, sets);
+
+	for (int i = 0; i < (int)sets.size(); i++)
+	{
+		for (int j = 0; j < (int)sets.size(); j++)
+		{
+			if (sets[i].size() + sets[j].size() > TablebaseMaxPieces || (i == 0 && j == 0))
+			{
+				continue;
+			}
+
+			const std::string name = GetTablebaseName(sets[i], sets[j]);
+			if (name != sets[i] + sets[j] || FindTablebase(name) != 0)
+			{
+				continue;
+			}
+
+			Tablebase *table = new Tablebase();
+			SetupTablebase(*table, name);
+			if (MapTablebase(*table, GetTablebaseFilename(path, name)))
+			{
+				AddTablebase(table);
+			}
+			else
+			{
+				delete table;
+			}
+		}
+	}
+
+	return TablebaseCount;
+}
+
+// TablebaseUnknown if there is no table for the position
+static u8 ProbeTablebaseValue(const Position &position)
+{
+	const TablebaseLookupEntry *entry = FindTablebase(position.MaterialHash);
+	if (entry == 0)
+	{
+		return TablebaseUnknown;
+	}
+
+	Square squares[TablebaseMaxPieces];
+	GetTablebaseSquares(*entry->Table, position, entry->Flipped, squares);
+	NormalizeTablebaseSquares(*entry->Table, squares);
+
+	const Color toMove = entry->Flipped ? FlipColor(position.ToMove) : position.ToMove;
+	return GetTablebaseValue(*entry->Table, GetTablebaseIndex(*entry->Table, squares, toMove));
+}
+
+bool ProbeTablebase(const Position &position, int &wdl, int &pliesToMate)
+{
+	const u8 value = ProbeTablebaseValue(position);
+	if (value == TablebaseUnknown)
+	{
+		return false;
+	}
+
+	ASSERT(value != TablebaseIllegal);
+	wdl = IsTablebaseWin(value) ? 1 : IsTablebaseLoss(value) ? -1 : 0;
+	pliesToMate = GetTablebasePlies(value);
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Generation
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Positions are solved in passes: pass n resolves the positions that are n plies from mate, using the children
+// resolved so far.  Only positions whose children changed (found by un-moving the resolved ones) or that are waiting
+// on a longer mate through a capture or promotion are looked at again.
+const int TablebaseChunkSize = 16384;
+
+struct TablebaseWork
+{
+	const Tablebase *Table;
+	u8 *Values;
+	const u8 *Candidates;		// positions to look at in this pass
+	u8 *NextCandidates;
+	int Pass;
+	int ChunkCount;
+	volatile int NextChunk;
+	volatile int Marked;
+};
+
+// Returns false for impossible positions, or ones where the side not to move is in check
+static bool SetupTablebasePosition(const Tablebase &table, const Square *squares, const Color toMove, Position &position)
+{
+	Piece board[64];
+	memset(board, 0, sizeof(board));
+
+	for (int i = 0; i < table.PieceCount; i++)
+	{
+		if (board[squares[i]] != PIECE_NONE ||
+			(GetPieceType(table.Pieces[i]) == PAWN && (GetRow(squares[i]) == RANK_8 || GetRow(squares[i]) == RANK_1)))
+		{
+			return false;
+		}
+		board[squares[i]] = table.Pieces[i];
+	}
+
+	position.Initialize(board, toMove);
+	return !position.CanCaptureKing();
+}
+
+// The value of position from its children, TablebaseUnknown if that isn't known by this pass yet.  Sets pending if
+// the position has to be looked at again even if none of its children change.
+static u8 GetTablebaseResult(Position &position, const int pass, bool &pending)
+{
+	Move moves[256];
+	const int moveCount = GenerateLegalMoves(position, moves);
+	if (moveCount == 0)
+	{
+		return position.IsInCheck() ? MakeTablebaseLoss(0) : TablebaseDraw;
+	}
+
+	const int none = 1000;
+	int bestWin = none, longestLoss = 0;
+	bool draw = false, unknown = false;
+	for (int i = 0; i < moveCount; i++)
+	{
+		MoveUndo moveUndo;
+		position.MakeMove(moves[i], moveUndo);
+
+		u8 value;
+		if (position.EnPassent != -1 &&
+			(GetPawnAttacks(position.EnPassent, FlipColor(position.ToMove)) & position.Pieces[PAWN] & position.Colors[position.ToMove]))
+		{
+			// Positions with an en passant capture aren't in the tables, look one move further
+			bool childPending = false;
+			value = GetTablebaseResult(position, pass, childPending);
+			pending |= value == TablebaseUnknown;
+		}
+		else if (CountBitsSetFew(position.GetAllPieces()) == 2)
+		{
+			value = TablebaseDraw;
+		}
+		else
+		{
+			value = ProbeTablebaseValue(position);
+		}
+
+		position.UnmakeMove(moves[i], moveUndo);
+
+		if (value == TablebaseUnknown)
+		{
+			unknown = true;
+		}
+		else if (IsTablebaseLoss(value))
+		{
+			bestWin = min(bestWin, GetTablebasePlies(value) + 1);
+		}
+		else if (IsTablebaseWin(value))
+		{
+			longestLoss = max(longestLoss, GetTablebasePlies(value) + 1);
+		}
+		else
+		{
+			draw = true;
+		}
+	}
+
+	// Anything not known yet is at least pass plies from mate, so shorter results are exact
+	if (bestWin != none)
+	{
+		if (bestWin <= pass)
+		{
+			return MakeTablebaseWin(bestWin);
+		}
+		pending = true;
+		return TablebaseUnknown;
+	}
+
+	if (unknown)
+	{
+		return TablebaseUnknown;
+	}
+
+	if (draw)
+	{
+		return TablebaseDraw;
+	}
+
+	if (longestLoss <= pass)
+	{
+		return MakeTablebaseLoss(longestLoss);
+	}
+	pending = true;
+	return TablebaseUnknown;
+}
+
+static void MarkTablebaseCandidate(const Tablebase &table, const Square *squares, const Color toMove, u8 *candidates)
+{
+	Square normalized[TablebaseMaxPieces];
+	memcpy(normalized, squares, table.PieceCount * sizeof(Square));
+	NormalizeTablebaseSquares(table, normalized);
+	candidates[GetTablebaseIndex(table, normalized, toMove)] = 1;
+
+	// With the white king on the diagonal, the reflected position is in the table as well
+	if (!table.HasPawns && IsOnDiagonal(normalized[0]))
+	{
+		for (int i = 0; i < table.PieceCount; i++) normalized[i] = Transpose(normalized[i]);
+		candidates[GetTablebaseIndex(table, normalized, toMove)] = 1;
+	}
+}
+
+// Marks the positions that reach this one with a move that doesn't capture or promote
+static void MarkTablebasePredecessors(const Tablebase &table, const Square *squares, const Color toMove, u8 *candidates)
+{
+	const Color mover = FlipColor(toMove);
+
+	Bitboard occupied = 0;
+	for (int i = 0; i < table.PieceCount; i++)
+	{
+		SetBit(occupied, squares[i]);
+	}
+
+	Square previous[TablebaseMaxPieces];
+	memcpy(previous, squares, table.PieceCount * sizeof(Square));
+
+	for (int i = 0; i < table.PieceCount; i++)
+	{
+		if (GetPieceColor(table.Pieces[i]) != mover)
+		{
+			continue;
+		}
+
+		const Square square = squares[i];
+		Bitboard from = 0;
+		switch (GetPieceType(table.Pieces[i]))
+		{
+		case PAWN:
+			{
+				// White pawns move towards row 0
+				const int back = mover == WHITE ? 8 : -8;
+				const int lastRow = mover == WHITE ? RANK_2 : RANK_7;
+				const int doubleRow = mover == WHITE ? RANK_4 : RANK_5;
+				if (GetRow(square) != lastRow && !IsBitSet(occupied, square + back))
+				{
+					SetBit(from, square + back);
+					if (GetRow(square) == doubleRow && !IsBitSet(occupied, square + 2 * back))
+					{
+						SetBit(from, square + 2 * back);
+					}
+				}
+			}
+			break;
+		case KNIGHT: from = GetKnightAttacks(square) & ~occupied; break;
+		case BISHOP: from = GetBishopAttacks(square, occupied) & ~occupied; break;
+		case ROOK: from = GetRookAttacks(square, occupied) & ~occupied; break;
+		case QUEEN: from = GetQueenAttacks(square, occupied) & ~occupied; break;
+		case KING: from = GetKingAttacks(square) & ~occupied; break;
+		}
+
+		while (from)
+		{
+			previous[i] = PopFirstBit(from);
+			MarkTablebaseCandidate(table, previous, mover, candidates);
+		}
+		previous[i] = square;
+	}
+}
+
+static void TablebaseThread(void *argument)
+{
+	TablebaseWork &work = *(TablebaseWork*)argument;
+	const Tablebase &table = *work.Table;
+
+	Position position;
+	for (;;)
+	{
+		const int chunk = AtomicIncrement(work.NextChunk) - 1;
+		if (chunk >= work.ChunkCount)
+		{
+			break;
+		}
+
+		const u64 start = u64(chunk) * TablebaseChunkSize;
+		const u64 end = min(start + TablebaseChunkSize, table.EntryCount);
+		for (u64 index = start; index < end; index++)
+		{
+			if (!work.Candidates[index] || work.Values[index] != TablebaseUnknown)
+			{
+				continue;
+			}
+
+			Square squares[TablebaseMaxPieces];
+			Color toMove;
+			DecodeTablebaseIndex(table, index, squares, toMove);
+			if (!SetupTablebasePosition(table, squares, toMove, position))
+			{
+				work.Values[index] = TablebaseIllegal;
+				continue;
+			}
+
+			bool pending = false;
+			const u8 value = GetTablebaseResult(position, work.Pass, pending);
+			if (value != TablebaseUnknown)
+			{
+				work.Values[index] = value;
+				MarkTablebasePredecessors(table, squares, toMove, work.NextCandidates);
+				work.Marked = 1;
+			}
+			else if (pending)
+			{
+				work.NextCandidates[index] = 1;
+				work.Marked = 1;
+			}
+		}
+	}
+}
+
+// Solves table, which has to be registered with its Generated values (its children are probed as usual)
+static void SolveTablebase(Tablebase &table, const int threadCount)
+{
+	std::vector<u8> &values = table.Generated;
+	std::vector<u8> candidates(table.EntryCount, 1), nextCandidates(table.EntryCount, 0);
+
+	TablebaseWork work;
+	work.Table = &table;
+	work.Values = &values[0];
+	work.ChunkCount = int((table.EntryCount + TablebaseChunkSize - 1) / TablebaseChunkSize);
+
+	for (work.Pass = 0; ; work.Pass++)
+	{
+		work.Candidates = &candidates[0];
+		work.NextCandidates = &nextCandidates[0];
+		work.NextChunk = 0;
+		work.Marked = 0;
+
+		const int helperCount = min(threadCount, work.ChunkCount) - 1;
+		ThreadHandle threads[256];
+		for (int i = 0; i < helperCount; i++)
+		{
+			threads[i] = StartThread(TablebaseThread, &work);
+		}
+
+		// The calling thread does its share of the work as well
+		TablebaseThread(&work);
+
+		for (int i = 0; i < helperCount; i++)
+		{
+			WaitForThread(threads[i]);
+		}
+
+		if (!work.Marked)
+		{
+			break;
+		}
+
+		candidates.swap(nextCandidates);
+		memset(&nextCandidates[0], 0, nextCandidates.size());
+	}
+
+	// Nobody can force mate from what is left
+	for (u64 i = 0; i < table.EntryCount; i++)
+	{
+		if (values[i] == TablebaseUnknown)
+		{
+			values[i] = TablebaseDraw;
+		}
+	}
+}
+
+static bool WriteTablebase(const Tablebase &table, const std::string &filename)
+{
+	std::FILE *file = std::fopen(filename.c_str(), "wb");
+	if (file == NULL)
+	{
+		return false;
+	}
+
+	TablebaseFileHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.Magic, "GCTB", 4);
+	header.Version = TablebaseVersion;
+	header.BlockSize = TablebaseBlockSize;
+	header.BlockCount = u32((table.EntryCount + TablebaseBlockSize - 1) / TablebaseBlockSize);
+	header.EntryCount = table.EntryCount;
+
+	// Illegal positions are never probed, they repeat the previous value so the runs stay long
+	std::vector<u64> offsets(header.BlockCount + 1);
+	std::vector<u8> blocks;
+	u8 last = TablebaseDraw;
+	for (u32 block = 0; block < header.BlockCount; block++)
+	{
+		offsets[block] = blocks.size();
+
+		const u64 end = min(u64(block + 1) * TablebaseBlockSize, table.EntryCount);
+		int run = 0;
+		for (u64 i = u64(block) * TablebaseBlockSize; i < end; i++)
+		{
+			const u8 value = table.Values[i] == TablebaseIllegal ? last : table.Values[i];
+			if (run > 0 && (value != last || run == 256))
+			{
+				blocks.push_back(u8(run - 1));
+				blocks.push_back(last);
+				run = 0;
+			}
+			last = value;
+			run++;
+		}
+		blocks.push_back(u8(run - 1));
+		blocks.push_back(last);
+	}
+	offsets[header.BlockCount] = blocks.size();
+
+	const bool written =
+		std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+		std::fwrite(&offsets[0], sizeof(u64), offsets.size(), file) == offsets.size() &&
+		std::fwrite(&blocks[0], 1, blocks.size(), file) == blocks.size();
+	std::fclose(file);
+	return written;
+}
+
+// Finds, loads or generates name (and what it depends on)
+static Tablebase *EnsureTablebase(const std::string &name, const std::string &path, const int threadCount)
+{
+	Tablebase *table = FindTablebase(name);
+	if (table != 0)
+	{
+		return table;
+	}
+
+	table = new Tablebase();
+	SetupTablebase(*table, name);
+	if (!path.empty() && MapTablebase(*table, GetTablebaseFilename(path, name)))
+	{
+		AddTablebase(table);
+		return table;
+	}
+
+	std::vector<std::string> children;
+	GetTablebaseChildren(name, children);
+	for (int i = 0; i < (int)children.size(); i++)
+	{
+		EnsureTablebase(children[i], path, threadCount);
+	}
+
+	const u64 startTime = GetCurrentMilliseconds();
+
+	table->Generated.assign(table->EntryCount, TablebaseUnknown);
+	table->Values = &table->Generated[0];
+	AddTablebase(table);
+	SolveTablebase(*table, threadCount);
+
+	u64 counts[3] = { 0, 0, 0 };
+	int longest = 0;
+	for (u64 i = 0; i < table->EntryCount; i++)
+	{
+		const u8 value = table->Values[i];
+		if (value != TablebaseIllegal)
+		{
+			counts[IsTablebaseWin(value) ? 0 : IsTablebaseLoss(value) ? 2 : 1]++;
+			longest = max(longest, GetTablebasePlies(value));
+		}
+	}
+
+	printf("%s: %lld positions, %lld won, %lld drawn, %lld lost, longest mate %d plies, %lld ms\n",
+		name.c_str(), counts[0] + counts[1] + counts[2], counts[0], counts[1], counts[2], longest,
+		GetCurrentMilliseconds() - startTime);
+
+	// Without a path (or if writing fails) the table stays in memory
+	if (!path.empty())
+	{
+		const std::string filename = GetTablebaseFilename(path, name);
+		if (WriteTablebase(*table, filename) && MapTablebase(*table, filename))
+		{
+			std::vector<u8>().swap(table->Generated);
+		}
+		else
+		{
+			printf("Unable to write %s\n", filename.c_str());
+		}
+	}
+
+	return table;
+}
+
+bool GenerateTablebase(const std::string &name, const std::string &path, const int threadCount)
+{
+	std::string white, black;
+	if (!ParseTablebaseName(name, white, black))
+	{
+		return false;
+	}
+
+	EnsureTablebase(GetTablebaseName(white, black), path, max(1, threadCount));
+	return true;
+}
@@ -0,0 +1,54 @@
+// Endgame tablebases, generated by the engine itself (the tbgen command) and probed by the search.
+//
+// A table covers one material signature, named like "KQKR" with the stronger side first, for up to
+// TablebaseMaxPieces pieces including the kings.  Every position stores win/draw/loss and the distance to mate in one
+// byte.  Positions are indexed by the white king square (a1-d1-d4 triangle without pawns, files a-d with pawns),
+// then the black king and the other pieces on 64 squares each, and the side to move.  Castling rights aren't
+// covered, and neither are en passant captures in the probed position itself.
+//
+// Files (<name>.gtb) are a TablebaseFileHeader, BlockCount + 1 offsets, then run length encoded blocks of
+// TablebaseBlockSize entries, so a probe only decodes part of one block of the mapped file.
+const int TablebaseMaxPieces = 5;
+const int TablebaseBlockSize = 1024;
+
+struct TablebaseFileHeader
+{
+	char Magic[4];
+	u32 Version;
+	u32 BlockSize;
+	u32 BlockCount;
+	u64 EntryCount;
+	u32 Reserved[2];
+};
+
+// Wins score below mate, shorter mates first
+const int TablebaseWinScore = 31000;
+
+// Most pieces in any loaded table, 0 when none are loaded
+extern int TablebasePieceCount;
+
+// Maps every table in path, returns the number of tables found
+int LoadTablebases(const std::string &path);
+void UnloadTablebases();
+
+// Finds the position in the loaded tables.  wdl is 1 for a win for the side to move, 0 for a draw and -1 for a loss,
+// pliesToMate is 0 for draws (and checkmates).
+bool ProbeTablebase(const Position &position, int &wdl, int &pliesToMate);
+
+inline int GetTablebaseScore(const int wdl, const int pliesToMate)
+{
+	return wdl == 0 ? 0 : wdl * (TablebaseWinScore - pliesToMate);
+}
+
+// Whether the search should probe at this position
+inline bool CanProbeTablebase(const Position &position)
+{
+	return TablebasePieceCount != 0 &&
+		CountBitsSet(position.GetAllPieces()) <= TablebasePieceCount &&
+		position.CastleFlags == 0 &&
+		position.EnPassent == -1;
+}
+
+// Generates the table for name and the tables it depends on (captures and promotions), writing them to path.
+// Existing files in path are used instead of regenerating them.  Returns false if name isn't a valid signature.
+bool GenerateTablebase(const std::string &name, const std::string &path, const int threadCount);
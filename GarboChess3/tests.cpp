@@ -6,6 +6,15 @@
 #include "hashtable.h"
 #include "utilities.h"
 #include "movesorter.h"
+#include "perft.h"
+#include "nnue.h"
+#include "bitbase.h"
+#include "tablebase.h"
+#include "book.h"
+#include "pgn.h"
+#include "packed.h"
+#include "selfplay.h"
+#include "batch.h"
 
 #include <cmath>
 #include <cstdio>
@@ -54,7 +63,32 @@ void UnitTests()
 	ASSERT(GetFirstBitIndex(b) == 16);
 	ASSERT(CountBitsSet(b) == 3);
 
-	// TODO: unit test rook attacks and bishop attacks
+	// The Kogge-Stone slider kernels must agree with the magic lookups
+	u64 seed = 12345;
+	for (int i = 0; i < 1000; i++)
+	{
+		Bitboard blockers = ~0ULL;
+		for (int j = 0; j < 3; j++)
+		{
+			seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+			blockers &= seed ^ (seed >> 29);
+		}
+
+		for (Square square = 0; square < 64; square += 4)
+		{
+			const Square squares[4] = { square, square + 1, square + 2, square + 3 };
+			const int count = (i % 4) + 1;
+			Bitboard bishopAttacks[4], rookAttacks[4];
+			GetBishopAttacksX4(squares, count, blockers, bishopAttacks);
+			GetRookAttacksX4(squares, count, blockers, rookAttacks);
+			for (int j = 0; j < count; j++)
+			{
+				ASSERT(bishopAttacks[j] == GetBishopAttacks(squares[j], blockers));
+				ASSERT(rookAttacks[j] == GetRookAttacks(squares[j], blockers));
+			}
+		}
+	}
+
 	// TODO: unit test move utility functions
 	// TODO: unit test square utility functions
 	// TODO: unit test Position::GetAttacksTo and Position::GetPinnedPieces
@@ -90,6 +124,19 @@ void UnitTests()
 	position.Initialize("2r5/pp1brp2/4pR2/4P1k1/5P2/P1R4P/1P4P1/6K1 b - f3 0 25");
 	SearchInfo searchInfo;
 	score = QSearchCheck(position, searchInfo, MinEval, MaxEval, 0); 
+	// Packed scores
+	Score packed = S(-5, 7);
+	ASSERT(GetOpening(packed) == -5 && GetEndgame(packed) == 7);
+	packed += S(3, -20);
+	ASSERT(GetOpening(packed) == -2 && GetEndgame(packed) == -13);
+	packed = -3 * packed;
+	ASSERT(GetOpening(packed) == 6 && GetEndgame(packed) == 39);
+	packed = S(-10000, -10000) - S(20000, 0);
+	ASSERT(GetOpening(packed) == -30000 && GetEndgame(packed) == -10000);
+	EvalScore evalPacked = WidenScore(S(-5, 7)) * 32;
+	ASSERT(GetOpening(evalPacked) == -160 && GetEndgame(evalPacked) == 224);
+	evalPacked = ES(-1000000, -1000000) - ES(2000000, 0);
+	ASSERT(GetOpening(evalPacked) == -3000000 && GetEndgame(evalPacked) == -1000000);
 }
 
 void CheckSee(const std::string &fen, const std::string &move, bool expected)
@@ -99,12 +146,28 @@ void CheckSee(const std::string &fen, const std::string &move, bool expected)
 	position.Initialize(fen);
 	Move captureMove = MakeMoveFromUciString(position, move);
 	ASSERT(IsMovePseudoLegal(position, captureMove));
-	ASSERT(FastSee(position, captureMove, position.ToMove) == expected);
+	ASSERT(SeeAtLeast(position, captureMove, position.ToMove, 0) == expected);
+	ASSERT((See(position, captureMove, position.ToMove) >= 0) == expected);
 
 	position.Flip();
 	captureMove = (captureMove & MoveTypeMask) | GenerateMove(FlipSquare(GetFrom(captureMove)), FlipSquare(GetTo(captureMove)));
 	ASSERT(IsMovePseudoLegal(position, captureMove));
-	ASSERT(FastSee(position, captureMove, position.ToMove) == expected);
+	ASSERT(SeeAtLeast(position, captureMove, position.ToMove, 0) == expected);
+	ASSERT((See(position, captureMove, position.ToMove) >= 0) == expected);
+}
+
+void CheckSeeValue(const std::string &fen, const std::string &move, int expected)
+{
+	Position position;
+
+	position.Initialize(fen);
+	Move captureMove = MakeMoveFromUciString(position, move);
+	ASSERT(IsMovePseudoLegal(position, captureMove));
+	ASSERT(See(position, captureMove, position.ToMove) == expected);
+
+	// The threshold version has to agree with the exact value
+	ASSERT(SeeAtLeast(position, captureMove, position.ToMove, expected));
+	ASSERT(!SeeAtLeast(position, captureMove, position.ToMove, expected + 1));
 }
 
 void SeeTests()
@@ -163,11 +226,311 @@ void SeeTests()
 
 	// Rook capturing rook defended by bishop
 	CheckSee("K7/5b2/8/3r4/8/3R4/3R4/7k w - - 0 1", "d3d5", true);
+
+	// Exact values
+	CheckSeeValue("K7/8/8/3p4/8/4N3/8/7k w - - 0 1", "e3d5", 100);
+	CheckSeeValue("K7/8/2p5/3p4/8/4N3/8/7k w - - 0 1", "e3d5", -225);
+	CheckSeeValue("K7/4n3/8/3p4/8/3R4/3R4/7k w - - 0 1", "d3d5", -75);
+	CheckSeeValue("K7/5b2/8/3n4/8/3R4/3R4/7k w - - 0 1", "d3d5", 150);
+	CheckSeeValue("4rrk1/2P4p/6p1/5p2/4p3/2R1P2P/5PP1/2R3K1 w - - 0 38", "c7c8q", 400);
+	CheckSeeValue("r3rrk1/2P4p/6p1/5p2/4p3/2R1P2P/5PP1/2R3K1 w - - 0 38", "c7c8q", -100);
+	CheckSeeValue("4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 1", "e5d6", 100);
+
+	// The king can only recapture on an undefended square
+	CheckSeeValue("8/8/4k3/3p4/8/8/3R4/K2R4 w - - 0 1", "d2d5", 100);
+	CheckSeeValue("8/8/4k3/3p4/8/8/3R4/K7 w - - 0 1", "d2d5", -400);
+
+	// Quiet move onto a square attacked by a pawn
+	CheckSeeValue("K7/8/2p5/8/8/4N3/8/7k w - - 0 1", "e3d5", -325);
+}
+
+// Fills the history table with pseudo-random scores, so that quiet moves need real sorting
+static void FillRandomHistory(SearchInfo &searchInfo)
+{
+	u32 seed = 12345;
+	for (int piece = 0; piece < 16; piece++)
+	{
+		for (Square square = 0; square < 64; square++)
+		{
+			seed = seed * 1103515245 + 12345;
+			searchInfo.History[piece][square] = (seed >> 16) & 0x7fff;
+		}
+	}
+}
+
+void CheckMoveSorting(const std::string &fen, const SearchInfo &searchInfo)
+{
+	Position position;
+	position.Initialize(fen);
+	ASSERT(!position.IsInCheck());
+
+	Move moves[256];
+	int moveCount = GenerateQuietMoves(position, moves);
+	moveCount += GenerateCaptureMoves(position, moves + moveCount);
+
+	// Every move has to come out of the sorter exactly once, with quiet moves in history order
+	bool seen[256] = { false };
+	int sortedCount = 0;
+	int lastHistory = 32767;
+	MoveSorter<256> sorter(position, searchInfo);
+	sorter.InitializeNormalMoves(0, 0, 0, true);
+	Move move;
+	while ((move = sorter.NextNormalMove()) != 0)
+	{
+		int found = -1;
+		for (int i = 0; i < moveCount; i++)
+		{
+			if (moves[i] == move) found = i;
+		}
+		ASSERT(found != -1);
+		ASSERT(!seen[found]);
+		seen[found] = true;
+		sortedCount++;
+
+		if (sorter.GetMoveGenerationState() == MoveGenerationState_QuietMoves)
+		{
+			const int history = searchInfo.History[position.Board[GetFrom(move)]][GetTo(move)];
+			ASSERT(history <= lastHistory);
+			lastHistory = history;
+		}
+	}
+	ASSERT(sortedCount == moveCount);
 }
 
 void MoveSortingTests()
 {
-	// TODO: test move sorting (might have to factor it a bit better)
+	SearchInfo searchInfo;
+	memset(&searchInfo, 0, sizeof(searchInfo));
+	FillRandomHistory(searchInfo);
+
+	CheckMoveSorting("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", searchInfo);
+	CheckMoveSorting("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1", searchInfo);
+	// The losing capture Qxd5 has to be returned after the quiet moves
+	CheckMoveSorting("k7/1p6/2p5/3p4/8/8/8/K2Q4 w - - 0 1", searchInfo);
+	CheckMoveSorting("r1bq1rk1/pp2ppbp/2np1np1/8/3NP3/2N1BP2/PPPQ2PP/R3KB1R b KQ - 0 1", searchInfo);
+
+	// Equal scores keep the generation order
+	memset(&searchInfo, 0, sizeof(searchInfo));
+	Position position;
+	position.Initialize("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+	Move quietMoves[256];
+	const int quietCount = GenerateQuietMoves(position, quietMoves);
+	MoveSorter<256> sorter(position, searchInfo);
+	sorter.InitializeNormalMoves(0, 0, 0, true);
+	for (int i = 0; i < quietCount; i++)
+	{
+		ASSERT(sorter.NextNormalMove() == quietMoves[i]);
+	}
+	ASSERT(sorter.NextNormalMove() == 0);
+}
+
+// Measures how long it takes to generate and order all the moves of each position, which is the cost paid at an all-node
+void BenchmarkMoveSorting(const std::string &filename, const int iterations)
+{
+	std::FILE* file = std::fopen(filename.c_str(), "rt");
+
+	SearchInfo &searchInfo = GetSearchInfo(0);
+	FillRandomHistory(searchInfo);
+
+	char line[500];
+	u64 nodeCount = 0, moveCount = 0;
+	const u64 startTime = GetCurrentMilliseconds();
+	while (std::fgets(line, 500, file) != NULL)
+	{
+		Position position;
+		position.Initialize(line);
+		if (position.IsInCheck())
+		{
+			continue;
+		}
+
+		for (int i = 0; i < iterations; i++)
+		{
+			MoveSorter<256> moves(position, searchInfo);
+			moves.InitializeNormalMoves(0, 0, 0, true);
+			while (moves.NextNormalMove() != 0)
+			{
+				moveCount++;
+			}
+			nodeCount++;
+		}
+	}
+	const u64 totalTime = GetCurrentMilliseconds() - startTime;
+
+	printf("Nodes: %lld\n", nodeCount);
+	printf("Moves: %lld\n", moveCount);
+	printf("Sorter size: %d bytes\n", (int)sizeof(MoveSorter<256>));
+	printf("ns/node: %.1lf\n", (totalTime * 1000000.0) / max(1ULL, nodeCount));
+
+	fclose(file);
+}
+
+// Compares the magic lookups with the Kogge-Stone kernels, on the sliders of each position the way EvalPieces uses them
+void BenchmarkSliderAttacks(const std::string &filename, const int iterations)
+{
+	std::FILE* file = std::fopen(filename.c_str(), "rt");
+	if (file == NULL)
+	{
+		printf("Unable to open %s\n", filename.c_str());
+		return;
+	}
+
+	std::vector<Position> positions;
+	char line[500];
+	while (std::fgets(line, 500, file) != NULL)
+	{
+		positions.push_back(Position());
+		positions.back().Initialize(line);
+	}
+	fclose(file);
+
+	u64 sliderCount = 0;
+	Bitboard magicSum = 0, kernelSum = 0;
+
+	u64 startTime = GetCurrentMilliseconds();
+	for (int i = 0; i < iterations; i++)
+	{
+		for (size_t p = 0; p < positions.size(); p++)
+		{
+			const Position &position = positions[p];
+			const Bitboard allPieces = position.GetAllPieces();
+
+			Bitboard b = position.Pieces[BISHOP] | position.Pieces[QUEEN];
+			while (b)
+			{
+				magicSum += CountBitsSet(GetBishopAttacks(PopFirstBit(b), allPieces));
+				sliderCount++;
+			}
+
+			b = position.Pieces[ROOK] | position.Pieces[QUEEN];
+			while (b)
+			{
+				magicSum += CountBitsSet(GetRookAttacks(PopFirstBit(b), allPieces));
+				sliderCount++;
+			}
+		}
+	}
+	const u64 magicTime = GetCurrentMilliseconds() - startTime;
+
+	startTime = GetCurrentMilliseconds();
+	for (int i = 0; i < iterations; i++)
+	{
+		for (size_t p = 0; p < positions.size(); p++)
+		{
+			const Position &position = positions[p];
+			const Bitboard allPieces = position.GetAllPieces();
+
+			for (int slider = 0; slider < 2; slider++)
+			{
+				Square squares[4];
+				Bitboard attacks[4];
+				int count = 0;
+
+				Bitboard b = position.Pieces[slider == 0 ? BISHOP : ROOK] | position.Pieces[QUEEN];
+				while (b)
+				{
+					squares[count++] = PopFirstBit(b);
+					if (count == 4 || b == 0)
+					{
+						if (slider == 0)
+						{
+							GetBishopAttacksX4(squares, count, allPieces, attacks);
+						}
+						else
+						{
+							GetRookAttacksX4(squares, count, allPieces, attacks);
+						}
+
+						for (int j = 0; j < count; j++)
+						{
+							kernelSum += CountBitsSet(attacks[j]);
+						}
+						count = 0;
+					}
+				}
+			}
+		}
+	}
+	const u64 kernelTime = GetCurrentMilliseconds() - startTime;
+
+	ASSERT(magicSum == kernelSum);
+
+#ifdef USE_AVX2
+	printf("Kernel: AVX2\n");
+#else
+	printf("Kernel: scalar\n");
+#endif
+	printf("Sliders: %lld\n", sliderCount);
+	printf("Magic ns/slider: %.2lf\n", (magicTime * 1000000.0) / max(1ULL, sliderCount));
+	printf("Kogge-Stone ns/slider: %.2lf\n", (kernelTime * 1000000.0) / max(1ULL, sliderCount));
+}
+
+// Evaluations per second of the hand-crafted evaluation and the network, over the positions of an EPD file and their children
+void BenchmarkNnue(const std::string &filename, const std::string &netFilename, const int iterations)
+{
+	if (!LoadNnue(netFilename))
+	{
+		printf("Unable to load %s\n", netFilename.c_str());
+		return;
+	}
+
+	std::FILE* file = std::fopen(filename.c_str(), "rt");
+
+	std::vector<Position> positions;
+	char line[500];
+	while (std::fgets(line, 500, file) != NULL)
+	{
+		Position position;
+		position.Initialize(line);
+		positions.push_back(position);
+
+		Move moves[256];
+		const int moveCount = GenerateLegalMoves(position, moves);
+		for (int i = 0; i < moveCount; i++)
+		{
+			MoveUndo moveUndo;
+			position.MakeMove(moves[i], moveUndo);
+			positions.push_back(position);
+			position.UnmakeMove(moves[i], moveUndo);
+		}
+	}
+	fclose(file);
+
+	const u64 evalCount = u64(iterations) * positions.size();
+	s64 checksum = 0;
+
+	u64 startTime = GetCurrentMilliseconds();
+	for (int i = 0; i < iterations; i++)
+	{
+		for (size_t p = 0; p < positions.size(); p++)
+		{
+			checksum += NnueEvaluate(positions[p]);
+		}
+	}
+	const u64 nnueTime = GetCurrentMilliseconds() - startTime;
+
+	const NnueWeights *network = NnueNetwork;
+	SetNnueNetwork(0);
+
+	startTime = GetCurrentMilliseconds();
+	for (int i = 0; i < iterations; i++)
+	{
+		for (size_t p = 0; p < positions.size(); p++)
+		{
+			// Change the hash every time, so that we measure the evaluation rather than the eval cache
+			positions[p].Hash += 0x9E3779B97F4A7C15ULL;
+
+			EvalInfo evalInfo;
+			checksum += Evaluate(positions[p], evalInfo);
+		}
+	}
+	const u64 handCraftedTime = GetCurrentMilliseconds() - startTime;
+
+	SetNnueNetwork(network);
+
+	printf("Positions: %d (checksum %lld)\n", int(positions.size()), checksum);
+	printf("Hand-crafted evals/s: %.0lf\n", evalCount / (max(1ULL, handCraftedTime) / 1000.0));
+	printf("Network evals/s: %.0lf\n", evalCount / (max(1ULL, nnueTime) / 1000.0));
 }
 
 // Only to be used by tests
@@ -220,21 +583,24 @@ void HashTests()
 	move[3] = MakeMoveFromUciStringUnsafe("f6g8");
 
 	ASSERT(HashTable != 0);
-	ASSERT(HashMask == (0x3ff & ~3));
+	ASSERT(HashMask == 0xff);
+	ASSERT((u64(HashTable) & 63) == 0);
 
 	const Move testMove = GenerateMove(1, 1);
 	const int testDepth = 5;
 	const int testScore = 500;
 	const int testFlags = HashFlagsBeta;
+	const int testEval = -50;
 	for (int i = 0; i < 4; i++)
 	{
-		StoreHash(position.Hash, testScore + i, testMove + i, testDepth + i, (testFlags + i) & HashFlagsMask);
+		StoreHash(position.Hash, testScore + i, testEval + i, testMove + i, testDepth + i, (testFlags + i) & HashFlagsMask);
 
 		HashEntry *result;
 		bool foundHash = ProbeHash(position.Hash, result);
 		ASSERT(foundHash);
 		ASSERT(result->Score == testScore + i);
 		ASSERT(result->Move == testMove + i);
+		ASSERT(result->Eval == testEval + i);
 		ASSERT(result->Depth == (testDepth + i) / OnePly);
 		ASSERT(result->GetHashFlags() == ((testFlags + i) & HashFlagsMask));
 		ASSERT(result->GetHashDate() == HashDate);
@@ -251,15 +617,668 @@ void HashTests()
 		ASSERT(foundHash);
 		ASSERT(result->Score == testScore + i);
 		ASSERT(result->Move == testMove + i);
+		ASSERT(result->Eval == testEval + i);
 		ASSERT(result->Depth == (testDepth + i) / OnePly);
 		ASSERT(result->GetHashFlags() == ((testFlags + i) & HashFlagsMask));
 		ASSERT(result->GetHashDate() == HashDate);
 	}
 
+	// Deeper stores without a static evaluation keep the one we had
+	StoreHash(position.Hash, testScore, MaxEval, testMove, testDepth + OnePly, testFlags);
+	HashEntry *result;
+	ASSERT(ProbeHash(position.Hash, result));
+	ASSERT(result->Eval == testEval);
+	ASSERT(result->Depth == (testDepth + OnePly) / OnePly);
+
+	// Shallower stores fill in a missing static evaluation
+	move[4] = MakeMoveFromUciStringUnsafe("e2e4");
+	position.MakeMove(move[4], moveUndo[4]);
+	StoreHash(position.Hash, testScore, MaxEval, testMove, testDepth + OnePly * 2, testFlags);
+	StoreHash(position.Hash, testScore, testEval, testMove, 0, testFlags);
+	ASSERT(ProbeHash(position.Hash, result));
+	ASSERT(result->Eval == testEval);
+	ASSERT(result->Depth == (testDepth + OnePly * 2) / OnePly);
+	position.UnmakeMove(move[4], moveUndo[4]);
+
 	// TODO: test hash aging
 	// TODO: test hash depth collisions
 }
 
+void CheckMaterial(const Position &position)
+{
+	Position other;
+	other.Initialize(position.GetFen());
+
+	ASSERT(position.MaterialHash == other.MaterialHash);
+	for (Color color = WHITE; color <= BLACK; color++)
+	{
+		ASSERT(position.GamePhase[color] == other.GamePhase[color]);
+		for (PieceType piece = PAWN; piece <= KING; piece++)
+		{
+			ASSERT(position.PieceCount[color][piece] == other.PieceCount[color][piece]);
+			ASSERT(position.PieceCount[color][piece] == CountBitsSet(position.Pieces[piece] & position.Colors[color]));
+		}
+	}
+}
+
+void CheckMaterialAfterMoves(const std::string &fen)
+{
+	Position position;
+	position.Initialize(fen);
+	CheckMaterial(position);
+
+	const u64 materialHash = position.MaterialHash;
+
+	Move moves[256];
+	const int moveCount = GenerateLegalMoves(position, moves);
+	for (int i = 0; i < moveCount; i++)
+	{
+		MoveUndo moveUndo;
+		position.MakeMove(moves[i], moveUndo);
+		CheckMaterial(position);
+
+		// Quiet moves must not change the material signature
+		if (moveUndo.Captured == PIECE_NONE && GetMoveType(moves[i]) != MoveTypePromotion && GetMoveType(moves[i]) != MoveTypeEnPassent)
+		{
+			ASSERT(position.MaterialHash == materialHash);
+		}
+
+		position.UnmakeMove(moves[i], moveUndo);
+		ASSERT(position.MaterialHash == materialHash);
+	}
+	CheckMaterial(position);
+}
+
+void MaterialTests()
+{
+	Position position;
+	position.Initialize("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+	ASSERT(position.GamePhase[WHITE] == position.GamePhase[BLACK]);
+	ASSERT(position.PieceCount[WHITE][PAWN] == 8 && position.PieceCount[BLACK][KNIGHT] == 2);
+
+	// Same material, different placement
+	Position other;
+	other.Initialize("4k3/8/8/2n5/8/8/3P4/4K3 w - - 0 1");
+	position.Initialize("1n2k3/8/8/8/8/P7/8/7K b - - 0 1");
+	ASSERT(position.MaterialHash == other.MaterialHash);
+	other.Initialize("1b2k3/8/8/8/8/P7/8/7K b - - 0 1");
+	ASSERT(position.MaterialHash != other.MaterialHash);
+
+	CheckMaterialAfterMoves("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+	CheckMaterialAfterMoves("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+	// Promotions and under-promotions with captures
+	CheckMaterialAfterMoves("n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1");
+	CheckMaterialAfterMoves("n1n5/PPPk4/8/8/8/8/4Kppp/5N1N w - - 0 1");
+	// En-passent
+	CheckMaterialAfterMoves("rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3");
+
+	// Material signatures that can't be won evaluate as dead draws
+	EvalInfo evalInfo;
+	position.Initialize("8/8/4k3/8/8/3NK3/8/8 w - - 0 1");
+	ASSERT(Evaluate(position, evalInfo) == 0);
+	position.Initialize("8/8/4kb2/8/8/3BK3/8/8 b - - 0 1");
+	ASSERT(Evaluate(position, evalInfo) == 0);
+	position.Initialize("8/8/4k3/8/8/2NNK3/8/8 w - - 0 1");
+	ASSERT(Evaluate(position, evalInfo) == 0);
+	ASSERT(IsDeadDraw(position));
+	position.Initialize("8/8/4k3/8/8/3NK3/8/8 w - - 0 1");
+	ASSERT(IsDeadDraw(position));
+	position.Initialize("8/8/4k3/8/8/3RK3/8/8 w - - 0 1");
+	ASSERT(!IsDeadDraw(position));
+
+	// Known wins use the mating evaluations, for either color
+	position.Initialize("8/8/4k3/8/8/3RK3/8/8 w - - 0 1");
+	const int rookCenter = Evaluate(position, evalInfo);
+	ASSERT(rookCenter > 1000);
+	other.Initialize("4k3/8/4K3/8/8/3R4/8/8 w - - 0 1");
+	ASSERT(Evaluate(other, evalInfo) > rookCenter);
+	other.Initialize("8/8/3rk3/8/8/4K3/8/8 w - - 0 1");
+	ASSERT(Evaluate(other, evalInfo) < -1000);
+	position.Initialize("8/8/4k3/8/8/3QK3/8/8 b - - 0 1");
+	ASSERT(Evaluate(position, evalInfo) < -1000);
+
+	// KBNK prefers the corners of the bishop's color (a1/h8 for a dark squared bishop)
+	position.Initialize("7k/8/5K2/8/8/8/8/3BN3 w - - 0 1");
+	other.Initialize("k7/8/2K5/8/8/8/8/3BN3 w - - 0 1");
+	ASSERT(Evaluate(other, evalInfo) > 1000);
+	ASSERT(Evaluate(position, evalInfo) < Evaluate(other, evalInfo));
+
+	// Opposite colored bishops are scaled down compared to same colored ones
+	position.Initialize("8/5k2/5b2/8/3P4/2P5/3BK3/8 w - - 0 1");
+	other.Initialize("8/5k2/4b3/8/3P4/2P5/3BK3/8 w - - 0 1");
+	const int sameColor = Evaluate(position, evalInfo);
+	const int oppositeColor = Evaluate(other, evalInfo);
+	ASSERT(oppositeColor > 0 && oppositeColor < sameColor / 2);
+}
+
+void BitbaseTests()
+{
+	// The embedded table has to match a fresh retrograde solve
+	std::vector<u32> bitbase(KpkBitbaseSize);
+	GenerateKpkBitbase(&bitbase[0]);
+	ASSERT(memcmp(&bitbase[0], KpkBitbase, KpkBitbaseSize * sizeof(u32)) == 0);
+
+	// Black king in front of the rook pawn, or too far away
+	Position position;
+	position.Initialize("k7/8/8/8/8/8/P7/7K w - - 0 1");
+	ASSERT(!ProbeKpk(position));
+	position.Initialize("7k/8/8/8/8/8/P7/K7 w - - 0 1");
+	ASSERT(ProbeKpk(position));
+
+	// Opposition decides, for either color and on either wing
+	position.Initialize("8/4k3/8/4K3/4P3/8/8/8 w - - 0 1");
+	ASSERT(!ProbeKpk(position));
+	position.Initialize("8/4k3/8/4K3/4P3/8/8/8 b - - 0 1");
+	ASSERT(ProbeKpk(position));
+	position.Initialize("8/8/8/3p4/3k4/8/3K4/8 b - - 0 1");
+	ASSERT(!ProbeKpk(position));
+	position.Initialize("8/8/8/3p4/3k4/8/3K4/8 w - - 0 1");
+	ASSERT(ProbeKpk(position));
+
+	// Drawn positions are dead draws, won ones score as wins
+	EvalInfo evalInfo;
+	position.Initialize("8/4k3/8/4K3/4P3/8/8/8 w - - 0 1");
+	ASSERT(IsDeadDraw(position) && Evaluate(position, evalInfo) == 0);
+	position.Initialize("8/4k3/8/4K3/4P3/8/8/8 b - - 0 1");
+	ASSERT(!IsDeadDraw(position) && Evaluate(position, evalInfo) < -500);
+	position.Initialize("8/8/8/3p4/3k4/8/3K4/8 w - - 0 1");
+	ASSERT(!IsDeadDraw(position) && Evaluate(position, evalInfo) < -500);
+}
+
+void TablebaseTests()
+{
+	// Generated in memory, KPK needs the KQK, KRK, KBK and KNK tables as well
+	const bool tooManyPieces = GenerateTablebase("KPPPPK", "", 1);
+	ASSERT(!tooManyPieces);
+	const bool generated = GenerateTablebase("KPK", "", 1);
+	ASSERT(generated);
+
+	// Has to agree with the bitbase everywhere (the pawn side is white, with the pawn on files a-d)
+	Position position;
+	int wdl, pliesToMate;
+	for (int i = 0; i < 64 * 64 * 2 * 24; i++)
+	{
+		const Square whiteKing = i & 63, blackKing = (i >> 6) & 63;
+		const Color toMove = Color((i >> 12) & 1);
+		const Square pawn = MakeSquare(RANK_7 + (i >> 13) / 4, (i >> 13) % 4);
+		if (whiteKing == blackKing || whiteKing == pawn || blackKing == pawn ||
+			(GetKingAttacks(whiteKing) & (u64(1) << blackKing)) ||
+			(toMove == WHITE && (GetPawnAttacks(pawn, WHITE) & (u64(1) << blackKing))))
+		{
+			continue;
+		}
+
+		Piece board[64];
+		memset(board, 0, sizeof(board));
+		board[whiteKing] = MakePiece(WHITE, KING);
+		board[blackKing] = MakePiece(BLACK, KING);
+		board[pawn] = MakePiece(WHITE, PAWN);
+		position.Initialize(board, toMove);
+
+		ASSERT(ProbeTablebase(position, wdl, pliesToMate));
+		ASSERT((wdl != 0) == ProbeKpk(whiteKing, pawn, blackKing, toMove));
+		ASSERT(wdl == 0 || wdl == (toMove == WHITE ? 1 : -1));
+	}
+
+	// Mate in one, checkmate and stalemate, for either color
+	position.Initialize("k7/8/1K6/8/8/8/8/6Q1 w - - 0 1");
+	ASSERT(ProbeTablebase(position, wdl, pliesToMate) && wdl == 1 && pliesToMate == 1);
+	position.Initialize("k7/1Q6/1K6/8/8/8/8/8 b - - 0 1");
+	ASSERT(ProbeTablebase(position, wdl, pliesToMate) && wdl == -1 && pliesToMate == 0);
+	position.Initialize("k7/2Q5/1K6/8/8/8/8/8 b - - 0 1");
+	ASSERT(ProbeTablebase(position, wdl, pliesToMate) && wdl == 0);
+	position.Initialize("6q1/8/8/8/8/1k6/8/K7 b - - 0 1");
+	ASSERT(ProbeTablebase(position, wdl, pliesToMate) && wdl == 1 && pliesToMate == 1);
+
+	// The search plays the shortest mate
+	position.Initialize("8/8/8/4k3/8/8/8/4K2R w - - 0 1");
+	int score;
+	IterativeDeepening(position, 3, score, 0, false);
+	ASSERT(score > TablebaseWinScore - 64 && GetSearchInfo(0).TbHits > 0);
+
+	UnloadTablebases();
+	position.Initialize("k7/8/1K6/8/8/8/8/6Q1 w - - 0 1");
+	ASSERT(!ProbeTablebase(position, wdl, pliesToMate));
+}
+
+void BookTests()
+{
+	// The published Polyglot keys
+	Position position, other;
+	position.Initialize("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+	ASSERT(GetBookKey(position) == 0x463b96181691fc9cULL);
+	position.Initialize("rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1");
+	ASSERT(GetBookKey(position) == 0x823c9b50fd114196ULL);
+	position.Initialize("rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3");
+	ASSERT(GetBookKey(position) == 0x22a48b5a8e47ff78ULL);
+	position.Initialize("rnbq1bnr/ppp1pkpp/8/3pPp2/8/8/PPPPKPPP/RNBQ1BNR w - - 0 4");
+	ASSERT(GetBookKey(position) == 0x00fdd303c946bdd9ULL);
+	position.Initialize("rnbqkbnr/p1pppppp/8/8/P6P/R1p5/1P1PPPP1/1NBQKBNR b Kkq - 0 4");
+	ASSERT(GetBookKey(position) == 0x5c3f9b829b279560ULL);
+
+	// Transpositions share a key, the en passant square only counts when it can be taken
+	position.Initialize("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+	const u64 startKey = GetBookKey(position);
+	const char *moves[] = { "g1f3", "g8f6", "f3g1", "f6g8" };
+	for (int i = 0; i < 4; i++)
+	{
+		MoveUndo moveUndo;
+		position.MakeMove(MakeMoveFromUciString(position, moves[i]), moveUndo);
+	}
+	ASSERT(GetBookKey(position) == startKey);
+
+	position.Initialize("rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1");
+	other.Initialize("rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq - 0 1");
+	ASSERT(GetBookKey(position) == GetBookKey(other));
+	position.Initialize("rnbqkbnr/ppp1pppp/8/8/3pP3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1");
+	other.Initialize("rnbqkbnr/ppp1pppp/8/8/3pP3/8/PPPP1PPP/RNBQKBNR b KQkq - 0 1");
+	ASSERT(GetBookKey(position) != GetBookKey(other));
+	other.Initialize("rnbqkbnr/ppp1pppp/8/8/3pP3/8/PPPP1PPP/RNBQKBNR b Kkq - 0 1");
+	ASSERT(GetBookKey(other) != GetBookKey(position));
+
+	// Castling is the king taking its rook, promotions count from the knight
+	position.Initialize("r3k2r/1P6/8/8/8/8/8/R3K2R w KQkq - 0 1");
+	ASSERT(GetBookMove(MakeMoveFromUciString(position, "e1g1")) == ((FILE_E << 6) | FILE_H));
+	ASSERT(GetBookMove(MakeMoveFromUciString(position, "e1c1")) == ((FILE_E << 6) | FILE_A));
+	ASSERT(GetBookMove(MakeMoveFromUciString(position, "b7a8q")) == ((4 << 12) | (6 << 9) | (FILE_B << 6) | (7 << 3) | FILE_A));
+	ASSERT(GetBookMove(MakeMoveFromUciString(position, "b7b8n")) == ((1 << 12) | (6 << 9) | (FILE_B << 6) | (7 << 3) | FILE_B));
+
+	// Write a small book and read it back
+	position.Initialize("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+	std::vector<BookEntry> entries;
+	const char *bookMoves[] = { "d2d4", "e2e4", "g1f3", "e2e4" };
+	const int bookWeights[] = { 2, 3, 1, 4 };
+	for (int i = 0; i < 4; i++)
+	{
+		BookEntry entry = { startKey, GetBookMove(MakeMoveFromUciString(position, bookMoves[i])), u16(bookWeights[i]), 0 };
+		entries.push_back(entry);
+	}
+	// Illegal here, as if another position had the same key
+	BookEntry collision = { startKey, u16((FILE_E << 6) | (3 << 3) | FILE_E), 50, 0 };
+	entries.push_back(collision);
+	other.Initialize("rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1");
+	BookEntry reply = { GetBookKey(other), GetBookMove(MakeMoveFromUciString(other, "c7c5")), 1, 0 };
+	entries.push_back(reply);
+
+	const std::string filename = "booktest.bin";
+	const bool written = WriteBook(filename, entries);
+	ASSERT(written && entries.size() == 5);
+	const bool loaded = LoadBook(filename);
+	ASSERT(loaded);
+
+	Move found[BookMaxMoves];
+	int weights[BookMaxMoves];
+	const int foundCount = GetBookMoves(position, found, weights);
+	ASSERT(foundCount == 3);
+	ASSERT(GetMoveUci(found[0]) == "e2e4" && weights[0] == 7);
+	ASSERT(GetMoveUci(found[1]) == "d2d4" && weights[1] == 2);
+	ASSERT(GetMoveUci(found[2]) == "g1f3" && weights[2] == 1);
+
+	int e4Count = 0;
+	for (int i = 0; i < 1000; i++)
+	{
+		const Move move = ProbeBook(position);
+		ASSERT(move == found[0] || move == found[1] || move == found[2]);
+		if (move == found[0]) e4Count++;
+	}
+	ASSERT(e4Count > 600 && e4Count < 800);
+
+	ASSERT(GetMoveUci(ProbeBook(other)) == "c7c5");
+	other.Initialize("rnbqkbnr/pppppppp/8/8/3P4/8/PPP1PPPP/RNBQKBNR b KQkq d3 0 1");
+	ASSERT(ProbeBook(other) == 0);
+
+	UnloadBook();
+	ASSERT(ProbeBook(position) == 0);
+	std::remove(filename.c_str());
+}
+
+void PgnTests()
+{
+	// SAN reads back every legal move GetMoveSAN writes
+	const char *fens[] =
+	{
+		"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+		"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+		"n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1",
+		"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+		"4k3/8/8/2pP4/8/8/8/R3K2R w KQ c6 0 1",
+		"2N1N3/8/8/8/2N1N3/8/8/k3K3 w - - 0 1",
+	};
+	for (int i = 0; i < 6; i++)
+	{
+		Position position;
+		position.Initialize(fens[i]);
+
+		Move moves[256];
+		const int moveCount = GenerateLegalMoves(position, moves);
+		for (int j = 0; j < moveCount; j++)
+		{
+			ASSERT(MakeMoveFromSanString(position, GetMoveSAN(position, moves[j])) == moves[j]);
+		}
+	}
+
+	Position position;
+	position.Initialize("4k3/1P6/8/2pP4/8/8/8/R3K2R w KQ c6 0 1");
+	ASSERT(GetMoveUci(MakeMoveFromSanString(position, "0-0")) == "e1g1");
+	ASSERT(GetMoveUci(MakeMoveFromSanString(position, "O-O-O+")) == "e1c1");
+	ASSERT(GetMoveUci(MakeMoveFromSanString(position, "b8Q")) == "b7b8q");
+	ASSERT(GetMoveUci(MakeMoveFromSanString(position, "b8=N")) == "b7b8n");
+	ASSERT(GetMoveUci(MakeMoveFromSanString(position, "dxc6!?")) == "d5c6");
+	ASSERT(MakeMoveFromSanString(position, "b8") == 0);
+	ASSERT(MakeMoveFromSanString(position, "Nf3") == 0);
+	position.Initialize("2N1N3/8/8/8/2N1N3/8/8/k3K3 w - - 0 1");
+	ASSERT(MakeMoveFromSanString(position, "Nd6") == 0);
+	ASSERT(MakeMoveFromSanString(position, "Ned6") == 0);
+	ASSERT(GetMoveUci(MakeMoveFromSanString(position, "Ne8d6")) == "e8d6");
+	ASSERT(MakeMoveFromSanString(position, "N4d6") == 0);
+
+	// Comments, variations, NAGs and move numbers are skipped
+	const std::string pgn =
+		"[Event \"Test\"]\n"
+		"[Result \"1-0\"]\n"
+		"\n"
+		"1. e4 {best by test} e5 2.Nf3 (2. f4 exf4 (2...d5) 3. Nf3) 2...Nc6 $1 3. Bb5 ; Spanish\n"
+		"3... a6 4. Ba4 Nf6 5. O-O 1-0\n"
+		"\n"
+		"[Event \"Setup\"]\n"
+		"[SetUp \"1\"]\n"
+		"[FEN \"4k3/8/8/8/8/8/4P3/4K3 w - - 0 1\"]\n"
+		"\n"
+		"1. e4 Kd7 2. Kd2 *\n"
+		"[Event \"No result, bad move\"]\n"
+		"1. d4 d5 2. Qxd5 Qxd5 1/2-1/2\n"
+		"1. c4 0-1\n";
+
+	const char *text = pgn.c_str(), *end = text + pgn.size();
+	PgnGame game;
+	bool read = ReadPgnGame(text, end, game);
+	ASSERT(read && game.StartFen.empty() && game.Result == PgnResultWhiteWin && !game.Error && game.Moves.size() == 9);
+	position.Initialize("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+	for (int i = 0; i < (int)game.Moves.size(); i++)
+	{
+		MoveUndo moveUndo;
+		position.MakeMove(game.Moves[i], moveUndo);
+	}
+	ASSERT(position.GetFen().find("r1bqkb1r/1ppp1ppp/p1n2n2/4p3/B3P3/5N2/PPPP1PPP/RNBQ1RK1 b kq - ") == 0);
+
+	read = ReadPgnGame(text, end, game);
+	ASSERT(read && game.StartFen == "4k3/8/8/8/8/8/4P3/4K3 w - - 0 1" && game.Result == PgnResultUnknown && game.Moves.size() == 3);
+
+	read = ReadPgnGame(text, end, game);
+	ASSERT(read && game.Result == PgnResultDraw && game.Error && game.Moves.size() == 2);
+
+	read = ReadPgnGame(text, end, game);
+	ASSERT(read && game.Result == PgnResultBlackWin && game.Moves.size() == 1);
+	read = ReadPgnGame(text, end, game);
+	ASSERT(!read);
+
+	// Books keep the winning side's moves
+	const std::string pgnFilename = "pgntest.pgn", bookFilename = "pgntest.bin";
+	FILE *file = fopen(pgnFilename.c_str(), "wt");
+	fputs(pgn.c_str(), file);
+	fclose(file);
+	const bool converted = ConvertPgn(pgnFilename, bookFilename, "book", 2);
+	ASSERT(converted);
+	const bool loaded = LoadBook(bookFilename);
+	ASSERT(loaded);
+
+	Move moves[BookMaxMoves];
+	int weights[BookMaxMoves];
+	position.Initialize("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+	int bookMoveCount = GetBookMoves(position, moves, weights);
+	ASSERT(bookMoveCount == 2);
+	ASSERT(GetMoveUci(moves[0]) == "e2e4" && weights[0] == 2 && GetMoveUci(moves[1]) == "d2d4" && weights[1] == 1);
+	position.Initialize("rnbqkbnr/pppppppp/8/8/2P5/8/PP1PPPPP/RNBQKBNR b KQkq c3 0 1");
+	bookMoveCount = GetBookMoves(position, moves, weights);
+	ASSERT(bookMoveCount == 0);
+
+	UnloadBook();
+	const bool convertedCsv = ConvertPgn(pgnFilename, bookFilename, "csv", 1);
+	ASSERT(!convertedCsv);
+	std::remove(pgnFilename.c_str());
+	std::remove(bookFilename.c_str());
+}
+
+void PackedTests()
+{
+	ASSERT(sizeof(PackedPosition) == 32);
+
+	// Everything in a FEN survives packing
+	const char *fens[] =
+	{
+		"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+		"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R b Kq - 3 1",
+		"4k3/8/8/2pP4/8/8/8/R3K2R w K c6 0 1",
+		"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 49 1",
+		"k7/8/8/8/8/8/8/7K b - - 0 1",
+	};
+
+	std::vector<PackedPosition> packed(5);
+	for (int i = 0; i < 5; i++)
+	{
+		Position position, unpacked;
+		position.Initialize(fens[i]);
+		const bool packedOk = PackPosition(position, packed[i]);
+		ASSERT(packedOk);
+		packed[i].Score = s16(-100 * i);
+		UnpackPosition(packed[i], unpacked);
+		ASSERT(unpacked.GetFen() == position.GetFen());
+		ASSERT(unpacked.Hash == position.Hash && unpacked.PawnHash == position.PawnHash && unpacked.MaterialHash == position.MaterialHash);
+	}
+
+	const std::string filename = "packedtest.packed";
+	ASSERT(IsPackedFilename(filename) && !IsPackedFilename("packedtest.epd"));
+	FILE *file = OpenPackedPositions(filename, false);
+	ASSERT(file != NULL);
+	bool written = WritePackedPositions(file, &packed[0], 3);
+	ASSERT(written);
+	fclose(file);
+	file = OpenPackedPositions(filename, true);
+	ASSERT(file != NULL);
+	written = WritePackedPositions(file, &packed[3], 2);
+	ASSERT(written);
+	fclose(file);
+
+	u64 count;
+	const PackedPosition *positions = MapPackedPositions(filename, count);
+	ASSERT(positions != 0 && count == 5);
+	for (int i = 0; i < 5; i++)
+	{
+		Position position;
+		UnpackPosition(positions[i], position);
+		ASSERT(position.GetFen() == fens[i] && positions[i].Score == -100 * i);
+	}
+	UnmapPackedPositions(positions, count);
+
+	// Games convert with their moves and results
+	const std::string pgnFilename = "packedtest.pgn";
+	file = fopen(pgnFilename.c_str(), "wt");
+	fputs("[Result \"0-1\"]\n\n1. f3 e5 2. g4 Qh4# 0-1\n", file);
+	fclose(file);
+	const bool converted = ConvertPgn(pgnFilename, filename, "packed", 1);
+	ASSERT(converted);
+
+	positions = MapPackedPositions(filename, count);
+	ASSERT(positions != 0 && count == 4);
+	for (int i = 0; i < 4; i++)
+	{
+		ASSERT(positions[i].Result == PackedResultBlackWin);
+	}
+	Position position;
+	UnpackPosition(positions[3], position);
+	ASSERT(GetMoveSAN(position, positions[3].BestMove) == "Qh4#");
+	UnmapPackedPositions(positions, count);
+
+	std::remove(pgnFilename.c_str());
+	std::remove(filename.c_str());
+}
+
+void SelfPlayTests()
+{
+	const std::string filename = "selfplaytest.packed";
+	std::remove(filename.c_str());
+	const bool generated = GenerateSelfPlay(filename, 100, 2, ~0ULL, 2);
+	ASSERT(generated);
+
+	u64 count;
+	const PackedPosition *positions = MapPackedPositions(filename, count);
+	ASSERT(positions != 0 && count >= 100);
+	for (u64 i = 0; i < count; i++)
+	{
+		ASSERT(positions[i].Result != PackedResultUnknown);
+		ASSERT(abs(positions[i].Score) < SelfPlayWinScore || positions[i].Result != PackedResultDraw);
+
+		// The best move is legal where it was played
+		Position position;
+		UnpackPosition(positions[i], position);
+		ASSERT(IsMovePseudoLegal(position, positions[i].BestMove));
+		MoveUndo moveUndo;
+		position.MakeMove(positions[i].BestMove, moveUndo);
+		ASSERT(!position.CanCaptureKing());
+	}
+	UnmapPackedPositions(positions, count);
+
+	std::remove(filename.c_str());
+}
+
+void BatchTests()
+{
+	const char *fens[] =
+	{
+		"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+		"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+		"4k3/8/8/3q4/8/8/3R4/4K3 w - - 0 1",
+		"4k3/8/8/8/8/8/4r3/4K3 w - - 0 1",
+		"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 b - - 0 1",
+	};
+
+	// Enough positions for several chunks
+	const int count = 5000;
+	std::vector<Position> positions(count);
+	std::vector<PackedPosition> packed(count);
+	for (int i = 0; i < count; i++)
+	{
+		positions[i].Initialize(fens[i % 5]);
+		PackPosition(positions[i], packed[i]);
+	}
+
+	std::vector<int> evals(count), qsearchScores(count), packedEvals(count);
+	EvaluateBatch(&positions[0], count, &evals[0], &qsearchScores[0], 2);
+	EvaluateBatch(&packed[0], count, &packedEvals[0], 0, 3);
+	for (int i = 0; i < count; i++)
+	{
+		EvalInfo evalInfo;
+		ASSERT(evals[i] == Evaluate(positions[i], evalInfo) && packedEvals[i] == evals[i]);
+		ASSERT(positions[i].GetFen() == fens[i % 5]);
+	}
+
+	// Winning the queen, and getting out of check by taking the rook
+	ASSERT(qsearchScores[2] > evals[2] + 500);
+	ASSERT(qsearchScores[3] > evals[3] + 300);
+
+	const std::string filename = "batchtest.packed", outputFilename = "batchtest2.packed";
+	FILE *file = OpenPackedPositions(filename, false);
+	WritePackedPositions(file, &packed[0], count);
+	fclose(file);
+	const bool evaluated = EvaluatePackedFile(filename, outputFilename, false, 2);
+	ASSERT(evaluated);
+
+	u64 outputCount;
+	const PackedPosition *output = MapPackedPositions(outputFilename, outputCount);
+	ASSERT(output != 0 && outputCount == count);
+	for (int i = 0; i < count; i++)
+	{
+		ASSERT(output[i].Score == evals[i] && output[i].Occupied == packed[i].Occupied);
+	}
+	UnmapPackedPositions(output, outputCount);
+
+	std::remove(filename.c_str());
+	std::remove(outputFilename.c_str());
+}
+
+void FeatureTests()
+{
+#ifdef EVAL_TUNING
+	const char *fens[] =
+	{
+		"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+		"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+		"2r3k1/1Q1R1pp1/7p/4p1b1/4p1P1/2r1q3/1PK4P/3R4 w - - 14 37",
+		"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 b - - 0 1",
+		"8/5k2/4b3/3P4/2P5/8/3BK3/8 w - - 0 1",
+		"6k1/8/8/8/8/8/1P4K1/8 w - - 0 1",
+	};
+	const int fenCount = sizeof(fens) / sizeof(fens[0]);
+
+	std::vector<u16> features(GetEvalFeatureCount());
+	std::vector<float> counts(GetEvalFeatureCount());
+	std::vector<PackedPosition> packed(fenCount);
+	std::vector<int> evals(fenCount), featureCounts(fenCount);
+	for (int i = 0; i < fenCount; i++)
+	{
+		Position position;
+		position.Initialize(fens[i]);
+		PackPosition(position, packed[i]);
+
+		EvalInfo evalInfo;
+		const int eval = Evaluate(position, evalInfo);
+
+		featureCounts[i] = GetEvalFeatures(position, &features[0], &counts[0], evals[i]);
+		ASSERT(evals[i] == (position.ToMove == WHITE ? eval : -eval));
+
+		// King and pawn against king is scored by the bitbase
+		ASSERT((featureCounts[i] == -1) == (i == 5));
+		if (featureCounts[i] == -1)
+		{
+			continue;
+		}
+
+		// The evaluation is the dot product of the counts and the values, up to the rounding
+		double dot = 0;
+		for (int j = 0; j < featureCounts[i]; j++)
+		{
+			dot += counts[j] * GetEvalFeatureValue(features[j]);
+		}
+		ASSERT(fabs(dot - evals[i]) < 3);
+	}
+
+	const std::string filename = "featuretest.packed", outputFilename = "featuretest.features";
+	FILE *file = OpenPackedPositions(filename, false);
+	WritePackedPositions(file, &packed[0], fenCount);
+	fclose(file);
+	const bool extracted = ExtractPackedFeatures(filename, outputFilename, 2);
+	ASSERT(extracted);
+
+	file = fopen(outputFilename.c_str(), "rb");
+	ASSERT(file != NULL);
+
+	FeatureFileHeader header;
+	size_t read = fread(&header, sizeof(header), 1, file);
+	ASSERT(read == 1 && header.Magic == FeatureFileMagic && int(header.FeatureCount) == GetEvalFeatureCount());
+
+	std::vector<FeatureFileColumn> columns(header.FeatureCount);
+	read = fread(&columns[0], sizeof(FeatureFileColumn), header.FeatureCount, file);
+	ASSERT(read == header.FeatureCount);
+	ASSERT(std::string(columns[0].Name) == GetEvalFeatureName(0) && columns[0].Value == GetEvalFeatureValue(0));
+	ASSERT(std::string(columns[header.FeatureCount - 1].Name) == "PawnShelter");
+
+	for (int i = 0; i < fenCount; i++)
+	{
+		FeatureRecord record;
+		read = fread(&record, sizeof(record), 1, file);
+		ASSERT(read == 1 && record.Eval == evals[i] && record.Result == PackedResultUnknown);
+		ASSERT(record.Count == max(featureCounts[i], 0) && (record.Flags == FeatureRecordFlagsNoFeatures) == (i == 5));
+		fseek(file, record.Count * (sizeof(u16) + sizeof(float)), SEEK_CUR);
+	}
+	const int trailing = fgetc(file);
+	ASSERT(trailing == EOF);
+	fclose(file);
+
+	std::remove(filename.c_str());
+	std::remove(outputFilename.c_str());
+#endif
+}
+
 void PawnEvaluationTests()
 {
 	// TODO: a few unit tests on the passed pawn evaluation
@@ -267,6 +1286,309 @@ void PawnEvaluationTests()
 	
 	// Great position for testing passed pawns, and king shelter
 	// "2r3k1/1Q1R1pp1/7p/4p1b1/4p1P1/2r1q3/1PK4P/3R4 w - - 14 37"
+
+	// The set-wise pawn structure terms must be symmetric
+	const char *pawnStructures[] =
+	{
+		"2r3k1/1Q1R1pp1/7p/4p1b1/4p1P1/2r1q3/1PK4P/3R4 w - - 14 37",
+		"4k3/pp3p1p/2p3p1/3pP3/1P1P4/P5PP/5P2/4K3 w - - 0 1",
+		"4k3/p1p2ppp/1p6/1P1P4/P7/5P2/6PP/4K3 w - - 0 1",
+		"4k3/2p2p2/2p2p2/8/1P6/1P2P3/1P2P3/4K3 w - - 0 1",
+	};
+
+	for (int i = 0; i < 4; i++)
+	{
+		Position position;
+		position.Initialize(pawnStructures[i]);
+
+		EvalInfo evalInfo;
+		const int score = Evaluate(position, evalInfo);
+
+		position.Flip();
+		ASSERT(Evaluate(position, evalInfo) == score);
+	}
+
+	// Tripled, isolated pawns are worse than a healthy chain with the same material
+	Position position;
+	position.Initialize("4k3/8/8/8/8/1P6/1P6/1P2K3 w - - 0 1");
+	EvalInfo evalInfo;
+	const int tripled = Evaluate(position, evalInfo);
+	position.Initialize("4k3/8/8/8/8/2P5/1P6/P3K3 w - - 0 1");
+	ASSERT(Evaluate(position, evalInfo) > tripled);
+}
+
+void CheckNnueAccumulator(const Position &position)
+{
+	s16 accumulator[2][NnueHiddenSize];
+	NnueRefreshAccumulator(position, accumulator);
+	ASSERT(memcmp(accumulator, position.NnueAccumulator, sizeof(accumulator)) == 0);
+}
+
+void NnueTests()
+{
+	ASSERT(!LoadNnue("tests/missing.nnue"));
+
+	// A deterministic random network, we only check that the incremental updates and the kernels are consistent
+	static NnueWeights network;
+	u32 seed = 12345;
+	for (int f = 0; f < NnueInputSize; f++)
+	{
+		for (int j = 0; j < NnueHiddenSize; j++)
+		{
+			seed = seed * 1103515245 + 12345;
+			network.FeatureWeights[f][j] = s16(int((seed >> 16) % 41) - 20);
+		}
+	}
+	for (int j = 0; j < NnueHiddenSize; j++)
+	{
+		network.FeatureBias[j] = 30;
+	}
+	for (int k = 0; k < NnueHidden2Size; k++)
+	{
+		for (int i = 0; i < 2 * NnueHiddenSize; i++)
+		{
+			seed = seed * 1103515245 + 12345;
+			network.HiddenWeights[k][i] = s8(int((seed >> 16) % 61) - 30);
+		}
+		network.HiddenBias[k] = 64 * k;
+		seed = seed * 1103515245 + 12345;
+		network.OutputWeights[k] = s8(int((seed >> 16) % 61) - 30);
+	}
+	network.OutputBias = 1000;
+
+	const NnueWeights *previousNetwork = NnueNetwork;
+	SetNnueNetwork(&network);
+
+	const char *fens[] =
+	{
+		"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+		"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+		"n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1",
+		"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+	};
+
+	for (int f = 0; f < 4; f++)
+	{
+		Position position;
+		position.Initialize(fens[f]);
+		CheckNnueAccumulator(position);
+
+		Move moves[256];
+		const int moveCount = GenerateLegalMoves(position, moves);
+		for (int i = 0; i < moveCount; i++)
+		{
+			MoveUndo moveUndo;
+			position.MakeMove(moves[i], moveUndo);
+			CheckNnueAccumulator(position);
+
+			// The features are relative to each side, so the network is color symmetric
+			Position flipped;
+			position.Clone(flipped);
+			flipped.Flip();
+			ASSERT(NnueEvaluate(flipped) == NnueEvaluate(position));
+
+			Move replies[256];
+			const int replyCount = GenerateLegalMoves(position, replies);
+			for (int j = 0; j < replyCount; j++)
+			{
+				MoveUndo replyUndo;
+				position.MakeMove(replies[j], replyUndo);
+				CheckNnueAccumulator(position);
+				position.UnmakeMove(replies[j], replyUndo);
+			}
+
+			position.UnmakeMove(moves[i], moveUndo);
+			CheckNnueAccumulator(position);
+		}
+
+		// Evaluate dispatches to the network
+		EvalInfo evalInfo;
+		ASSERT(Evaluate(position, evalInfo) == NnueEvaluate(position));
+	}
+
+	SetNnueNetwork(previousNetwork);
+}
+
+void CheckLazyEvaluation(Position &position)
+{
+	EvalInfo fullInfo;
+	const int full = Evaluate(position, fullInfo);
+
+	// The eval cache would answer for us, so give each probe a hash it hasn't seen
+	const u64 hash = position.Hash;
+
+	for (int window = 0; window <= 1000; window += 50)
+	{
+		for (int direction = -1; direction <= 1; direction += 2)
+		{
+			const int alpha = full + direction * window - 1;
+			const int beta = alpha + 2;
+
+			position.Hash = hash ^ (u64(window * 2 + direction + 1) << 48);
+
+			EvalInfo evalInfo;
+			const int lazy = Evaluate(position, evalInfo, alpha, beta);
+			ASSERT(evalInfo.GamePhase[WHITE] == fullInfo.GamePhase[WHITE]);
+			ASSERT(evalInfo.GamePhase[BLACK] == fullInfo.GamePhase[BLACK]);
+
+			// Inside the window we must always get the exact evaluation, outside it a bound on it
+			if (lazy > alpha && lazy < beta)
+			{
+				ASSERT(lazy == full);
+			}
+			else if (lazy <= alpha)
+			{
+				ASSERT(full <= lazy);
+			}
+			else
+			{
+				ASSERT(full >= lazy);
+			}
+		}
+	}
+
+	position.Hash = hash;
+
+	// A full window is never cut short
+	EvalInfo evalInfo;
+	ASSERT(Evaluate(position, evalInfo, MinEval, MaxEval) == full);
+	ASSERT(Evaluate(position, evalInfo, full - 1, full + 1) == full);
+
+	// Cached evaluations must return the same score and king danger
+	const u64 hits = EvalCacheHits;
+	ASSERT(Evaluate(position, evalInfo, full + 500, full + 501) == full);
+	ASSERT(EvalCacheHits == hits + 1);
+	ASSERT(evalInfo.KingDanger[WHITE] == fullInfo.KingDanger[WHITE]);
+	ASSERT(evalInfo.KingDanger[BLACK] == fullInfo.KingDanger[BLACK]);
+}
+
+void LazyEvaluationTests()
+{
+	const char *fens[] =
+	{
+		"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+		"2r3k1/1Q1R1pp1/7p/4p1b1/4p1P1/2r1q3/1PK4P/3R4 w - - 14 37",
+		"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+		"8/5k2/4b3/3P4/2P5/8/3BK3/8 w - - 0 1",
+		// From the perft suite
+		"rnbqkbnr/pppp1pp1/8/3Pp2p/3Q4/8/PPP1PPPP/RNB1KBNR w KQkq e6 0 1",
+		"4k3/8/8/8/8/8/8/R3K2R w KQ - 0 1",
+		"7k/3p4/8/8/3P4/8/8/K7 w - - 0 1",
+		"n1n5/1Pk5/8/8/8/8/5Kp1/5N1N w - - 0 1",
+		"n1n5/PPPk4/8/8/8/8/4Kppp/5N1N b - - 0 1",
+	};
+	const int fenCount = sizeof(fens) / sizeof(fens[0]);
+
+	for (int i = 0; i < fenCount; i++)
+	{
+		Position position;
+		position.Initialize(fens[i]);
+		CheckLazyEvaluation(position);
+
+		Move moves[256];
+		const int moveCount = GenerateLegalMoves(position, moves);
+		for (int j = 0; j < moveCount; j++)
+		{
+			MoveUndo moveUndo;
+			position.MakeMove(moves[j], moveUndo);
+			CheckLazyEvaluation(position);
+			position.UnmakeMove(moves[j], moveUndo);
+		}
+	}
+}
+
+void EvalParameterTests()
+{
+	const char *fens[] =
+	{
+		"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+		"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+		"8/5k2/4b3/3P4/2P5/8/3BK3/8 w - - 0 1",
+	};
+	const int fenCount = sizeof(fens) / sizeof(fens[0]);
+
+	int scores[fenCount];
+	for (int i = 0; i < fenCount; i++)
+	{
+		Position position;
+		position.Initialize(fens[i]);
+		EvalInfo evalInfo;
+		scores[i] = Evaluate(position, evalInfo);
+	}
+
+	// Clearing the caches or rebuilding the tables doesn't change anything
+	UpdateEvalParameters();
+
+#ifdef EVAL_TUNING
+	// Changed parameters have to reach the evaluation, and changing them back has to restore it
+	Position played;
+	played.Initialize("r1bqkbnr/pppppppp/2n5/8/4P3/8/PPPP1PPP/RNBQKBNR w KQkq - 0 1");
+	const char *repetition[4] = { "g1f3", "g8f6", "f3g1", "f6g8" };
+	MoveUndo moveUndo[4];
+	for (int i = 0; i < 4; i++)
+	{
+		played.MakeMove(MakeMoveFromUciStringUnsafe(repetition[i]), moveUndo[i]);
+	}
+
+	for (int i = 0; i < GetEvalParameterCount(); i++)
+	{
+		*GetEvalParameter(i).Value += 100;
+	}
+	UpdateEvalParameters();
+
+	Position changed;
+	changed.Initialize(fens[1]);
+	EvalInfo changedInfo;
+	ASSERT(Evaluate(changed, changedInfo) != scores[1]);
+
+	// Refreshing the played position picks up the new tables without losing the move history
+	played.RefreshEvaluation();
+
+	Position fresh;
+	fresh.Initialize(played.GetFen());
+	ASSERT(played.PsqEval == fresh.PsqEval);
+	ASSERT(played.GamePhase[WHITE] == fresh.GamePhase[WHITE] && played.GamePhase[BLACK] == fresh.GamePhase[BLACK]);
+	ASSERT(played.IsDraw());
+
+	for (int i = 0; i < GetEvalParameterCount(); i++)
+	{
+		*GetEvalParameter(i).Value = GetEvalParameter(i).Default;
+	}
+	UpdateEvalParameters();
+#endif
+
+	for (int i = 0; i < fenCount; i++)
+	{
+		Position position;
+		position.Initialize(fens[i]);
+		EvalInfo evalInfo;
+		ASSERT(Evaluate(position, evalInfo) == scores[i]);
+	}
+}
+
+void TraceEvaluationTests()
+{
+	// The eval command traces the same evaluation the search uses
+	const char *fens[] =
+	{
+		"2rr3k/pp3pp1/1nnqbN1p/3pN3/2pP4/2P3Q1/PPB4P/R4RK1 w - - bm Qg6; id \"WAC.001\";",
+		"8/7p/5k2/5p2/p1p2P2/Pr1pPK2/1P1R3P/8 b - - bm Rxb2; id \"WAC.002\";",
+		"5rk1/1ppb3p/p1pb4/6q1/3P1p1r/2P1R2P/PP1BQ1P1/5RKN w - - bm Rg3; id \"WAC.003\";",
+		"r1bq2rk/pp3pbp/2p1p1pQ/7P/3P4/2PB1N2/PP3PPR/2KR4 w - - bm Qxh7+; id \"WAC.004\";",
+		"8/8/8/3k4/8/3PK3/8/8 w - - id \"KPK\";",
+		"8/8/8/3k4/8/4K3/8/6Q1 b - - id \"KQK\";",
+	};
+	const int fenCount = sizeof(fens) / sizeof(fens[0]);
+
+	for (int i = 0; i < fenCount; i++)
+	{
+		Position position;
+		position.Initialize(fens[i]);
+
+		const int traced = TraceEvaluation(position);
+		EvalInfo evalInfo;
+		ASSERT(traced == Evaluate(position, evalInfo));
+	}
 }
 
 void EvaluationFlipTests()
@@ -354,11 +1676,10 @@ u64 perft(Position &position, int depth)
 	u64 result = 0;
 
 	Move moves[256];
-	s16 moveScores[256];
 	if (!position.IsInCheck())
 	{
 		int moveCount = GenerateQuietMoves(position, moves);
-		moveCount += GenerateCaptureMoves(position, moves + moveCount, moveScores + moveCount);
+		moveCount += GenerateCaptureMoves(position, moves + moveCount);
 
 		for (int i = 0; i < moveCount; i++)
 		{
@@ -379,9 +1700,8 @@ u64 perft(Position &position, int depth)
 		if (verifyCheckEscape)
 		{
 			Move vMoves[256];
-			s16 vScores[256];
 			int vCount = GenerateQuietMoves(position, vMoves);
-			vCount += GenerateCaptureMoves(position, vMoves + vCount, vScores + vCount);
+			vCount += GenerateCaptureMoves(position, vMoves + vCount);
 			for (int i = 0; i < vCount; i++)
 			{
 				MoveUndo moveUndo;
@@ -412,10 +1732,33 @@ u64 perft(Position &position, int depth)
 	return result;
 }
 
-void RunPerftSuite(int depthToVerify)
+void PerftTests()
+{
+	Position position;
+	position.Initialize("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+
+	// Bulk counted perft should match the reference make/unmake version
+	for (int depth = 1; depth <= 3; depth++)
+	{
+		ASSERT(Perft(position, depth) == perft(position, depth));
+	}
+	ASSERT(Perft(position, 3) == 97862);
+
+	// The threaded/hashed version has to agree, both with a cold and a warm hash
+	Move moves[256];
+	u64 counts[256];
+	int moveCount;
+	InitializePerftHash(1);
+	ASSERT(PerftDivide(position, 4, 4, moves, counts, moveCount) == 4085603);
+	ASSERT(PerftDivide(position, 4, 4, moves, counts, moveCount) == 4085603);
+	ASSERT(moveCount == 48);
+	InitializePerftHash(0);
+}
+
+void RunPerftSuite(const std::string &filename, int depthToVerify)
 {
 	std::FILE* file;
-	file = fopen("tests/perftsuite.epd", "rt");
+	file = fopen(filename.c_str(), "rt");
 
 	char line[500];
 	u64 startTime = GetCurrentMilliseconds();
@@ -438,7 +1781,7 @@ void RunPerftSuite(int depthToVerify)
 				sscanf(line + i + 2, "%d %lld", &depth, &expected);
 				if (depth <= depthToVerify)
 				{
-					u64 count = perft(position, depth);
+					u64 count = Perft(position, depth);
 					totalCount += count;
 					if (count != expected)
 					{
@@ -620,6 +1963,54 @@ int TestSuite(const std::string &filename, s64 searchTime, int searchDepth)
     return passed;
 }
 
+// Fixed depth searches of a few positions, for comparing speed and node counts between builds.  Profiling builds
+// also report where the evaluation spent its time.
+void RunBench(const int depth)
+{
+	const char *fens[] =
+	{
+		"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+		"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+		"r4rk1/1p2ppb1/p2pbnpp/q7/3BPPP1/2N2B2/PPP4P/R2Q1RK1 w - - 0 2",
+		"1r1qr1k1/3nppb1/b2p2p1/2pn4/8/2N1BNPB/PPQ1PP2/R3K2R w KQ - 0 1",
+		"4r3/pp1brp2/4p1k1/4P3/5R2/P1R4P/1P3PP1/6K1 b - - 0 23",
+		"2r3k1/1Q1R1pp1/7p/4p1b1/4p1P1/2r1q3/1PK4P/3R4 w - - 14 37",
+		"8/6p1/8/5N1r/5K2/1b6/pk4P1/4R3 w - - 0 63",
+		"8/8/5p1k/1p1pp2P/pP3PK1/P1P5/8/8 b - - 0 1",
+	};
+
+	const int fenCount = sizeof(fens) / sizeof(fens[0]);
+
+	ClearEvalProfile();
+
+	u64 totalNodes = 0;
+	const u64 startTime = GetCurrentMilliseconds();
+	for (int i = 0; i < fenCount; i++)
+	{
+		// Each position starts from an empty table of the configured size
+		ClearHash();
+
+		Position position;
+		position.Initialize(fens[i]);
+
+		int score;
+		const Move move = IterativeDeepening(position, depth, score, -1, false);
+		const u64 nodes = GetSearchInfo(0).NodeCount + GetSearchInfo(0).QNodeCount;
+		totalNodes += nodes;
+
+		printf("%d. %s %d (%lld nodes)\n", i + 1, GetMoveSAN(position, move).c_str(), score, nodes);
+	}
+	const u64 msTaken = max(1ULL, GetCurrentMilliseconds() - startTime);
+
+	printf("Nodes: %lld\n", totalNodes);
+	printf("Time: %lld ms\n", msTaken);
+	printf("NPS: %lld\n", (totalNodes * 1000) / msTaken);
+
+#ifdef EVAL_PROFILE
+	PrintEvalProfile();
+#endif
+}
+
 void RunSts()
 {
     int passed = 0;
@@ -642,8 +2033,22 @@ void RunTests()
 	MoveSortingTests();
 	DrawTests();
 	HashTests();
+	MaterialTests();
+	BitbaseTests();
+	TablebaseTests();
+	BookTests();
+	PgnTests();
+	PackedTests();
+	SelfPlayTests();
+	BatchTests();
+	FeatureTests();
 	//EvaluationFlipTests();
 	PawnEvaluationTests();
+	LazyEvaluationTests();
+	EvalParameterTests();
+	TraceEvaluationTests();
+	NnueTests();
+	PerftTests();
 
 	InitializeHash(16000000);
 
@@ -662,5 +2067,8 @@ void RunTests()
 	u64 totalTime = GetCurrentMilliseconds() - startTime;
 	printf("NPS: %.2lf\n", (totalCount / (totalTime / 1000.0)));*/
 
-//	RunPerftSuite(5);
+//	RunPerftSuite("tests/perftsuite.epd", 5);
+//	BenchmarkMoveSorting("tests/wac.epd", 1000);
+//	BenchmarkSliderAttacks("tests/wac.epd", 10000);
+//	BenchmarkNnue("tests/wac.epd", "garbochess.nnue", 100);
 }
\ No newline at end of file
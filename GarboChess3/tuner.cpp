@@ -0,0 +1,479 @@
+#include "garbochess.h"
+#include "position.h"
+#include "movegen.h"
+#include "evaluation.h"
+#include "search.h"
+#include "movesorter.h"
+#include "nnue.h"
+#include "packed.h"
+#include "tuner.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#ifdef EVAL_TUNING
+
+// Positions are handed out to the threads in chunks, and the error is summed per chunk so the total doesn't depend
+// on the thread count
+const int TunerChunkSize = 4096;
+
+const int TunerMaxQuiescePly = 32;
+
+struct TunerSample
+{
+	PackedPosition Position;
+	float Result;		// 1 white won, 0.5 draw, 0 black won
+};
+
+// Returns false if the line has no recognizable result
+static bool ParseTunerResult(const std::string &line, float &result)
+{
+	// Skip the board, the result can't be confused with it
+	const size_t start = line.find(' ');
+	if (start == std::string::npos)
+	{
+		return false;
+	}
+
+	if (line.find("1/2-1/2", start) != std::string::npos || line.find("[0.5]", start) != std::string::npos)
+	{
+		result = 0.5f;
+	}
+	else if (line.find("1-0", start) != std::string::npos || line.find("[1.0]", start) != std::string::npos)
+	{
+		result = 1.0f;
+	}
+	else if (line.find("0-1", start) != std::string::npos || line.find("[0.0]", start) != std::string::npos)
+	{
+		result = 0.0f;
+	}
+	else
+	{
+		return false;
+	}
+	return true;
+}
+
+// Capture only search on the static evaluation (no pruning, no hash), returning the principal variation
+static int QuiesceWithPv(Position &position, SearchInfo &searchInfo, int alpha, const int beta, const int ply, Move *pv, int &pvLength)
+{
+	pvLength = 0;
+
+	EvalInfo evalInfo;
+	int eval = Evaluate(position, evalInfo);
+	if (ply >= TunerMaxQuiescePly)
+	{
+		return eval;
+	}
+
+	if (eval > alpha)
+	{
+		alpha = eval;
+		if (alpha >= beta)
+		{
+			return eval;
+		}
+	}
+
+	MoveSorter<64> moves(position, searchInfo);
+	moves.GenerateCaptures();
+
+	Move childPv[TunerMaxQuiescePly + 1];
+	Move move;
+	while ((move = moves.NextQMove()) != 0)
+	{
+		MoveUndo moveUndo;
+		position.MakeMove(move, moveUndo);
+
+		if (!position.CanCaptureKing())
+		{
+			int childPvLength;
+			const int value = -QuiesceWithPv(position, searchInfo, -beta, -alpha, ply + 1, childPv, childPvLength);
+			position.UnmakeMove(move, moveUndo);
+
+			if (value > eval)
+			{
+				eval = value;
+				if (value > alpha)
+				{
+					alpha = value;
+					pv[0] = move;
+					memcpy(pv + 1, childPv, childPvLength * sizeof(Move));
+					pvLength = childPvLength + 1;
+
+					if (value >= beta)
+					{
+						return value;
+					}
+				}
+			}
+		}
+		else
+		{
+			position.UnmakeMove(move, moveUndo);
+		}
+	}
+
+	return eval;
+}
+
+// Plays out the capture sequence the static evaluation is waiting on.  Returns false for positions that aren't
+// useful for tuning (checks, where the static evaluation means little).
+static bool GetQuietPosition(Position &position, SearchInfo &searchInfo)
+{
+	if (position.IsInCheck())
+	{
+		return false;
+	}
+
+	Move pv[TunerMaxQuiescePly + 1];
+	int pvLength;
+	QuiesceWithPv(position, searchInfo, MinEval, MaxEval, 0, pv, pvLength);
+
+	for (int i = 0; i < pvLength; i++)
+	{
+		MoveUndo moveUndo;
+		position.MakeMove(pv[i], moveUndo);
+	}
+
+	return !position.IsInCheck();
+}
+
+// Adds the quiet position the capture search leads to, if there is one
+static void AddTunerSample(Position &position, const float result, SearchInfo &searchInfo, std::vector<TunerSample> &samples)
+{
+	TunerSample sample;
+	sample.Result = result;
+	if (GetQuietPosition(position, searchInfo) && PackPosition(position, sample.Position))
+	{
+		samples.push_back(sample);
+	}
+}
+
+static bool LoadPackedTunerSamples(const std::string &filename, std::vector<TunerSample> &samples)
+{
+	u64 count;
+	const PackedPosition *positions = MapPackedPositions(filename, count);
+	if (positions == 0)
+	{
+		printf("Unable to open %s\n", filename.c_str());
+		return false;
+	}
+
+	SearchInfo &searchInfo = GetSearchInfo(0);
+	int unlabelled = 0;
+
+	Position position;
+	for (u64 i = 0; i < count; i++)
+	{
+		if (positions[i].Result == PackedResultUnknown)
+		{
+			unlabelled++;
+			continue;
+		}
+
+		UnpackPosition(positions[i], position);
+		AddTunerSample(position, positions[i].Result / 2.0f, searchInfo, samples);
+	}
+
+	UnmapPackedPositions(positions, count);
+
+	printf("%lld positions, %d without a result, %d quiet positions used\n", count, unlabelled, int(samples.size()));
+	return true;
+}
+
+static bool LoadTunerSamples(const std::string &filename, std::vector<TunerSample> &samples)
+{
+	if (IsPackedFilename(filename))
+	{
+		return LoadPackedTunerSamples(filename, samples);
+	}
+
+	std::FILE *file = std::fopen(filename.c_str(), "rt");
+	if (file == NULL)
+	{
+		printf("Unable to open %s\n", filename.c_str());
+		return false;
+	}
+
+	SearchInfo &searchInfo = GetSearchInfo(0);
+	int lines = 0, unlabelled = 0;
+
+	char line[500];
+	while (std::fgets(line, 500, file) != NULL)
+	{
+		if (!isalpha(line[0]) && !isdigit(line[0]))
+		{
+			continue;
+		}
+		lines++;
+
+		float result;
+		if (!ParseTunerResult(line, result))
+		{
+			unlabelled++;
+			continue;
+		}
+
+		Position position;
+		position.Initialize(line);
+		AddTunerSample(position, result, searchInfo, samples);
+	}
+
+	std::fclose(file);
+
+	printf("%d positions, %d without a result, %d quiet positions used\n", lines, unlabelled, int(samples.size()));
+	return true;
+}
+
+inline double GetWinProbability(const double score, const double k)
+{
+	return 1.0 / (1.0 + pow(10.0, -k * score / 400.0));
+}
+
+struct TunerWork
+{
+	const std::vector<TunerSample> *Samples;
+	int *Scores;			// if set, white's point of view scores are stored here instead of computing the error
+	double *ChunkErrors;
+	double K;
+	int ChunkCount;
+	volatile int NextChunk;
+};
+
+static void TunerThread(void *argument)
+{
+	TunerWork &work = *(TunerWork*)argument;
+	const std::vector<TunerSample> &samples = *work.Samples;
+
+	// The caches are per thread, and are stale once the parameters change
+	ClearEvaluationCaches();
+
+	Position position;
+	for (;;)
+	{
+		const int chunk = AtomicIncrement(work.NextChunk) - 1;
+		if (chunk >= work.ChunkCount)
+		{
+			break;
+		}
+
+		const int start = chunk * TunerChunkSize;
+		const int end = min(start + TunerChunkSize, int(samples.size()));
+		double error = 0;
+		for (int i = start; i < end; i++)
+		{
+			// Unpacking recomputes the piece square and material terms with the current parameters
+			UnpackPosition(samples[i].Position, position);
+
+			EvalInfo evalInfo;
+			const int eval = Evaluate(position, evalInfo);
+			const int score = position.ToMove == WHITE ? eval : -eval;
+
+			if (work.Scores != 0)
+			{
+				work.Scores[i] = score;
+			}
+			else
+			{
+				const double delta = samples[i].Result - GetWinProbability(score, work.K);
+				error += delta * delta;
+			}
+		}
+		work.ChunkErrors[chunk] = error;
+	}
+}
+
+static double RunTunerWork(const std::vector<TunerSample> &samples, const int threadCount, const double k, int *scores)
+{
+	TunerWork work;
+	work.Samples = &samples;
+	work.Scores = scores;
+	work.K = k;
+	work.ChunkCount = (int(samples.size()) + TunerChunkSize - 1) / TunerChunkSize;
+	work.NextChunk = 0;
+
+	std::vector<double> chunkErrors(work.ChunkCount);
+	work.ChunkErrors = &chunkErrors[0];
+
+	const int helperCount = min(threadCount, work.ChunkCount) - 1;
+	ThreadHandle threads[256];
+	for (int i = 0; i < helperCount; i++)
+	{
+		threads[i] = StartThread(TunerThread, &work);
+	}
+
+	// The calling thread does its share of the work as well
+	TunerThread(&work);
+
+	for (int i = 0; i < helperCount; i++)
+	{
+		WaitForThread(threads[i]);
+	}
+
+	double error = 0;
+	for (int i = 0; i < work.ChunkCount; i++)
+	{
+		error += chunkErrors[i];
+	}
+	return error / samples.size();
+}
+
+static double GetTunerError(const std::vector<TunerSample> &samples, const int threadCount, const double k)
+{
+	return RunTunerWork(samples, threadCount, k, 0);
+}
+
+// The scaling constant that best maps the current evaluation onto the results.  The evaluations don't depend on it,
+// so they are computed once and the search runs over the stored scores.
+static double FitTunerK(const std::vector<TunerSample> &samples, const int threadCount)
+{
+	std::vector<int> scores(samples.size());
+	RunTunerWork(samples, threadCount, 0, &scores[0]);
+
+	double bestK = 1.0, bestError = 1e300;
+	for (double step = 0.1; step >= 0.001; step /= 10)
+	{
+		const double center = bestK;
+		for (int i = -10; i <= 10; i++)
+		{
+			const double k = center + i * step;
+			if (k <= 0)
+			{
+				continue;
+			}
+
+			double error = 0;
+			for (int j = 0; j < (int)samples.size(); j++)
+			{
+				const double delta = samples[j].Result - GetWinProbability(scores[j], k);
+				error += delta * delta;
+			}
+
+			if (error < bestError)
+			{
+				bestError = error;
+				bestK = k;
+			}
+		}
+	}
+	return bestK;
+}
+
+static void WriteTunerParameters(const std::string &filename)
+{
+	std::FILE *file = std::fopen(filename.c_str(), "wt");
+	if (file == NULL)
+	{
+		printf("Unable to write %s\n", filename.c_str());
+		return;
+	}
+
+	for (int i = 0; i < GetEvalParameterCount(); i++)
+	{
+		const EvalParameter &parameter = GetEvalParameter(i);
+		fprintf(file, "%s %d\n", parameter.Name, *parameter.Value);
+	}
+	std::fclose(file);
+}
+
+void RunTuner(const std::string &epdFilename, const std::string &parameterFilename, const int threadCount)
+{
+	// Tune the hand-crafted evaluation, not the network
+	const NnueWeights *network = NnueNetwork;
+	SetNnueNetwork(0);
+
+	std::vector<TunerSample> samples;
+	if (!LoadTunerSamples(epdFilename, samples) || samples.empty())
+	{
+		SetNnueNetwork(network);
+		return;
+	}
+
+	const double k = FitTunerK(samples, threadCount);
+	double bestError = GetTunerError(samples, threadCount, k);
+	printf("K %.3f, error %.6f, %d parameters, %d threads\n", k, bestError, GetEvalParameterCount(), threadCount);
+
+	// Each parameter steps by a tenth of its starting value, halving every time neither direction helps
+	std::vector<int> steps(GetEvalParameterCount());
+	for (int i = 0; i < GetEvalParameterCount(); i++)
+	{
+		steps[i] = max(1, abs(*GetEvalParameter(i).Value) / 10);
+	}
+
+	for (int pass = 1; ; pass++)
+	{
+		const u64 startTime = GetCurrentMilliseconds();
+		int evaluations = 0;
+		bool improved = false, refining = false;
+
+		for (int i = 0; i < GetEvalParameterCount(); i++)
+		{
+			const EvalParameter &parameter = GetEvalParameter(i);
+			const int original = *parameter.Value;
+
+			bool found = false;
+			for (int direction = 1; direction >= -1 && !found; direction -= 2)
+			{
+				// Bonuses stay bonuses and penalties stay penalties (the phase scales can't go negative either)
+				const int value = original + direction * steps[i];
+				if ((parameter.Default > 0 && value < 0) || (parameter.Default < 0 && value > 0))
+				{
+					continue;
+				}
+
+				*parameter.Value = value;
+				UpdateEvalParameters();
+
+				const double error = GetTunerError(samples, threadCount, k);
+				evaluations++;
+				if (error < bestError)
+				{
+					bestError = error;
+					found = true;
+				}
+			}
+
+			if (found)
+			{
+				improved = true;
+			}
+			else
+			{
+				*parameter.Value = original;
+				UpdateEvalParameters();
+
+				if (steps[i] > 1)
+				{
+					steps[i] /= 2;
+					refining = true;
+				}
+			}
+		}
+
+		WriteTunerParameters(parameterFilename);
+
+		const u64 msTaken = max(1ULL, GetCurrentMilliseconds() - startTime);
+		printf("Pass %d: error %.6f, %lld ms, %.0f positions/s/thread\n",
+			pass, bestError, msTaken, (double(evaluations) * samples.size() * 1000) / (double(msTaken) * threadCount));
+
+		if (!improved && !refining)
+		{
+			break;
+		}
+	}
+
+	SetNnueNetwork(network);
+}
+
+#else
+
+void RunTuner(const std::string &, const std::string &, const int)
+{
+	printf("Tuning needs a build with EVAL_TUNING defined\n");
+}
+
+#endif
@@ -0,0 +1,8 @@
+// Texel style tuning of the evaluation parameters (needs a build with EVAL_TUNING, see evaluation.h).
+//
+// Reads an EPD file of positions labelled with game results ("1-0", "0-1", "1/2-1/2", or [1.0]/[0.5]/[0.0]), or a
+// .packed file with results (see packed.h), resolves each one to a quiet position with a capture search, then
+// minimizes the error between the game results and the logistic of the static evaluation by coordinate descent over
+// all the parameters.  The best values found so far are written to parameterFilename ("Name Value" lines) after
+// every pass.
+void RunTuner(const std::string &epdFilename, const std::string &parameterFilename, const int threadCount);
@@ -52,6 +52,184 @@ Move MakeMoveFromUciString(Position &position, const std::string &moveString)
 	return 0;
 }
 
+Move MakeMoveFromSanString(Position &position, const std::string &moveString)
+{
+	// Annotations and check marks aren't needed to find the move
+	int length = (int)moveString.length();
+	while (length > 0 && strchr("+#!?", moveString[length - 1]) != NULL)
+	{
+		length--;
+	}
+
+	// 0-0 is common in older files
+	if (length >= 3 && (moveString[0] == 'O' || moveString[0] == '0'))
+	{
+		Move moves[256];
+		const int moveCount = GenerateLegalMoves(position, moves);
+		const bool kingSide = length < 5;
+		for (int i = 0; i < moveCount; i++)
+		{
+			if (GetMoveType(moves[i]) == MoveTypeCastle && (GetColumn(GetTo(moves[i])) > FILE_E) == kingSide)
+			{
+				return moves[i];
+			}
+		}
+		return 0;
+	}
+
+	int at = 0;
+	PieceType pieceType = PAWN;
+	switch (length > 0 ? moveString[0] : 0)
+	{
+	case 'N': pieceType = KNIGHT; at++; break;
+	case 'B': pieceType = BISHOP; at++; break;
+	case 'R': pieceType = ROOK; at++; break;
+	case 'Q': pieceType = QUEEN; at++; break;
+	case 'K': pieceType = KING; at++; break;
+	}
+
+	// Promotion, with or without the '='
+	PieceType promotionType = PIECE_NONE;
+	if (pieceType == PAWN && length > 2)
+	{
+		switch (toupper(moveString[length - 1]))
+		{
+		case 'N': promotionType = KNIGHT; break;
+		case 'B': promotionType = BISHOP; break;
+		case 'R': promotionType = ROOK; break;
+		case 'Q': promotionType = QUEEN; break;
+		}
+
+		if (promotionType != PIECE_NONE)
+		{
+			length--;
+			if (moveString[length - 1] == '=')
+			{
+				length--;
+			}
+		}
+	}
+
+	if (length - at < 2 ||
+		moveString[length - 2] < 'a' || moveString[length - 2] > 'h' ||
+		moveString[length - 1] < '1' || moveString[length - 1] > '8')
+	{
+		return 0;
+	}
+	const Square to = MakeSquare(RANK_1 - (moveString[length - 1] - '1'), moveString[length - 2] - 'a');
+
+	// Whatever is left is the disambiguation (and the capture mark)
+	int fromColumn = -1, fromRow = -1;
+	for (; at < length - 2; at++)
+	{
+		if (moveString[at] >= 'a' && moveString[at] <= 'h')
+		{
+			fromColumn = moveString[at] - 'a';
+		}
+		else if (moveString[at] >= '1' && moveString[at] <= '8')
+		{
+			fromRow = RANK_1 - (moveString[at] - '1');
+		}
+	}
+
+	// Only the pieces that can get to the target square are tried, rather than generating every legal move
+	const Color us = position.ToMove;
+	Move candidates[16];
+	int candidateCount = 0;
+	if (pieceType == PAWN)
+	{
+		const int forward = us == WHITE ? -8 : 8;
+		const int lastRow = us == WHITE ? RANK_8 : RANK_1;
+		if ((GetRow(to) == lastRow) != (promotionType != PIECE_NONE))
+		{
+			return 0;
+		}
+
+		Square from = -1;
+		if (fromColumn == -1 || fromColumn == GetColumn(to))
+		{
+			// Pushes, one or two squares
+			from = to - forward;
+			if (IsSquareValid(from) && position.Board[from] == PIECE_NONE)
+			{
+				from -= forward;
+			}
+		}
+		else if (GetRow(to) - forward / 8 >= RANK_8 && GetRow(to) - forward / 8 <= RANK_1)
+		{
+			from = MakeSquare(GetRow(to) - forward / 8, fromColumn);
+		}
+
+		if (IsSquareValid(from) && (fromRow == -1 || GetRow(from) == fromRow))
+		{
+			if (promotionType != PIECE_NONE)
+			{
+				const int promotionMoves[] = { 0, 0, PromotionTypeKnight, PromotionTypeBishop, PromotionTypeRook, PromotionTypeQueen };
+				candidates[candidateCount++] = GeneratePromotionMove(from, to, promotionMoves[promotionType]);
+			}
+			else if (to == position.EnPassent && GetColumn(from) != GetColumn(to))
+			{
+				candidates[candidateCount++] = GenerateEnPassentMove(from, to);
+			}
+			else
+			{
+				candidates[candidateCount++] = GenerateMove(from, to);
+			}
+		}
+	}
+	else if (promotionType == PIECE_NONE)
+	{
+		const Bitboard allPieces = position.GetAllPieces();
+		Bitboard attackers;
+		switch (pieceType)
+		{
+		case KNIGHT: attackers = GetKnightAttacks(to); break;
+		case BISHOP: attackers = GetBishopAttacks(to, allPieces); break;
+		case ROOK: attackers = GetRookAttacks(to, allPieces); break;
+		case QUEEN: attackers = GetQueenAttacks(to, allPieces); break;
+		default: attackers = GetKingAttacks(to); break;
+		}
+
+		attackers &= position.Pieces[pieceType] & position.Colors[us];
+		while (attackers && candidateCount < 16)
+		{
+			const Square from = PopFirstBit(attackers);
+			if ((fromColumn == -1 || GetColumn(from) == fromColumn) && (fromRow == -1 || GetRow(from) == fromRow))
+			{
+				candidates[candidateCount++] = GenerateMove(from, to);
+			}
+		}
+	}
+
+	Move result = 0;
+	for (int i = 0; i < candidateCount; i++)
+	{
+		if (GetPieceType(position.Board[GetFrom(candidates[i])]) != pieceType ||
+			!IsMovePseudoLegal(position, candidates[i]))
+		{
+			continue;
+		}
+
+		MoveUndo moveUndo;
+		position.MakeMove(candidates[i], moveUndo);
+		const bool legal = !position.CanCaptureKing();
+		position.UnmakeMove(candidates[i], moveUndo);
+		if (!legal)
+		{
+			continue;
+		}
+
+		// Ambiguous
+		if (result != 0)
+		{
+			return 0;
+		}
+		result = candidates[i];
+	}
+
+	return result;
+}
+
 std::string GetSquareSAN(const Square square)
 {
 	std::string result;
@@ -151,7 +329,7 @@ std::string GetMoveSAN(Position &position, const Move move)
 				result += GetSquareSAN(from);
 			}
 		}
-		else if (fromPieceType == PAWN && position.Board[to] != PIECE_NONE)
+		else if (fromPieceType == PAWN && (position.Board[to] != PIECE_NONE || moveType == MoveTypeEnPassent))
 		{
 			// Pawn captures need a row
 			result += GetSquareSAN(from)[0];
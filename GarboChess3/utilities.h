@@ -2,6 +2,9 @@
 
 std::vector<std::string> tokenize(const std::string &in, const std::string &tok);
 Move MakeMoveFromUciString(Position &position, const std::string &moveString);
+// Inverse of GetMoveSAN, also accepts missing check marks, 0-0 and promotions without the '='.  Returns 0 if the
+// string isn't exactly one legal move.
+Move MakeMoveFromSanString(Position &position, const std::string &moveString);
 std::string GetSquareSAN(const Square square);
 std::string GetMoveUci(const Move move);
 std::string GetMoveSAN(Position &position, const Move move);
\ No newline at end of file
@@ -7,7 +7,11 @@
 #else
 #include <unistd.h>
 #include <sys/time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
 #include <stdio.h>
+#include <pthread.h>
 #endif
 
 #include "garbochess.h"
@@ -118,3 +122,170 @@ bool CheckForPendingInput()
 }
 
 #endif
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Threads
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct ThreadStart
+{
+	ThreadFunction Function;
+	void *Argument;
+};
+
+#if defined (_MSC_VER) || defined(__MINGW32__) || defined(__MINGW64__)
+
+static DWORD WINAPI ThreadEntry(LPVOID parameter)
+{
+	ThreadStart *start = (ThreadStart*)parameter;
+	start->Function(start->Argument);
+	delete start;
+	return 0;
+}
+
+ThreadHandle StartThread(ThreadFunction function, void *argument)
+{
+	ThreadStart *start = new ThreadStart;
+	start->Function = function;
+	start->Argument = argument;
+	return (ThreadHandle)CreateThread(NULL, 0, ThreadEntry, start, 0, NULL);
+}
+
+void WaitForThread(ThreadHandle thread)
+{
+	WaitForSingleObject((HANDLE)thread, INFINITE);
+	CloseHandle((HANDLE)thread);
+}
+
+int GetProcessorCount()
+{
+	SYSTEM_INFO systemInfo;
+	GetSystemInfo(&systemInfo);
+	return systemInfo.dwNumberOfProcessors;
+}
+
+int AtomicIncrement(volatile int &value)
+{
+	return InterlockedIncrement((volatile LONG*)&value);
+}
+
+#else
+
+static void *ThreadEntry(void *parameter)
+{
+	ThreadStart *start = (ThreadStart*)parameter;
+	start->Function(start->Argument);
+	delete start;
+	return NULL;
+}
+
+ThreadHandle StartThread(ThreadFunction function, void *argument)
+{
+	ThreadStart *start = new ThreadStart;
+	start->Function = function;
+	start->Argument = argument;
+
+	pthread_t *thread = new pthread_t;
+	pthread_create(thread, NULL, ThreadEntry, start);
+	return (ThreadHandle)thread;
+}
+
+void WaitForThread(ThreadHandle thread)
+{
+	pthread_t *pthread = (pthread_t*)thread;
+	pthread_join(*pthread, NULL);
+	delete pthread;
+}
+
+int GetProcessorCount()
+{
+	const long count = sysconf(_SC_NPROCESSORS_ONLN);
+	return count > 0 ? int(count) : 1;
+}
+
+int AtomicIncrement(volatile int &value)
+{
+	return __sync_add_and_fetch(&value, 1);
+}
+
+#endif
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Files
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined (_MSC_VER) || defined(__MINGW32__) || defined(__MINGW64__)
+
+const void *MapFile(const char *filename, u64 &size)
+{
+	HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return 0;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+	{
+		CloseHandle(file);
+		return 0;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+	if (mapping == NULL)
+	{
+		return 0;
+	}
+
+	// The view keeps the mapping alive
+	const void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+
+	size = u64(fileSize.QuadPart);
+	return data;
+}
+
+void UnmapFile(const void *data, const u64 size)
+{
+	UnmapViewOfFile(data);
+}
+
+#else
+
+const void *MapFile(const char *filename, u64 &size)
+{
+	const int file = open(filename, O_RDONLY);
+	if (file < 0)
+	{
+		return 0;
+	}
+
+	struct stat fileStat;
+	if (fstat(file, &fileStat) != 0 || fileStat.st_size == 0)
+	{
+		close(file);
+		return 0;
+	}
+
+	void *data = mmap(NULL, size_t(fileStat.st_size), PROT_READ, MAP_SHARED, file, 0);
+	close(file);
+	if (data == MAP_FAILED)
+	{
+		return 0;
+	}
+
+	size = u64(fileStat.st_size);
+	return data;
+}
+
+void UnmapFile(const void *data, const u64 size)
+{
+	munmap(const_cast<void*>(data), size_t(size));
+}
+
+#endif
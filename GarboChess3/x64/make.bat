@@ -1,5 +1,5 @@
 @echo off
-cl /Zi /Ox /Oi /Ot /favor:INTEL64 /EHs-c- /GL /MT /GS- /GR- /W3 /nologo /D "X64" /D "NDEBUG" /TP ../main.cpp ../movegen.cpp ../position.cpp ../search.cpp ../psqTables.cpp ../windows.cpp ../evaluation.cpp ../tests.cpp ../utilities.cpp /link /OUT:"GarboChess3.exe" /INCREMENTAL:NO /DEBUG /FIXED:NO
+cl /Zi /Ox /Oi /Ot /favor:INTEL64 /EHs-c- /GL /MT /GS- /GR- /W3 /nologo /D "X64" /D "NDEBUG" /TP ../main.cpp ../movegen.cpp ../position.cpp ../search.cpp ../psqTables.cpp ../windows.cpp ../evaluation.cpp ../tests.cpp ../utilities.cpp ../perft.cpp ../nnue.cpp ../tuner.cpp ../bitbase.cpp ../tablebase.cpp ../book.cpp ../pgn.cpp ../packed.cpp ../selfplay.cpp ../batch.cpp /link /OUT:"GarboChess3.exe" /INCREMENTAL:NO /DEBUG /FIXED:NO
 copy /Y garbochess3.exe ..
 REM pushd ..
 REM garbochess3.exe
@@ -12,6 +12,23 @@ enum MoveGenerationState
 	MoveGenerationState_CheckEscapes,
 };
 
+// Moves are packed together with their ordering score as (score << 16) | move.  Only the scores are compared, and
+// picking keeps the remaining entries in generation order, so equal scores come out in the order they were generated.
+typedef s32 MoveSortEntry;
+
+const MoveSortEntry MoveSortSentinel = MoveSortEntry(0x80000000);
+
+inline MoveSortEntry PackMoveSortEntry(const Move move, const int score)
+{
+	ASSERT(score > -32768 && score <= 32767);
+	return MoveSortEntry(u32(score) << 16) | move;
+}
+
+inline int GetMoveSortScore(const MoveSortEntry entry)
+{
+	return entry >> 16;
+}
+
 template<int maxMoves>
 class MoveSorter
 {
@@ -33,43 +50,49 @@ public:
 	inline void GenerateCaptures()
 	{
 		at = 0;
-		moveCount = GenerateCaptureMoves(position, moves, moveScores);
-		moves[moveCount] = 0; // Sentinel move
+		moveCount = GenerateCaptureMoves(position, generated);
+
+		// Widen in place, back to front so that no generated move is overwritten before it is read
+		for (int i = moveCount - 1; i >= 0; i--)
+		{
+			const Move move = generated[i];
+			entries[i] = PackMoveSortEntry(move, ScoreCaptureMove(move, GetPieceType(position.Board[GetFrom(move)]), GetPieceType(position.Board[GetTo(move)])));
+		}
+		TerminateEntries();
 	}
     
 	inline void GenerateCheckEscape()
 	{
 		at = 0;
-		moveCount = GenerateCheckEscapeMoves(position, moves);
-		moves[moveCount] = 0;
+		moveCount = GenerateCheckEscapeMoves(position, generated);
         
 		state = MoveGenerationState_CheckEscapes;
         
-		for (int i = 0; i < moveCount; i++)
+		for (int i = moveCount - 1; i >= 0; i--)
 		{
-			const PieceType toPiece = GetPieceType(position.Board[GetTo(moves[i])]);
+			const Move move = generated[i];
+			const PieceType toPiece = GetPieceType(position.Board[GetTo(move)]);
             
-			moveScores[i] = toPiece != PIECE_NONE ? 
+			entries[i] = PackMoveSortEntry(move, toPiece != PIECE_NONE ? 
             // Sort captures first
-            ScoreCaptureMove(moves[i], GetPieceType(position.Board[GetFrom(moves[i])]), toPiece) :
+            ScoreCaptureMove(move, GetPieceType(position.Board[GetFrom(move)]), toPiece) :
             // Score non-captures as equal
-            0;
+            0);
 		}
+		TerminateEntries();
 	}
     
 	inline void GenerateChecks()
 	{
 		at = 0;
-		moveCount = GenerateCheckingMoves(position, moves);
-		moves[moveCount] = 0;
-        
-		// Disabled since we don't order our checking moves.
-		/*
-         for (int i = 0; i < moveCount; i++)
-         {
-         moveScores[i] = 0;
-         }
-         */
+		moveCount = GenerateCheckingMoves(position, generated);
+
+		// We don't order our checking moves.
+		for (int i = moveCount - 1; i >= 0; i--)
+		{
+			entries[i] = PackMoveSortEntry(generated[i], 0);
+		}
+		TerminateEntries();
 	}
     
 	inline void InitializeNormalMoves(const Move hashMove, const Move killer1, const Move killer2, const bool generatePawnMoves)
@@ -84,31 +107,73 @@ public:
 		this->killer2 = killer2;
 	}
     
+	// Selects the first of the best scoring remaining moves and moves it to the front, so only the moves that actually
+	// get searched are sorted.
 	inline Move PickBestMove()
 	{
 		// We use a trick here instead of checking for at == moveCount.
-		// The move initialization code stores a sentinel move at the end of the movelist.
+		// The move initialization code stores sentinel entries (with a zero move) at the end of the movelist.
 		ASSERT(at <= moveCount);
         
-		s16 bestScore = moveScores[at], bestMove = moves[at];
-		for (int i = ++at; i < moveCount; i++)
+		int best = at;
+#ifdef USE_SSE2
+		if (moveCount - at > 4)
 		{
-			ASSERT(moveScores[i] >= MinEval && moveScores[i] <= MaxEval);
-            
-			const s16 score = moveScores[i];
-			if (score > bestScore)
+			// Four-wide max over the scores, tracking where each lane's maximum came from.  Each lane keeps its first
+			// maximum, and the reduction prefers the lower index on equal scores.  Reading past moveCount only sees
+			// sentinels, which score below every real entry.
+			const __m128i four = _mm_set1_epi32(4);
+			__m128i index = _mm_setr_epi32(at, at + 1, at + 2, at + 3);
+			__m128i bestScores = _mm_srai_epi32(_mm_loadu_si128((const __m128i*)(entries + at)), 16);
+			__m128i bestIndices = index;
+			for (int i = at + 4; i < moveCount; i += 4)
 			{
-				const Move move = moves[i];
-				moves[i] = bestMove;
-				moveScores[i] = bestScore;
-				bestMove = move;
-				bestScore = score;
+				index = _mm_add_epi32(index, four);
+				const __m128i current = _mm_srai_epi32(_mm_loadu_si128((const __m128i*)(entries + i)), 16);
+				const __m128i greater = _mm_cmpgt_epi32(current, bestScores);
+				bestScores = _mm_or_si128(_mm_and_si128(greater, current), _mm_andnot_si128(greater, bestScores));
+				bestIndices = _mm_or_si128(_mm_and_si128(greater, index), _mm_andnot_si128(greater, bestIndices));
 			}
+
+			// Horizontal reduction of the four lanes
+			__m128i otherScores = _mm_shuffle_epi32(bestScores, _MM_SHUFFLE(1, 0, 3, 2));
+			__m128i otherIndices = _mm_shuffle_epi32(bestIndices, _MM_SHUFFLE(1, 0, 3, 2));
+			__m128i better = _mm_or_si128(_mm_cmpgt_epi32(otherScores, bestScores),
+				_mm_and_si128(_mm_cmpeq_epi32(otherScores, bestScores), _mm_cmplt_epi32(otherIndices, bestIndices)));
+			bestScores = _mm_or_si128(_mm_and_si128(better, otherScores), _mm_andnot_si128(better, bestScores));
+			bestIndices = _mm_or_si128(_mm_and_si128(better, otherIndices), _mm_andnot_si128(better, bestIndices));
+
+			otherScores = _mm_shuffle_epi32(bestScores, _MM_SHUFFLE(2, 3, 0, 1));
+			otherIndices = _mm_shuffle_epi32(bestIndices, _MM_SHUFFLE(2, 3, 0, 1));
+			better = _mm_or_si128(_mm_cmpgt_epi32(otherScores, bestScores),
+				_mm_and_si128(_mm_cmpeq_epi32(otherScores, bestScores), _mm_cmplt_epi32(otherIndices, bestIndices)));
+			bestIndices = _mm_or_si128(_mm_and_si128(better, otherIndices), _mm_andnot_si128(better, bestIndices));
+
+			best = _mm_cvtsi128_si32(bestIndices);
+		}
+		else
+#endif
+		{
+			for (int i = at + 1; i < moveCount; i++)
+			{
+				if (GetMoveSortScore(entries[i]) > GetMoveSortScore(entries[best]))
+				{
+					best = i;
+				}
+			}
+		}
+        
+		// Shifting rather than swapping keeps the rest in generation order
+		const MoveSortEntry bestEntry = entries[best];
+		for (int i = best; i > at; i--)
+		{
+			entries[i] = entries[i - 1];
 		}
+		entries[at++] = bestEntry;
         
-		ASSERT(at >= moveCount || (moveScores[at - 1] >= moveScores[at]));
+		ASSERT(at >= moveCount || GetMoveSortScore(entries[at - 1]) >= GetMoveSortScore(entries[at]));
         
-		return bestMove;
+		return Move(bestEntry);
 	}
     
 	inline Move NextQMove()
@@ -152,13 +217,21 @@ public:
                     
                     // Losing captures go off to the back of the list, winning/equal get returned.  They will
                     // have been scored correctly already.
-                    if (FastSee(position, bestMove, position.ToMove))
+                    if (SeeAtLeast(position, bestMove, position.ToMove, 0))
                     {
                         return bestMove;
                     }
                     else
                     {
-                        losingCaptures[losingCapturesCount++] = bestMove;
+                        // Losing captures are kept at the front of the entries, which have already been consumed.
+                        // They are sorted by their exact SEE value, least losing first.
+                        const MoveSortEntry entry = PackMoveSortEntry(bestMove, See(position, bestMove, position.ToMove));
+                        int i = losingCapturesCount++;
+                        for (; i > 0 && GetMoveSortScore(entries[i - 1]) < GetMoveSortScore(entry); i--)
+                        {
+                            entries[i] = entries[i - 1];
+                        }
+                        entries[i] = entry;
                     }
                 }
                 
@@ -187,21 +260,31 @@ public:
                 // Intentional fall-through
                 
             case MoveGenerationState_GenerateQuietMoves:
-                if (generatePawnMoves)
-                {
-                    moveCount = GenerateQuietMoves(position, moves);
-                }
-                else
                 {
-                    moveCount = GenerateSliderMoves(position, moves);
-                }
-                at = 0;
-                
-                for (int i = 0; i < moveCount; i++)
-                {
-                    int historyScore = searchInfo.History[position.Board[GetFrom(moves[i])]][GetTo(moves[i])];
-                    if (historyScore > 32767) historyScore = 32767;
-                    moveScores[i] = historyScore;
+                    // Quiet moves are generated right after the losing captures, and widened back to front into
+                    // the entries following them.  Entry i only overlaps generated moves that have already been read.
+                    Move *quietMoves = generated + (losingCapturesCount * 2);
+                    int quietCount;
+                    if (generatePawnMoves)
+                    {
+                        quietCount = GenerateQuietMoves(position, quietMoves);
+                    }
+                    else
+                    {
+                        quietCount = GenerateSliderMoves(position, quietMoves);
+                    }
+                    
+                    for (int i = quietCount - 1; i >= 0; i--)
+                    {
+                        const Move move = quietMoves[i];
+                        int historyScore = searchInfo.History[position.Board[GetFrom(move)]][GetTo(move)];
+                        if (historyScore > 32767) historyScore = 32767;
+                        entries[losingCapturesCount + i] = PackMoveSortEntry(move, historyScore);
+                    }
+                    
+                    at = losingCapturesCount;
+                    moveCount = losingCapturesCount + quietCount;
+                    TerminateEntries();
                 }
                 
                 state = MoveGenerationState_QuietMoves;
@@ -229,7 +312,7 @@ public:
             case MoveGenerationState_LosingCaptures:
                 while (at < losingCapturesCount)
                 {
-                    const Move bestMove = losingCaptures[at++];
+                    const Move bestMove = Move(entries[at++]);
                     if (bestMove == hashMove)
                     {
                         continue;
@@ -246,12 +329,24 @@ public:
 	}
     
 private:
+
+	// Pads the end of the list with sentinels, so that PickBestMove can read whole vectors past the last move.
+	inline void TerminateEntries()
+	{
+		ASSERT(moveCount <= maxMoves);
+		entries[moveCount] = MoveSortSentinel;
+		entries[moveCount + 1] = MoveSortSentinel;
+		entries[moveCount + 2] = MoveSortSentinel;
+		entries[moveCount + 3] = MoveSortSentinel;
+	}
     
-	Move moves[maxMoves];
-	s16 moveScores[maxMoves];
+	// Moves are generated as plain 16 bit moves into the same storage, then widened in place into scored entries.
+	union
+	{
+		MoveSortEntry entries[maxMoves + 4];
+		Move generated[(maxMoves + 4) * 2];
+	};
 	int moveCount;
-    
-	Move losingCaptures[32];
 	int losingCapturesCount;
     
     bool generatePawnMoves;